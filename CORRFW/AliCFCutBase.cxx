@@ -20,6 +20,8 @@
 // silvia.Arcelli@cern.ch
 
 #include "AliCFCutBase.h"
+#include "TBits.h"
+#include "TObjArray.h"
 
 
 ClassImp(AliCFCutBase)
@@ -54,3 +56,21 @@ AliCFCutBase::AliCFCutBase(const AliCFCutBase& obj):
   // Copy Constructor
   //
 }
+
+//___________________________________________________________________________
+Int_t AliCFCutBase::SelectBatch(const TObjArray *objs, TBits &mask)
+{
+  //
+  // Evaluates the cut on all the objects of objs whose bit is set in mask,
+  // and clears the bit of those which are rejected.
+  // Returns the number of objects still selected.
+  // Derived classes may override this to evaluate their criteria in one pass.
+  //
+  Int_t nSelected = 0;
+  for (Int_t i=0; i<objs->GetEntriesFast(); i++) {
+    if (!mask.TestBitNumber(i)) continue;
+    if (IsSelected(objs->UncheckedAt(i))) nSelected++;
+    else mask.SetBitNumber(i,kFALSE);
+  }
+  return nSelected;
+}
@@ -23,6 +23,7 @@
 #include <AliAnalysisCuts.h>
 class TBits;
 class TList;
+class TObjArray;
 //___________________________________________________________________________
 class AliCFCutBase : public AliAnalysisCuts
 {
@@ -35,6 +36,7 @@ class AliCFCutBase : public AliAnalysisCuts
   virtual void SetQAOn(TList* list) {fIsQAOn=kTRUE; AddQAHistograms(list);} //QA flag setter
   virtual void  SetMCEventInfo(const TObject *) {} //Pass pointer to MC event
   virtual void SetRecEventInfo(const TObject *) {} //Pass pointer to reconstructed event
+  virtual Int_t SelectBatch(const TObjArray *objs, TBits &mask); //clears the bits of mask for the objects failing the cut
   
  protected:
   Bool_t fIsQAOn;//qa checking on/off
@@ -21,6 +21,7 @@
 // efficiency calculation.
 // prototype version by S.Arcelli silvia.arcelli@cern.ch
 ///////////////////////////////////////////////////////////////////////////
+#include "TBits.h"
 #include "AliCFCutBase.h"
 #include "AliCFManager.h"
 
@@ -34,7 +35,15 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtChains(),
+  fPartChains(),
+  fEvtChainNCuts(),
+  fPartChainNCuts(),
+  fEvtChainSel(),
+  fPartChainSel(),
+  fEvtChainsValid(kFALSE),
+  fPartChainsValid(kFALSE)
 { 
   //
   // ctor
@@ -48,7 +57,15 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtChains(),
+  fPartChains(),
+  fEvtChainNCuts(),
+  fPartChainNCuts(),
+  fEvtChainSel(),
+  fPartChainSel(),
+  fEvtChainsValid(kFALSE),
+  fPartChainsValid(kFALSE)
 { 
    //
    // ctor
@@ -62,7 +79,15 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fEvtChains(),
+  fPartChains(),
+  fEvtChainNCuts(),
+  fPartChainNCuts(),
+  fEvtChainSel(),
+  fPartChainSel(),
+  fEvtChainsValid(kFALSE),
+  fPartChainsValid(kFALSE)
 { 
    //
    //copy ctor
@@ -84,6 +109,8 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  this->fEvtChainsValid=kFALSE;
+  this->fPartChainsValid=kFALSE;
   return *this ;
 }
 
@@ -104,17 +131,37 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
     return kTRUE;
   }
-  if(!fPartCutList[isel])return kTRUE;
-  TObjArrayIter iter(fPartCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const std::vector<AliCFCutBase*> &chain = GetParticleChain(isel,selcuts);
+  for (UInt_t icut=0; icut<chain.size(); icut++) {
+    if (!chain[icut]->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckParticleCuts(Int_t isel, const TObjArray *objs, TBits &mask, const TString  &selcuts) const {
+  //
+  // check which objects of objs pass particle-level selection isel
+  // bit i of mask is set if objs[i] is selected
+  //
+
+  mask.ResetAllBits();
+  Int_t nobj = objs ? objs->GetEntriesFast() : 0 ;
+  for (Int_t iobj=0; iobj<nobj; iobj++) mask.SetBitNumber(iobj,kTRUE);
+  if (nobj==0) return 0;
+
+  if(isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+    return nobj;
+  }
+  const std::vector<AliCFCutBase*> &chain = GetParticleChain(isel,selcuts);
+  Int_t nSelected = nobj;
+  for (UInt_t icut=0; icut<chain.size() && nSelected>0; icut++) {
+    nSelected = chain[icut]->SelectBatch(objs,mask);
+  }
+  return nSelected;
+}
+
 //_____________________________________________________________________________
 Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &selcuts) const{
   //
@@ -125,13 +172,9 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
     AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepEvt));
       return kTRUE;
   }
-  if(!fEvtCutList[isel])return kTRUE;
-  TObjArrayIter iter(fEvtCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const std::vector<AliCFCutBase*> &chain = GetEventChain(isel,selcuts);
+  for (UInt_t icut=0; icut<chain.size(); icut++) {
+    if (!chain[icut]->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
@@ -207,6 +250,73 @@ void  AliCFManager::SetRecEventInfo(const TObject *obj) const {
   }
 }
 
+//_____________________________________________________________________________
+void AliCFManager::ResolveChains(TObjArray **lists, Int_t nstep, const TString &selcuts,
+                                 std::vector<std::vector<AliCFCutBase*> > &chains, std::vector<Int_t> &nCuts) const {
+  //
+  // builds, for each step, the list of cuts whose name matches selcuts
+  //
+
+  chains.assign(nstep,std::vector<AliCFCutBase*>());
+  nCuts.assign(nstep,0);
+  if (!lists) return;
+  for (Int_t isel=0; isel<nstep; isel++) {
+    if (!lists[isel]) continue;
+    nCuts[isel] = lists[isel]->GetEntriesFast();
+    TObjArrayIter iter(lists[isel]);
+    AliCFCutBase *cut = 0;
+    while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+      if (CompareStrings(cut->GetName(),selcuts)) chains[isel].push_back(cut);
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void AliCFManager::ResolveCutChains(const TString &selcuts) const {
+  //
+  // resolves the event and particle cut lists for the selection string selcuts
+  //
+
+  ResolveChains(fEvtCutList ,fNStepEvt ,selcuts,fEvtChains ,fEvtChainNCuts);
+  ResolveChains(fPartCutList,fNStepPart,selcuts,fPartChains,fPartChainNCuts);
+  fEvtChainSel  = selcuts;
+  fPartChainSel = selcuts;
+  fEvtChainsValid  = kTRUE;
+  fPartChainsValid = kTRUE;
+}
+
+//_____________________________________________________________________________
+const std::vector<AliCFCutBase*>& AliCFManager::GetParticleChain(Int_t isel, const TString &selcuts) const {
+  //
+  // returns the resolved particle cut list of step isel, resolving it again
+  // if the selection string or the number of cuts in the list changed
+  //
+
+  if (!fPartChainsValid || (Int_t)fPartChains.size()!=fNStepPart || fPartChainSel!=selcuts ||
+      (fPartCutList && fPartCutList[isel] && fPartCutList[isel]->GetEntriesFast()!=fPartChainNCuts[isel])) {
+    ResolveChains(fPartCutList,fNStepPart,selcuts,fPartChains,fPartChainNCuts);
+    fPartChainSel = selcuts;
+    fPartChainsValid = kTRUE;
+  }
+  return fPartChains[isel];
+}
+
+//_____________________________________________________________________________
+const std::vector<AliCFCutBase*>& AliCFManager::GetEventChain(Int_t isel, const TString &selcuts) const {
+  //
+  // returns the resolved event cut list of step isel, resolving it again
+  // if the selection string or the number of cuts in the list changed
+  //
+
+  if (!fEvtChainsValid || (Int_t)fEvtChains.size()!=fNStepEvt || fEvtChainSel!=selcuts ||
+      (fEvtCutList && fEvtCutList[isel] && fEvtCutList[isel]->GetEntriesFast()!=fEvtChainNCuts[isel])) {
+    ResolveChains(fEvtCutList,fNStepEvt,selcuts,fEvtChains,fEvtChainNCuts);
+    fEvtChainSel = selcuts;
+    fEvtChainsValid = kTRUE;
+  }
+  return fEvtChains[isel];
+}
+
 //_____________________________________________________________________________
 Bool_t AliCFManager::CompareStrings(const TString  &cutname,const TString  &selcuts) const{
   //
@@ -243,6 +353,7 @@ void AliCFManager::SetEventCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fEvtCutList[isel] = array;
+  fEvtChainsValid = kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -267,4 +378,5 @@ void AliCFManager::SetParticleCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fPartCutList[isel] = array;
+  fPartChainsValid = kFALSE;
 }
@@ -24,10 +24,15 @@
 // now the number of steps are fixed by the particle/event containers themselves.
 //
 
+#include <vector>
 #include "TNamed.h"
+#include "TString.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
+class TBits;
+class AliCFCutBase;
+
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
 {
@@ -116,6 +121,17 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Batch checker: evaluates the particle-level selection isel on all the
+  //objects of objs, bit i of mask is set if objs[i] passes. Returns the
+  //number of selected objects. Each cut is run over the whole array before
+  //the next one (see AliCFCutBase::SelectBatch)
+  virtual Int_t  CheckParticleCuts(Int_t isel, const TObjArray *objs, TBits &mask, const TString &selcuts="all") const;
+
+  //The selection strings are resolved into per-step lists of cut pointers,
+  //which are kept until a different string is used or the cut lists change.
+  //This can be called explicitly after modifying a cut list already set.
+  void ResolveCutChains(const TString &selcuts="all") const;
+
  private:
   
   //number of steps
@@ -130,9 +146,23 @@ class AliCFManager : public TNamed
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
+  // cut lists resolved for a given selection string
+  mutable std::vector<std::vector<AliCFCutBase*> > fEvtChains;  //! cuts of fEvtCutList[isel] matching fEvtChainSel
+  mutable std::vector<std::vector<AliCFCutBase*> > fPartChains; //! cuts of fPartCutList[isel] matching fPartChainSel
+  mutable std::vector<Int_t> fEvtChainNCuts;                    //! size of fEvtCutList[isel] when resolved
+  mutable std::vector<Int_t> fPartChainNCuts;                   //! size of fPartCutList[isel] when resolved
+  mutable TString fEvtChainSel;                                 //! selection string of fEvtChains
+  mutable TString fPartChainSel;                                //! selection string of fPartChains
+  mutable Bool_t  fEvtChainsValid;                              //! fEvtChains is up to date
+  mutable Bool_t  fPartChainsValid;                             //! fPartChains is up to date
+
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  void   ResolveChains(TObjArray **lists, Int_t nstep, const TString &selcuts,
+                       std::vector<std::vector<AliCFCutBase*> > &chains, std::vector<Int_t> &nCuts) const;
+  const std::vector<AliCFCutBase*>& GetParticleChain(Int_t isel, const TString &selcuts) const;
+  const std::vector<AliCFCutBase*>& GetEventChain(Int_t isel, const TString &selcuts) const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
@@ -50,6 +50,7 @@
 #include <TDirectory.h>
 #include <TH2.h>
 #include <TBits.h>
+#include <TObjArray.h>
 
 #include <AliESDtrack.h>
 #include <AliESDtrackCuts.h>
@@ -584,6 +585,139 @@ Bool_t AliCFTrackQualityCuts::IsSelected(TObject* obj) {
   return kTRUE;
 }
 //__________________________________________________________________________________
+void AliCFTrackQualityCuts::TrackArrays::Clear()
+{
+  //
+  // removes all the entries
+  //
+  fValid.clear();
+  fIsESD.clear();
+  fNClusterTPC.clear();
+  fNClusterITS.clear();
+  fNClusterTRD.clear();
+  fNTrackletTRD.clear();
+  fNTrackletTRDpid.clear();
+  fNdEdxClusterTPC.clear();
+  fFoundClusterTPC.clear();
+  fChi2PerClusterTPC.clear();
+  fChi2PerClusterITS.clear();
+  fChi2PerTrackletTRD.clear();
+  for (Int_t i=0; i<5; i++) fCov[i].clear();
+  fStatus.clear();
+}
+//__________________________________________________________________________________
+void AliCFTrackQualityCuts::FillTrackArrays(const TObjArray *tracks, TrackArrays &arrays)
+{
+  //
+  // extracts once the quantities used by the selection for all the tracks,
+  // with the same definitions as in SelectionBitMap
+  //
+  arrays.Clear();
+  Int_t ntracks = tracks->GetEntriesFast();
+
+  for (Int_t itrack=0; itrack<ntracks; itrack++) {
+    TObject *obj = tracks->UncheckedAt(itrack);
+    AliESDtrack * esdTrack = obj ? dynamic_cast<AliESDtrack*>(obj) : 0x0;
+    AliAODTrack * aodTrack = obj ? dynamic_cast<AliAODTrack*>(obj) : 0x0;
+
+    Bool_t isESDTrack = esdTrack && strcmp(obj->ClassName(),"AliESDtrack") == 0;
+
+    Int_t    nClustersTPC = 0;
+    Int_t    nClustersITS = 0;
+    Int_t    nClustersTRD = 0;
+    Int_t    nTrackletsTRD = 0;
+    Int_t    nTrackletsTRDpid = 0;
+    Int_t    nPointsdEdx = 0;
+    Float_t  chi2PerClusterTPC = 0;
+    Float_t  chi2PerClusterITS = 0;
+    Float_t  chi2PerTrackletTRD = 0;
+    Float_t  fractionFoundClustersTPC = 0;
+    Double_t extCov[15]={0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+    ULong_t  status = 0;
+
+    if (isESDTrack) {
+      nClustersTRD = esdTrack->GetTRDncls();
+      nTrackletsTRD = esdTrack->GetTRDntracklets();
+      if (nTrackletsTRD != 0) chi2PerTrackletTRD = esdTrack->GetTRDchi2() / Float_t(nTrackletsTRD);
+      nClustersTPC = esdTrack->GetTPCclusters(0x0);
+      nClustersITS = esdTrack->GetITSclusters(0x0);
+      if (nClustersTPC != 0) chi2PerClusterTPC = esdTrack->GetTPCchi2() / Float_t(nClustersTPC);
+      if (nClustersITS != 0) chi2PerClusterITS = esdTrack->GetITSchi2() / Float_t(nClustersITS);
+      esdTrack->GetExternalCovariance(extCov);
+      if (esdTrack->GetTPCNclsF() != 0) fractionFoundClustersTPC = float(nClustersTPC) / float(esdTrack->GetTPCNclsF());
+      nTrackletsTRDpid = esdTrack->GetTRDntrackletsPID();
+      nPointsdEdx = esdTrack->GetTPCsignalN();
+      status = esdTrack->GetStatus();
+    }
+    else if (aodTrack) status = aodTrack->GetStatus();
+
+    arrays.fValid.push_back(esdTrack || aodTrack);
+    arrays.fIsESD.push_back(isESDTrack);
+    arrays.fNClusterTPC.push_back(nClustersTPC);
+    arrays.fNClusterITS.push_back(nClustersITS);
+    arrays.fNClusterTRD.push_back(nClustersTRD);
+    arrays.fNTrackletTRD.push_back(nTrackletsTRD);
+    arrays.fNTrackletTRDpid.push_back(nTrackletsTRDpid);
+    arrays.fNdEdxClusterTPC.push_back(nPointsdEdx);
+    arrays.fFoundClusterTPC.push_back(fractionFoundClustersTPC);
+    arrays.fChi2PerClusterTPC.push_back(chi2PerClusterTPC);
+    arrays.fChi2PerClusterITS.push_back(chi2PerClusterITS);
+    arrays.fChi2PerTrackletTRD.push_back(chi2PerTrackletTRD);
+    arrays.fCov[0].push_back(extCov[0]);
+    arrays.fCov[1].push_back(extCov[2]);
+    arrays.fCov[2].push_back(extCov[5]);
+    arrays.fCov[3].push_back(extCov[9]);
+    arrays.fCov[4].push_back(extCov[14]);
+    arrays.fStatus.push_back(status);
+  }
+}
+//__________________________________________________________________________________
+Int_t AliCFTrackQualityCuts::SelectArrays(const TrackArrays &arrays, TBits &mask) const
+{
+  //
+  // applies the selection to the tracks of arrays whose bit is set in mask,
+  // and clears the bit of the rejected ones. No QA histogram is filled.
+  //
+  Int_t nSelected = 0;
+  for (Int_t i=0; i<arrays.GetSize(); i++) {
+    if (!mask.TestBitNumber(i)) continue;
+    Bool_t isESD = arrays.fIsESD[i];
+    Bool_t pass =
+      arrays.fValid[i] &&
+      arrays.fNClusterTPC[i] >= fMinNClusterTPC &&
+      arrays.fNClusterITS[i] >= fMinNClusterITS &&
+      arrays.fNClusterTRD[i] >= fMinNClusterTRD &&
+      ((fMinFoundClusterTPC <= 0) || (arrays.fNClusterTPC[i] > 0 && arrays.fFoundClusterTPC[i] >= fMinFoundClusterTPC)) &&
+      arrays.fNTrackletTRD[i] >= fMinNTrackletTRD &&
+      (!isESD || arrays.fNTrackletTRDpid[i] >= fMinNTrackletTRDpid) &&
+      arrays.fChi2PerClusterTPC[i] <= fMaxChi2PerClusterTPC &&
+      arrays.fChi2PerClusterITS[i] <= fMaxChi2PerClusterITS &&
+      arrays.fChi2PerTrackletTRD[i] <= fMaxChi2PerTrackletTRD &&
+      (!isESD || arrays.fNdEdxClusterTPC[i] >= fMinNdEdxClusterTPC) &&
+      arrays.fCov[0][i] <= fCovariance11Max &&
+      arrays.fCov[1][i] <= fCovariance22Max &&
+      arrays.fCov[2][i] <= fCovariance33Max &&
+      arrays.fCov[3][i] <= fCovariance44Max &&
+      arrays.fCov[4][i] <= fCovariance55Max &&
+      (arrays.fStatus[i] & fStatus) == fStatus;
+    if (pass) nSelected++;
+    else mask.SetBitNumber(i,kFALSE);
+  }
+  return nSelected;
+}
+//__________________________________________________________________________________
+Int_t AliCFTrackQualityCuts::SelectBatch(const TObjArray *objs, TBits &mask)
+{
+  //
+  // batch selection : if the QA is off, the cut quantities are extracted
+  // into arrays once and evaluated in a single loop
+  //
+  if (fIsQAOn) return AliCFCutBase::SelectBatch(objs,mask);
+  TrackArrays arrays;
+  FillTrackArrays(objs,arrays);
+  return SelectArrays(arrays,mask);
+}
+//__________________________________________________________________________________
 void AliCFTrackQualityCuts::SetHistogramBins(Int_t index, Int_t nbins, Double_t *bins)
 {
   //
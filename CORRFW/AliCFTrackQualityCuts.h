@@ -47,6 +47,7 @@
 #ifndef ALICFTRACKQUALITYCUTS_H
 #define ALICFTRACKQUALITYCUTS_H
 
+#include <vector>
 #include "AliCFCutBase.h"
 
 class TH2F;
@@ -68,6 +69,29 @@ class AliCFTrackQualityCuts : public AliCFCutBase
   Bool_t IsSelected(TObject* obj);
   Bool_t IsSelected(TList* /*list*/) {return kTRUE;}
 
+  // structure-of-arrays view of the quantities used by the selection, one entry per track
+  struct TrackArrays {
+    std::vector<Bool_t>   fValid;              // ESD or AOD track
+    std::vector<Bool_t>   fIsESD;              // ESD track (the TRD pid and dEdx cluster cuts apply only to them)
+    std::vector<Int_t>    fNClusterTPC;        // number of clusters in TPC
+    std::vector<Int_t>    fNClusterITS;        // number of clusters in ITS
+    std::vector<Int_t>    fNClusterTRD;        // number of clusters in TRD
+    std::vector<Int_t>    fNTrackletTRD;       // number of tracklets in TRD
+    std::vector<Int_t>    fNTrackletTRDpid;    // number of tracklets for TRD pid
+    std::vector<Int_t>    fNdEdxClusterTPC;    // number of points used for dEdx
+    std::vector<Float_t>  fFoundClusterTPC;    // ratio found / findable number of clusters in TPC
+    std::vector<Float_t>  fChi2PerClusterTPC;  // chi2 per cluster in TPC
+    std::vector<Float_t>  fChi2PerClusterITS;  // chi2 per cluster in ITS
+    std::vector<Float_t>  fChi2PerTrackletTRD; // chi2 per tracklet in TRD
+    std::vector<Double_t> fCov[5];             // diagonal elements of the covariance matrix
+    std::vector<ULong_t>  fStatus;             // track status
+    void  Clear();
+    Int_t GetSize() const {return fValid.size();}
+  };
+  static void FillTrackArrays(const TObjArray *tracks, TrackArrays &arrays);
+  Int_t SelectArrays(const TrackArrays &arrays, TBits &mask) const;
+  Int_t SelectBatch(const TObjArray *objs, TBits &mask);
+
   // cut value setter
   void SetMinNClusterTPC(Int_t cluster=-1)		{fMinNClusterTPC = cluster;}
   void SetMinNClusterITS(Int_t cluster=-1)		{fMinNClusterITS = cluster;}
@@ -85,6 +85,7 @@
 
 
 #include "AliCFUnfolding.h"
+#include "AliCFUnfoldingEngine.h"
 #include "TMath.h"
 #include "TAxis.h"
 #include "TF1.h"
@@ -130,7 +131,9 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fUseDenseEngine(kFALSE),
+  fNThreads(1)
 {
   //
   // default constructor
@@ -174,7 +177,9 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fUseDenseEngine(kFALSE),
+  fNThreads(1)
 {
   //
   // named constructor
@@ -350,6 +355,14 @@ void AliCFUnfolding::Unfold() {
   // several iterations are performed until a reasonable chi2 or convergence criterion is reached
   //
 
+  if (fUseDenseEngine && fNCalcCorrErrors == 0) {
+    if (!fUseSmoothing) {
+      UnfoldDense();
+      return;
+    }
+    AliWarning("Smoothing is not supported by the dense engine, using the THnSparse implementation");
+  }
+
   Int_t iIterBayes     = 0 ;
   Double_t convergence = 0.;
 
@@ -443,6 +456,71 @@ void AliCFUnfolding::CreateUnfolded() {
 
 //______________________________________________________________
 
+void AliCFUnfolding::UnfoldDense() {
+  //
+  // Same as Unfold() + CalculateCorrelatedErrors(), but performed by AliCFUnfoldingEngine :
+  // the response, efficiency, measured and prior inputs are converted once into compact arrays,
+  // the iterations are sparse matrix-vector products, and the randomised spectra are unfolded
+  // in parallel (fNThreads) with one random stream per toy.
+  // The output histograms are filled only once at the end ; the intermediate ones
+  // (prior, inverse response, measured estimate) correspond to the nominal unfolding.
+  //
+
+  AliCFUnfoldingEngine engine;
+  if (!engine.Build(fNVariables,fConditional,fEfficiency,fMeasured,fPrior,fPriorOrig)) {
+    AliError("Could not build the dense unfolding engine, using the THnSparse implementation");
+    fUseDenseEngine = kFALSE;
+    Unfold();
+    return;
+  }
+
+  std::vector<Double_t> prior(engine.GetPrior());
+  std::vector<Double_t> unfolded, estMeasured, inverse;
+  Double_t convergence = 0.;
+  Int_t iConverged = engine.Iterate(prior,engine.GetEfficiency(),engine.GetMeasured(),fMaxNumIterations,fMaxConvergence,
+                                    unfolded,estMeasured,convergence,&inverse);
+  if (iConverged>=0) {
+    fNRandomIterations = iConverged;
+    AliDebug(0,Form("convergence is met at iteration %d",iConverged));
+  }
+
+  fUnfolded->Reset();
+  engine.WriteTrue(fUnfolded,unfolded);
+  fPrior->Reset();
+  engine.WriteTrue(fPrior,prior);
+  fMeasuredEstimate->Reset();
+  engine.WriteMeasured(fMeasuredEstimate,estMeasured);
+  engine.WriteMatrix(fInverseResponse,inverse);
+
+  fUnfoldedFinal = (THnSparse*) fUnfolded->Clone() ;
+
+  AliInfo(Form("\n================================================\nFinished bayes iteration, now calculating errors with %d thread(s)...\n================================================\n",fNThreads));
+  fNCalcCorrErrors = 1;
+
+  std::vector<Double_t> sum, sum2;
+  engine.RunToys(fNRandomIterations,fMaxNumIterations,unfolded,fRandom3->Integer(kMaxUInt),fNThreads,sum,sum2);
+
+  // same estimators as in FillDeltaUnfoldedProfile and CalculateCorrelatedErrors
+  Int_t nTrue = engine.GetNTrueBins();
+  Double_t entriesInBin = fNRandomIterations;
+  std::vector<Double_t> mean(nTrue,0.), meanx2(nTrue,0.), entries(nTrue,0.), sigma(nTrue,0.);
+  for (Int_t iT=0; iT<nTrue; iT++) {
+    if (!(unfolded[iT]>0.) || entriesInBin<1.) continue;
+    mean[iT]    = sum [iT]/entriesInBin;
+    meanx2[iT]  = sum2[iT]/entriesInBin;
+    entries[iT] = entriesInBin;
+    if (entriesInBin > 1.) sigma[iT] = TMath::Sqrt((entriesInBin/(entriesInBin-1.))*TMath::Abs(meanx2[iT]-mean[iT]*mean[iT]));
+  }
+  engine.WriteTrue(fDeltaUnfoldedP,mean,&meanx2);
+  engine.WriteTrue(fDeltaUnfoldedN,entries);
+  engine.WriteTrue(fUnfoldedFinal,unfolded,&sigma);
+
+  fNCalcCorrErrors = 2;
+  AliInfo(Form("\n\n=======================\nFinished : convergence is %e and you required it to be < %e\n=======================\n\n",convergence,fMaxConvergence));
+}
+
+//______________________________________________________________
+
 void AliCFUnfolding::CalculateCorrelatedErrors() {
 
   // Step 1: Create randomized distribution (fRandomXXXX) of each bin of 
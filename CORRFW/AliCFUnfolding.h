@@ -37,6 +37,11 @@ class AliCFUnfolding : public TNamed {
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
 
+  void SetUseDenseEngine(Bool_t b = kTRUE, Int_t nThreads = 1) { // run the iterations on compact arrays (see AliCFUnfoldingEngine)
+    fUseDenseEngine=b;                                           // and distribute the error toys over nThreads threads
+    fNThreads=nThreads;                                          // not used together with smoothing
+  }
+
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
     fSmoothFunction=fcn;                                   // the option "opt" is used if "fcn" is specified
@@ -111,6 +116,8 @@ class AliCFUnfolding : public TNamed {
   THnSparse     *fDeltaUnfoldedN;    // Entries of the delta-unfolded distribution (count for each bin)
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
+  Bool_t         fUseDenseEngine;    // Unfold with AliCFUnfoldingEngine instead of THnSparse operations
+  Int_t          fNThreads;          // Number of threads for the error toys of the dense engine
 
 
   // functions
@@ -131,8 +138,9 @@ class AliCFUnfolding : public TNamed {
   void     CreateRandomizedDist();      // Create randomized dist from measured distribution
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
+  void     UnfoldDense();               // Unfold and calculate correlated errors with AliCFUnfoldingEngine
 
-  ClassDef(AliCFUnfolding,1);
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
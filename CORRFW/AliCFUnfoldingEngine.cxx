@@ -0,0 +1,386 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//---------------------------------------------------------------------//
+//                                                                     //
+// AliCFUnfoldingEngine Class                                          //
+//                                                                     //
+// Performs the same bayesian iterations as AliCFUnfolding, but on     //
+// flat arrays instead of THnSparse objects :                          //
+//                                                                     //
+//  M(i) = SUM_k { COND(i,k) * T(k) * E(k) }                           //
+//  U(k) = SUM_i { COND(i,k) * T(k) * E(k) / M(i) * MEAS(i) / E(k) }   //
+//                                                                     //
+// The bins of the true (resp. measured) space which are present in    //
+// any of the input THnSparse are given a compact index, and the       //
+// conditional matrix is stored in CSR format with one row per         //
+// measured bin. No histogram is cloned during the iterations.         //
+//                                                                     //
+// The randomised spectra used for the correlated error calculation   //
+// are unfolded in parallel : each toy gets its own TRandom3 whose     //
+// seed is drawn serially from a base seed, so that the toys do not    //
+// depend on the number of threads.                                    //
+//                                                                     //
+//---------------------------------------------------------------------//
+
+#include "AliCFUnfoldingEngine.h"
+#include "THnSparse.h"
+#include "TAxis.h"
+#include "TRandom3.h"
+#include "AliLog.h"
+
+#include <algorithm>
+#include <map>
+#include <thread>
+
+namespace {
+  // linear key of a bin in a (sub-)space of a THnSparse, under/overflow included
+  Long64_t BinKey(const Int_t* coord, const Int_t* nCells, Int_t nVar) {
+    Long64_t key = 0;
+    for (Int_t iVar=nVar-1; iVar>=0; iVar--) key = key*nCells[iVar] + coord[iVar];
+    return key;
+  }
+
+  Int_t GetIndex(std::map<Long64_t,Int_t> &index, std::vector<Int_t> &coords, const Int_t* coord, const Int_t* nCells, Int_t nVar) {
+    Long64_t key = BinKey(coord,nCells,nVar);
+    std::map<Long64_t,Int_t>::iterator it = index.find(key);
+    if (it != index.end()) return it->second;
+    Int_t idx = index.size();
+    index[key] = idx;
+    coords.insert(coords.end(),coord,coord+nVar);
+    return idx;
+  }
+}
+
+//______________________________________________________________
+
+AliCFUnfoldingEngine::AliCFUnfoldingEngine() :
+  fNVariables(0),
+  fNTrue(0),
+  fNMeas(0),
+  fTrueCoord(),
+  fMeasCoord(),
+  fRowPtr(),
+  fCol(),
+  fCond(),
+  fEff(),
+  fEffErr(),
+  fEffFilled(),
+  fMeas(),
+  fMeasErr(),
+  fMeasFilled(),
+  fPrior(),
+  fPriorOrig()
+{
+  //
+  // default constructor
+  //
+}
+
+//______________________________________________________________
+
+Bool_t AliCFUnfoldingEngine::Build(Int_t nVar, const THnSparse* conditional, const THnSparse* efficiency,
+                                   const THnSparse* measured, const THnSparse* prior, const THnSparse* priorOrig) {
+  //
+  // converts the THnSparse inputs into compact arrays
+  // the conditional matrix has 2N dimensions : 0 -> N-1 measured, N -> 2N-1 true
+  //
+
+  if (!conditional || !efficiency || !measured || !prior || !priorOrig) return kFALSE;
+  if (conditional->GetNdimensions() != 2*nVar) return kFALSE;
+
+  fNVariables = nVar;
+
+  std::vector<Int_t> nCellsM(nVar), nCellsT(nVar);
+  for (Int_t iVar=0; iVar<nVar; iVar++) {
+    nCellsM[iVar] = conditional->GetAxis(iVar)     ->GetNbins() + 2;
+    nCellsT[iVar] = conditional->GetAxis(iVar+nVar)->GetNbins() + 2;
+  }
+
+  std::map<Long64_t,Int_t> indexM, indexT;
+  fTrueCoord.clear();
+  fMeasCoord.clear();
+
+  // collect the entries of the conditional matrix (COO) and index the bins
+  std::vector<Int_t>    entryM, entryT;
+  std::vector<Double_t> entryC;
+  std::vector<Int_t>    coord2N(2*nVar);
+  Long64_t nEntries = conditional->GetNbins();
+  entryM.reserve(nEntries);
+  entryT.reserve(nEntries);
+  entryC.reserve(nEntries);
+  for (Long64_t iBin=0; iBin<nEntries; iBin++) {
+    Double_t value = conditional->GetBinContent(iBin,coord2N.data());
+    entryM.push_back(GetIndex(indexM,fMeasCoord,coord2N.data()     ,nCellsM.data(),nVar));
+    entryT.push_back(GetIndex(indexT,fTrueCoord,coord2N.data()+nVar,nCellsT.data(),nVar));
+    entryC.push_back(value);
+  }
+
+  // the spectra may contain bins which are not in the response
+  std::vector<Int_t> coordN(nVar);
+  const THnSparse* trueSpectra[3] = {efficiency,prior,priorOrig};
+  for (Int_t iSp=0; iSp<3; iSp++) {
+    for (Long64_t iBin=0; iBin<trueSpectra[iSp]->GetNbins(); iBin++) {
+      trueSpectra[iSp]->GetBinContent(iBin,coordN.data());
+      GetIndex(indexT,fTrueCoord,coordN.data(),nCellsT.data(),nVar);
+    }
+  }
+  for (Long64_t iBin=0; iBin<measured->GetNbins(); iBin++) {
+    measured->GetBinContent(iBin,coordN.data());
+    GetIndex(indexM,fMeasCoord,coordN.data(),nCellsM.data(),nVar);
+  }
+
+  fNTrue = indexT.size();
+  fNMeas = indexM.size();
+
+  // build the CSR matrix (rows = measured bins)
+  fRowPtr.assign(fNMeas+1,0);
+  for (size_t k=0; k<entryM.size(); k++) fRowPtr[entryM[k]+1]++;
+  for (Int_t iRow=0; iRow<fNMeas; iRow++) fRowPtr[iRow+1] += fRowPtr[iRow];
+  fCol.resize(entryM.size());
+  fCond.resize(entryM.size());
+  std::vector<Int_t> fillPos(fRowPtr.begin(),fRowPtr.end()-1);
+  for (size_t k=0; k<entryM.size(); k++) {
+    Int_t pos   = fillPos[entryM[k]]++;
+    fCol[pos]   = entryT[k];
+    fCond[pos]  = entryC[k];
+  }
+
+  // flat spectra
+  fEff      .assign(fNTrue,0.);
+  fEffErr   .assign(fNTrue,0.);
+  fEffFilled.assign(fNTrue,kFALSE);
+  fPrior    .assign(fNTrue,0.);
+  fPriorOrig.assign(fNTrue,0.);
+  fMeas      .assign(fNMeas,0.);
+  fMeasErr   .assign(fNMeas,0.);
+  fMeasFilled.assign(fNMeas,kFALSE);
+
+  for (Long64_t iBin=0; iBin<efficiency->GetNbins(); iBin++) {
+    Double_t value = efficiency->GetBinContent(iBin,coordN.data());
+    Int_t    idx   = indexT[BinKey(coordN.data(),nCellsT.data(),nVar)];
+    fEff[idx]       = value;
+    fEffErr[idx]    = efficiency->GetBinError(iBin);
+    fEffFilled[idx] = kTRUE;
+  }
+  for (Long64_t iBin=0; iBin<prior->GetNbins(); iBin++) {
+    Double_t value = prior->GetBinContent(iBin,coordN.data());
+    fPrior[indexT[BinKey(coordN.data(),nCellsT.data(),nVar)]] = value;
+  }
+  for (Long64_t iBin=0; iBin<priorOrig->GetNbins(); iBin++) {
+    Double_t value = priorOrig->GetBinContent(iBin,coordN.data());
+    fPriorOrig[indexT[BinKey(coordN.data(),nCellsT.data(),nVar)]] = value;
+  }
+  for (Long64_t iBin=0; iBin<measured->GetNbins(); iBin++) {
+    Double_t value = measured->GetBinContent(iBin,coordN.data());
+    Int_t    idx   = indexM[BinKey(coordN.data(),nCellsM.data(),nVar)];
+    fMeas[idx]       = value;
+    fMeasErr[idx]    = measured->GetBinError(iBin);
+    fMeasFilled[idx] = kTRUE;
+  }
+
+  AliDebugClass(1,Form("%d true bins, %d measured bins, %d non-empty response cells",fNTrue,fNMeas,(Int_t)fCol.size()));
+  return kTRUE;
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfoldingEngine::Iterate(std::vector<Double_t> &prior, const std::vector<Double_t> &eff, const std::vector<Double_t> &meas,
+                                    Int_t maxIter, Double_t maxConvergence, std::vector<Double_t> &unfolded,
+                                    std::vector<Double_t> &estMeasured, Double_t &convergence, std::vector<Double_t> *inverse) const {
+  //
+  // bayes iterations, see AliCFUnfolding::CreateEstMeasured, CreateInvResponse and CreateUnfolded
+  // the same positivity requirements as in the THnSparse implementation are applied on each term
+  //
+
+  std::vector<Double_t> priorTimesEff(fNTrue);
+  unfolded.assign(fNTrue,0.);
+  estMeasured.assign(fNMeas,0.);
+  if (inverse) inverse->assign(fCol.size(),0.);
+  convergence = 0.;
+
+  for (Int_t iIter=0; iIter<maxIter; iIter++) {
+
+    for (Int_t iT=0; iT<fNTrue; iT++) priorTimesEff[iT] = prior[iT]*eff[iT];
+
+    // measured estimate
+    for (Int_t iM=0; iM<fNMeas; iM++) {
+      Double_t sum = 0.;
+      for (Int_t k=fRowPtr[iM]; k<fRowPtr[iM+1]; k++) {
+        Double_t fill = fCond[k]*priorTimesEff[fCol[k]];
+        if (fill>0.) sum += fill;
+      }
+      estMeasured[iM] = sum;
+    }
+
+    // inverse response and unfolded spectrum
+    std::fill(unfolded.begin(),unfolded.end(),0.);
+    for (Int_t iM=0; iM<fNMeas; iM++) {
+      Double_t estMeasuredValue = estMeasured[iM];
+      if (!(estMeasuredValue>0.)) {
+        if (inverse) std::fill(inverse->begin()+fRowPtr[iM],inverse->begin()+fRowPtr[iM+1],0.);
+        continue;
+      }
+      Double_t measuredValue = meas[iM];
+      for (Int_t k=fRowPtr[iM]; k<fRowPtr[iM+1]; k++) {
+        Int_t    iT     = fCol[k];
+        Double_t invResponseValue = fCond[k]*priorTimesEff[iT]/estMeasuredValue;
+        if (inverse) (*inverse)[k] = invResponseValue;
+        if (!(eff[iT]>0.)) continue;
+        Double_t fill = invResponseValue*measuredValue/eff[iT];
+        if (fill>0.) unfolded[iT] += fill;
+      }
+    }
+
+    // convergence wrt prior
+    convergence = 0.;
+    for (Int_t iT=0; iT<fNTrue; iT++) {
+      Double_t priorValue = prior[iT];
+      if (priorValue>0.) convergence += ((priorValue-unfolded[iT])/priorValue)*((priorValue-unfolded[iT])/priorValue);
+    }
+    AliDebugClass(2,Form("convergence at iteration %d is %e",iIter,convergence));
+
+    if (maxConvergence>0. && convergence<maxConvergence) return iIter;
+
+    // update the prior distribution
+    prior = unfolded;
+  }
+  return -1;
+}
+
+//______________________________________________________________
+
+void AliCFUnfoldingEngine::RunToys(Int_t nToys, Int_t maxIter, const std::vector<Double_t> &reference, UInt_t baseSeed, Int_t nThreads,
+                                   std::vector<Double_t> &sum, std::vector<Double_t> &sum2) const {
+  //
+  // unfolds nToys randomised spectra, distributing them over nThreads workers
+  // the per-toy seeds are drawn serially so that results do not depend on the scheduling
+  //
+
+  sum .assign(fNTrue,0.);
+  sum2.assign(fNTrue,0.);
+  if (nToys<=0) return;
+
+  TRandom3 seeder(baseSeed);
+  std::vector<UInt_t> seeds(nToys);
+  for (Int_t iToy=0; iToy<nToys; iToy++) seeds[iToy] = 1 + seeder.Integer(kMaxUInt-1); // 0 would mean a time-based seed
+
+  if (nThreads<1) nThreads = 1;
+  if (nThreads>nToys) nThreads = nToys;
+
+  if (nThreads==1) {
+    RunToyRange(0,1,nToys,maxIter,reference,seeds,sum,sum2);
+    return;
+  }
+
+  std::vector<std::vector<Double_t> > sumW (nThreads);
+  std::vector<std::vector<Double_t> > sum2W(nThreads);
+  std::vector<std::thread> workers;
+  for (Int_t iW=0; iW<nThreads; iW++) {
+    workers.push_back(std::thread(&AliCFUnfoldingEngine::RunToyRange,this,iW,nThreads,nToys,maxIter,
+                                  std::cref(reference),std::cref(seeds),std::ref(sumW[iW]),std::ref(sum2W[iW])));
+  }
+  for (Int_t iW=0; iW<nThreads; iW++) workers[iW].join();
+
+  // merge in worker order
+  for (Int_t iW=0; iW<nThreads; iW++) {
+    for (Int_t iT=0; iT<fNTrue; iT++) {
+      sum [iT] += sumW [iW][iT];
+      sum2[iT] += sum2W[iW][iT];
+    }
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfoldingEngine::RunToyRange(Int_t first, Int_t step, Int_t nToys, Int_t maxIter, const std::vector<Double_t> &reference,
+                                       const std::vector<UInt_t> &seeds, std::vector<Double_t> &sum, std::vector<Double_t> &sum2) const {
+  //
+  // unfolds toys first, first+step, ... and accumulates (reference-unfolded) and its square
+  // the efficiency and measured bins are smeared with a gaussian (mean=value, sigma=error)
+  // as in AliCFUnfolding::CreateRandomizedDist. The conditional matrix is not randomised,
+  // as it is built only once from the original response in AliCFUnfolding as well.
+  //
+
+  sum .assign(fNTrue,0.);
+  sum2.assign(fNTrue,0.);
+
+  std::vector<Double_t> eff(fNTrue), meas(fNMeas), prior, unfolded, estMeasured;
+  Double_t convergence = 0.;
+
+  for (Int_t iToy=first; iToy<nToys; iToy+=step) {
+    TRandom3 random(seeds[iToy]);
+    for (Int_t iT=0; iT<fNTrue; iT++) eff [iT] = fEffFilled [iT] ? random.Gaus(fEff [iT],fEffErr [iT]) : 0.;
+    for (Int_t iM=0; iM<fNMeas; iM++) meas[iM] = fMeasFilled[iM] ? random.Gaus(fMeas[iM],fMeasErr[iM]) : 0.;
+    prior = fPriorOrig;
+
+    Iterate(prior,eff,meas,maxIter,0.,unfolded,estMeasured,convergence);
+
+    for (Int_t iT=0; iT<fNTrue; iT++) {
+      if (!(reference[iT]>0.)) continue;
+      Double_t delta = reference[iT] - unfolded[iT];
+      sum [iT] += delta;
+      sum2[iT] += delta*delta;
+    }
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfoldingEngine::WriteTrue(THnSparse* h, const std::vector<Double_t> &values, const std::vector<Double_t> *errors) const {
+  //
+  // copies a true-space array into h (non-zero bins only)
+  //
+  for (Int_t iT=0; iT<fNTrue; iT++) {
+    Double_t err = errors ? (*errors)[iT] : 0.;
+    if (values[iT]==0. && err==0.) continue;
+    const Int_t* coord = &fTrueCoord[iT*fNVariables];
+    h->SetBinContent(coord,values[iT]);
+    h->SetBinError  (coord,err);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfoldingEngine::WriteMeasured(THnSparse* h, const std::vector<Double_t> &values) const {
+  //
+  // copies a measured-space array into h (non-zero bins only)
+  //
+  for (Int_t iM=0; iM<fNMeas; iM++) {
+    if (values[iM]==0.) continue;
+    const Int_t* coord = &fMeasCoord[iM*fNVariables];
+    h->SetBinContent(coord,values[iM]);
+    h->SetBinError  (coord,0.);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfoldingEngine::WriteMatrix(THnSparse* h, const std::vector<Double_t> &values) const {
+  //
+  // copies a CSR-ordered array into the 2N-dimensional h
+  //
+  std::vector<Int_t> coord2N(2*fNVariables);
+  for (Int_t iM=0; iM<fNMeas; iM++) {
+    std::copy(&fMeasCoord[iM*fNVariables],&fMeasCoord[iM*fNVariables]+fNVariables,coord2N.begin());
+    for (Int_t k=fRowPtr[iM]; k<fRowPtr[iM+1]; k++) {
+      std::copy(&fTrueCoord[fCol[k]*fNVariables],&fTrueCoord[fCol[k]*fNVariables]+fNVariables,coord2N.begin()+fNVariables);
+      // do not allocate empty cells, unless the cell is already there
+      if (values[k]==0. && h->GetBin(coord2N.data(),kFALSE)<0) continue;
+      h->SetBinContent(coord2N.data(),values[k]);
+      h->SetBinError  (coord2N.data(),0.);
+    }
+  }
+}
@@ -0,0 +1,83 @@
+#ifndef ALICFUNFOLDINGENGINE_H
+#define ALICFUNFOLDINGENGINE_H
+
+//--------------------------------------------------------------------//
+//                                                                    //
+// AliCFUnfoldingEngine Class                                         //
+// Dense-array backend for the bayesian unfolding of AliCFUnfolding   //
+//                                                                    //
+// The THnSparse inputs are converted once into compact arrays :      //
+// the conditional matrix P(M|T) is stored in CSR format (one row per //
+// measured bin, columns are true bins), the efficiency, measured and //
+// prior spectra are stored as flat vectors. Iterations then are      //
+// sparse matrix-vector products, and the error toys are distributed  //
+// over threads, each toy with its own random stream.                 //
+//                                                                    //
+//--------------------------------------------------------------------//
+
+#include <vector>
+#include "Rtypes.h"
+
+class THnSparse;
+
+class AliCFUnfoldingEngine {
+
+ public :
+
+  AliCFUnfoldingEngine();
+  ~AliCFUnfoldingEngine() {}
+
+  Bool_t Build(Int_t nVar, const THnSparse* conditional, const THnSparse* efficiency,
+               const THnSparse* measured, const THnSparse* prior, const THnSparse* priorOrig);
+
+  Int_t  GetNTrueBins()     const {return fNTrue;}
+  Int_t  GetNMeasuredBins() const {return fNMeas;}
+
+  // Runs at most maxIter bayes iterations starting from "prior" (updated in place).
+  // Returns the iteration at which the convergence criterion was met, -1 otherwise.
+  // If "inverse" is given, it is filled with the inverse response P(T|M) of the last iteration (one value per CSR entry).
+  Int_t  Iterate(std::vector<Double_t> &prior, const std::vector<Double_t> &eff, const std::vector<Double_t> &meas,
+                 Int_t maxIter, Double_t maxConvergence, std::vector<Double_t> &unfolded,
+                 std::vector<Double_t> &estMeasured, Double_t &convergence, std::vector<Double_t> *inverse=0x0) const;
+
+  // Unfolds nToys randomised (efficiency,measured) pairs and accumulates the delta
+  // to the reference spectrum in sum/sum2 for each true bin where reference>0
+  void   RunToys(Int_t nToys, Int_t maxIter, const std::vector<Double_t> &reference, UInt_t baseSeed, Int_t nThreads,
+                 std::vector<Double_t> &sum, std::vector<Double_t> &sum2) const;
+
+  const std::vector<Double_t>& GetEfficiency()    const {return fEff;}
+  const std::vector<Double_t>& GetMeasured()      const {return fMeas;}
+  const std::vector<Double_t>& GetPrior()         const {return fPrior;}
+  const std::vector<Int_t>&    GetRowOffsets()    const {return fRowPtr;}
+  const std::vector<Int_t>&    GetColumns()       const {return fCol;}
+
+  void   WriteTrue    (THnSparse* h, const std::vector<Double_t> &values, const std::vector<Double_t> *errors=0x0) const;
+  void   WriteMeasured(THnSparse* h, const std::vector<Double_t> &values) const;
+  void   WriteMatrix  (THnSparse* h, const std::vector<Double_t> &values) const;
+
+ private :
+  AliCFUnfoldingEngine(const AliCFUnfoldingEngine& c);
+  AliCFUnfoldingEngine& operator= (const AliCFUnfoldingEngine& c);
+
+  void   RunToyRange(Int_t first, Int_t step, Int_t nToys, Int_t maxIter, const std::vector<Double_t> &reference,
+                     const std::vector<UInt_t> &seeds, std::vector<Double_t> &sum, std::vector<Double_t> &sum2) const;
+
+  Int_t                 fNVariables; // Number of variables
+  Int_t                 fNTrue;      // Number of compact true bins
+  Int_t                 fNMeas;      // Number of compact measured bins
+  std::vector<Int_t>    fTrueCoord;  // Coordinates of each true bin     (fNTrue x fNVariables)
+  std::vector<Int_t>    fMeasCoord;  // Coordinates of each measured bin (fNMeas x fNVariables)
+  std::vector<Int_t>    fRowPtr;     // CSR row offsets of the conditional matrix (fNMeas+1)
+  std::vector<Int_t>    fCol;        // CSR true-bin index of each entry
+  std::vector<Double_t> fCond;       // CSR value P(M|T) of each entry
+  std::vector<Double_t> fEff;        // Efficiency
+  std::vector<Double_t> fEffErr;     // Efficiency error   (used as sigma for the toys)
+  std::vector<Bool_t>   fEffFilled;  // Efficiency bin exists in the original map
+  std::vector<Double_t> fMeas;       // Measured spectrum
+  std::vector<Double_t> fMeasErr;    // Measured error     (used as sigma for the toys)
+  std::vector<Bool_t>   fMeasFilled; // Measured bin exists in the original spectrum
+  std::vector<Double_t> fPrior;      // Prior used to start the nominal unfolding
+  std::vector<Double_t> fPriorOrig;  // Original prior, used to start each toy
+};
+
+#endif
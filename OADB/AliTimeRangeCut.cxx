@@ -75,6 +75,8 @@ void AliTimeRangeCut::InitFromRunNumber(const Int_t run)
 
   fTimeRangeMasking = (AliTimeRangeMasking<ULong64_t, UShort_t>*)cont.GetObject(run, "", passName);
 
+  // sort the ranges once here rather than in the first event
+  if (fTimeRangeMasking) fTimeRangeMasking->BuildIndex();
 }
 
 //______________________________________________________________________________
@@ -13,7 +13,9 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 #include "AliLog.h"
 
@@ -88,7 +90,13 @@ templateClassImp(AliTimeRangeMasking)
 template<typename time_type, typename bitmap_type>
 AliTimeRangeMasking<time_type, bitmap_type>::AliTimeRangeMasking()
   : TObject(),
-    fArrTimeRanges("AliTimeRangeMask<ULong64_t, UShort_t>", 10)
+    fArrTimeRanges("AliTimeRangeMask<ULong64_t, UShort_t>", 10),
+    fIndexStart(),
+    fIndexEnd(),
+    fIndexRange(),
+    fIndexCursor(-1),
+    fIndexBuilt(kFALSE),
+    fIndexOverlapping(kFALSE)
 {
 }
 
@@ -96,31 +104,176 @@ AliTimeRangeMasking<time_type, bitmap_type>::AliTimeRangeMasking()
 template<typename time_type, typename bitmap_type>
 AliTimeRangeMask<time_type, bitmap_type>* AliTimeRangeMasking<time_type, bitmap_type>::AddTimeRangeMask(time_type start, time_type end, bitmap_type reasons)
 {
-  if ( const auto* range = FindTimeRangeMask(start))  {
-    const std::string reasonsString = range->CollectMaskReasonNames();
-    AliErrorF("Start time %llu already in range [%llu, %llu]: %s", 
-        start, range->GetStart(), range->GetEnd(), reasonsString.data());
-    return nullptr;
+  if (IsOverlapping(start, end)) return nullptr;
+
+  // keep the index sorted instead of rebuilding it
+  const Int_t rangePosition = fArrTimeRanges.GetEntriesFast();
+  const Int_t indexPosition = FindIndexPosition(start) + 1;
+  fIndexStart.insert(fIndexStart.begin() + indexPosition, start);
+  fIndexEnd.insert(fIndexEnd.begin() + indexPosition, end);
+  fIndexRange.insert(fIndexRange.begin() + indexPosition, rangePosition);
+  fIndexCursor = -1;
+
+  return new(fArrTimeRanges[rangePosition]) AliTimeRangeMask<time_type, bitmap_type>(start, end, reasons);
+}
+
+template<typename time_type, typename bitmap_type>
+Int_t AliTimeRangeMasking<time_type, bitmap_type>::AddTimeRangeMasks(const std::vector<time_type>& starts, const std::vector<time_type>& ends, const std::vector<bitmap_type>& reasons)
+{
+  const size_t nRanges = starts.size();
+  if (ends.size() != nRanges || reasons.size() != nRanges) {
+    AliErrorF("Inconsistent number of start times (%zu), end times (%zu) and reasons (%zu)",
+        nRanges, ends.size(), reasons.size());
+    return 0;
   }
 
-  if ( const auto* range = FindTimeRangeMask(end))  {
-    const std::string reasonsString= range->CollectMaskReasonNames();
-    AliErrorF("End time %llu already in range [%llu, %llu]: %s", 
-        end, range->GetStart(), range->GetEnd(), reasonsString.data());
-    return nullptr;
+  std::vector<size_t> order(nRanges);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&starts](size_t a, size_t b) { return starts[a] < starts[b]; });
+
+  // check against the existing ranges with the index, and against the previous
+  // accepted new range, which is the only new one that can overlap once sorted
+  std::vector<size_t> accepted;
+  accepted.reserve(nRanges);
+  for (const auto iRange : order) {
+    const time_type start = starts[iRange];
+    const time_type end = ends[iRange];
+    if (IsOverlapping(start, end)) continue;
+    if (!accepted.empty() && ends[accepted.back()] >= start) {
+      AliErrorF("Range [%llu, %llu] overlaps with range [%llu, %llu] of the same set",
+          start, end, starts[accepted.back()], ends[accepted.back()]);
+      continue;
+    }
+    accepted.push_back(iRange);
+  }
+
+  for (const auto iRange : accepted) {
+    new(fArrTimeRanges[fArrTimeRanges.GetEntriesFast()]) AliTimeRangeMask<time_type, bitmap_type>(starts[iRange], ends[iRange], reasons[iRange]);
   }
+  BuildIndex();
 
-  return new(fArrTimeRanges[fArrTimeRanges.GetEntriesFast()]) AliTimeRangeMask<time_type, bitmap_type>(start, end, reasons);
+  return accepted.size();
 }
 
 template<typename time_type, typename bitmap_type>
 AliTimeRangeMask<time_type, bitmap_type>* AliTimeRangeMasking<time_type, bitmap_type>::FindTimeRangeMask(time_type time) const
 {
-  for (auto o : fArrTimeRanges) {
-    auto const val = (AliTimeRangeMask<time_type, bitmap_type>*)o;
-    if ( *val == time ) return val;
+  if (!fIndexBuilt) BuildIndex();
+
+  // with overlapping ranges, return the first one in the array as the linear scan always did
+  if (fIndexOverlapping) {
+    for (auto o : fArrTimeRanges) {
+      auto const val = (AliTimeRangeMask<time_type, bitmap_type>*)o;
+      if ( *val == time ) return val;
+    }
+    return nullptr;
+  }
+
+  const Int_t nRanges = fIndexStart.size();
+  if (!nRanges) return nullptr;
+
+  // the cursor points to the last range starting before the previous time,
+  // which is very often also the one for this time, or the next one
+  Int_t pos = fIndexCursor;
+  if (pos >= 0 && fIndexStart[pos] <= time) {
+    if (pos + 1 < nRanges && fIndexStart[pos + 1] <= time) {
+      ++pos;
+      if (pos + 1 < nRanges && fIndexStart[pos + 1] <= time) {
+        pos = FindIndexPosition(time);
+      }
+    }
+  }
+  else {
+    pos = FindIndexPosition(time);
+  }
+
+  if (pos < 0) return nullptr;
+  fIndexCursor = pos;
+
+  if (time > fIndexEnd[pos]) return nullptr;
+  return (AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(fIndexRange[pos]);
+}
+
+template<typename time_type, typename bitmap_type>
+void AliTimeRangeMasking<time_type, bitmap_type>::BuildIndex() const
+{
+  const Int_t nRanges = fArrTimeRanges.GetEntriesFast();
+
+  std::vector<Int_t> order(nRanges);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [this](Int_t a, Int_t b) {
+      return ((AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(a))->GetStart() <
+             ((AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(b))->GetStart(); });
+
+  fIndexStart.resize(nRanges);
+  fIndexEnd.resize(nRanges);
+  fIndexRange = order;
+  fIndexOverlapping = kFALSE;
+  for (Int_t iPos = 0; iPos < nRanges; ++iPos) {
+    const auto range = (AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(order[iPos]);
+    fIndexStart[iPos] = range->GetStart();
+    fIndexEnd[iPos] = range->GetEnd();
+    if (iPos > 0 && fIndexEnd[iPos - 1] >= fIndexStart[iPos] && !fIndexOverlapping) {
+      AliWarningF("Range [%llu, %llu] overlaps with range [%llu, %llu], using a linear scan for the lookups",
+          fIndexStart[iPos], fIndexEnd[iPos], fIndexStart[iPos - 1], fIndexEnd[iPos - 1]);
+      fIndexOverlapping = kTRUE;
+    }
+  }
+
+  fIndexCursor = -1;
+  fIndexBuilt = kTRUE;
+}
+
+template<typename time_type, typename bitmap_type>
+Int_t AliTimeRangeMasking<time_type, bitmap_type>::FindIndexPosition(time_type time) const
+{
+  // position in the index of the last range starting at or before time, -1 if none
+  if (!fIndexBuilt) BuildIndex();
+  return Int_t(std::upper_bound(fIndexStart.begin(), fIndexStart.end(), time) - fIndexStart.begin()) - 1;
+}
+
+template<typename time_type, typename bitmap_type>
+Bool_t AliTimeRangeMasking<time_type, bitmap_type>::IsOverlapping(time_type start, time_type end) const
+{
+  if (end < start) {
+    AliErrorF("End time %llu before start time %llu", end, start);
+    return kTRUE;
+  }
+
+  // with overlapping ranges, only check start and end as the linear scan did
+  if (!fIndexBuilt) BuildIndex();
+  if (fIndexOverlapping) {
+    const time_type times[2] = {start, end};
+    for (Int_t iTime = 0; iTime < 2; ++iTime) {
+      if (const auto* range = FindTimeRangeMask(times[iTime])) {
+        const std::string reasonsString = range->CollectMaskReasonNames();
+        AliErrorF("%s time %llu already in range [%llu, %llu]: %s", iTime ? "End" : "Start",
+            times[iTime], range->GetStart(), range->GetEnd(), reasonsString.data());
+        return kTRUE;
+      }
+    }
+    return kFALSE;
+  }
+
+  // ranges don't overlap, so the only candidate is the last one starting before end
+  const Int_t pos = FindIndexPosition(end);
+  if (pos < 0 || fIndexEnd[pos] < start) return kFALSE;
+
+  const auto range = (const AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(fIndexRange[pos]);
+  const std::string reasonsString = range->CollectMaskReasonNames();
+  if (*range == start) {
+    AliErrorF("Start time %llu already in range [%llu, %llu]: %s",
+        start, range->GetStart(), range->GetEnd(), reasonsString.data());
+  }
+  else if (*range == end) {
+    AliErrorF("End time %llu already in range [%llu, %llu]: %s",
+        end, range->GetStart(), range->GetEnd(), reasonsString.data());
+  }
+  else {
+    AliErrorF("Range [%llu, %llu] contains range [%llu, %llu]: %s",
+        start, end, range->GetStart(), range->GetEnd(), reasonsString.data());
   }
-  return nullptr;
+  return kTRUE;
 }
 
 template<typename time_type, typename bitmap_type>
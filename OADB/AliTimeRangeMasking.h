@@ -72,6 +72,13 @@ class AliTimeRangeMask : public TObject {
 
 /// \class AliTimeRangeMasking
 /// A Class for keeping several time ranges with mask of type AliTimeRangeMask
+///
+/// The ranges must not overlap. Lookups go through a transient index of the
+/// ranges sorted by start time, built on first use (e.g. after reading the
+/// object from the OADB). As the event times come almost ordered, the lookup
+/// first tries the range found in the previous call and the one after it,
+/// and only falls back to a binary search otherwise. Older objects with
+/// overlapping ranges are looked up with a linear scan, as before the index.
 template<typename time_type, typename bitmap_type>
 class AliTimeRangeMasking : public TObject {
   public:
@@ -79,14 +86,31 @@ class AliTimeRangeMasking : public TObject {
 
     AliTimeRangeMask<time_type, bitmap_type>* AddTimeRangeMask(time_type start, time_type end, bitmap_type reasons = {});
 
+    /// add many ranges at once, e.g. when setting up the OADB object
+    ///
+    /// the ranges are sorted and checked for overlaps in one go, the index is rebuilt once at the end
+    /// \return number of ranges which were added
+    Int_t AddTimeRangeMasks(const std::vector<time_type>& starts, const std::vector<time_type>& ends, const std::vector<bitmap_type>& reasons);
 
     AliTimeRangeMask<time_type, bitmap_type>* FindTimeRangeMask(time_type time) const;
 
     virtual void Print(Option_t* option = "") const;
 
+    void BuildIndex() const;
+
   private:
+    Int_t FindIndexPosition(time_type time) const;
+    Bool_t IsOverlapping(time_type start, time_type end) const;
+
     TClonesArray fArrTimeRanges;
 
+    mutable std::vector<time_type> fIndexStart; //!<! start times of the ranges, sorted
+    mutable std::vector<time_type> fIndexEnd;   //!<! end times of the ranges, same order as fIndexStart
+    mutable std::vector<Int_t> fIndexRange;     //!<! position of the ranges in fArrTimeRanges
+    mutable Int_t fIndexCursor;                 //!<! index position found by the last lookup
+    mutable Bool_t fIndexBuilt;                 //!<! index in sync with fArrTimeRanges
+    mutable Bool_t fIndexOverlapping;           //!<! some ranges overlap, the index is not used for lookups
+
     ClassDef(AliTimeRangeMasking, 1);
 };
 
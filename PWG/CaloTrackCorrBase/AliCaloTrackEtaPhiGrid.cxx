@@ -0,0 +1,215 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <algorithm>
+
+// --- ROOT system ---
+#include <TMath.h>
+
+// --- CaloTrackCorrelations ---
+#include "AliCaloTrackEtaPhiGrid.h"
+
+//____________________________________________________________________
+/// Default constructor. Cells of 0.1 in eta within |eta| < 1
+/// and of about 0.1 rad in phi, smaller than the usual cone sizes.
+//____________________________________________________________________
+AliCaloTrackEtaPhiGrid::AliCaloTrackEtaPhiGrid() :
+fNEta(0),     fNPhi(0),      fEtaMin(0),
+fInvEtaWidth(0), fInvPhiWidth(0), fBuilt(kFALSE),
+fPt(),        fEta(),        fPhi(),
+fID(),        fHasID(),      fEntry(),
+fE(),         fModule(),     fLabel(),
+fCharge(),    fBits(),
+fCell(),      fCellStart(),  fCellRecords(),
+fPtRecords()
+{
+  SetBinning(20, -1., 1., 64);
+}
+
+//_______________________________________________________________________________________
+/// Set the binning of the grid, nPhi bins cover [0, 2pi[.
+//_______________________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SetBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi)
+{
+  fNEta        = nEta > 0 ? nEta : 1;
+  fNPhi        = nPhi > 0 ? nPhi : 1;
+  fEtaMin      = etaMin;
+  fInvEtaWidth = etaMax > etaMin ? fNEta / (etaMax - etaMin) : 0;
+  fInvPhiWidth = fNPhi / TMath::TwoPi();
+  fBuilt       = kFALSE;
+}
+
+//____________________________________________________________________
+/// \return eta bin, clamped to the grid.
+//____________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::EtaBin(Double_t eta) const
+{
+  Double_t x = (eta - fEtaMin) * fInvEtaWidth;
+  if ( x <  0     ) return 0;
+  if ( x >= fNEta ) return fNEta - 1;
+  return Int_t(x);
+}
+
+//____________________________________________________________________
+/// \return phi bin, clamped to the grid.
+//____________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::PhiBin(Double_t phi) const
+{
+  Double_t x = phi * fInvPhiWidth;
+  if ( x <  0     ) return 0;
+  if ( x >= fNPhi ) return fNPhi - 1;
+  return Int_t(x);
+}
+
+//____________________________________________________________________
+/// Remove the records, keeping the storage.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Reset()
+{
+  fPt   .clear();
+  fEta  .clear();
+  fPhi  .clear();
+  fID   .clear();
+  fHasID.clear();
+  fEntry.clear();
+  fE    .clear();
+  fModule.clear();
+  fLabel.clear();
+  fCharge.clear();
+  fBits .clear();
+  fCell .clear();
+  fBuilt = kFALSE;
+}
+
+//______________________________________________________________________________________________________
+/// Add the entry of the list, with its kinematics and, if hasID, the ID of the track or cluster.
+//______________________________________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Add(Int_t entry, Float_t pt, Float_t eta, Float_t phi, Int_t id, Bool_t hasID,
+                                 Float_t e, Int_t module, Int_t label, Int_t charge, UInt_t bits)
+{
+  fPt   .push_back(pt);
+  fEta  .push_back(eta);
+  fPhi  .push_back(phi);
+  fID   .push_back(id);
+  fHasID.push_back(hasID);
+  fEntry.push_back(entry);
+  fE    .push_back(e);
+  fModule.push_back(module);
+  fLabel.push_back(label);
+  fCharge.push_back(charge);
+  fBits .push_back(bits);
+  fCell .push_back(EtaBin(eta)*fNPhi + PhiBin(phi));
+}
+
+//____________________________________________________________________
+/// Sort the records by cell, counting sort keeping the list order
+/// inside each cell, and by pT.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Build()
+{
+  const Int_t nCells   = fNEta*fNPhi;
+  const Int_t nRecords = fCell.size();
+
+  fCellStart.assign(nCells+1, 0);
+  for(Int_t irec = 0; irec < nRecords; irec++) fCellStart[fCell[irec]+1]++;
+  for(Int_t icell = 0; icell < nCells; icell++) fCellStart[icell+1] += fCellStart[icell];
+
+  fCellRecords.resize(nRecords);
+  std::vector<Int_t> next(fCellStart.begin(), fCellStart.end()-1);
+  for(Int_t irec = 0; irec < nRecords; irec++) fCellRecords[next[fCell[irec]]++] = irec;
+
+  fPtRecords.resize(nRecords);
+  for(Int_t irec = 0; irec < nRecords; irec++) fPtRecords[irec] = irec;
+  std::stable_sort(fPtRecords.begin(), fPtRecords.end(), PtLess(fPt));
+
+  fBuilt = kTRUE;
+}
+
+//____________________________________________________________________
+/// Append all the records.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SelectAll(std::vector<Int_t> & records) const
+{
+  for(Int_t irec = 0; irec < GetNRecords(); irec++) records.push_back(irec);
+}
+
+//____________________________________________________________________
+/// Append the records of the cells of the given bin ranges.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SelectCells(Int_t ieta0, Int_t ieta1, Int_t iphi0, Int_t iphi1,
+                                         std::vector<Int_t> & records) const
+{
+  for(Int_t ieta = ieta0; ieta <= ieta1; ieta++)
+  {
+    // cells of consecutive phi bins are contiguous in fCellRecords
+    const Int_t first = fCellStart[ieta*fNPhi + iphi0  ];
+    const Int_t last  = fCellStart[ieta*fNPhi + iphi1+1];
+    records.insert(records.end(), fCellRecords.begin()+first, fCellRecords.begin()+last);
+  }
+}
+
+//_______________________________________________________________________________________________
+/// Append the records of all the cells overlapping the eta-phi box. Phi limits out
+/// of [0, 2pi[ wrap around. The records are appended cell by cell, so they must be
+/// sorted by the caller to recover the list order, and in case of boxes wider than
+/// the grid or of several calls, repeated records removed.
+//_______________________________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SelectBox(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax,
+                                       std::vector<Int_t> & records) const
+{
+  if ( !fBuilt || etaMax < etaMin || phiMax < phiMin ) return;
+
+  const Int_t ieta0 = EtaBin(etaMin);
+  const Int_t ieta1 = EtaBin(etaMax);
+
+  Double_t phi0 = phiMin;
+  Double_t phi1 = phiMax;
+
+  if ( phi1 - phi0 >= TMath::TwoPi() )
+  {
+    SelectCells(ieta0, ieta1, 0, fNPhi-1, records);
+    return;
+  }
+
+  // Bring the lower limit to [0, 2pi[
+  while ( phi0 <  0               ) { phi0 += TMath::TwoPi(); phi1 += TMath::TwoPi(); }
+  while ( phi0 >= TMath::TwoPi()  ) { phi0 -= TMath::TwoPi(); phi1 -= TMath::TwoPi(); }
+
+  if ( phi1 < TMath::TwoPi() )
+  {
+    SelectCells(ieta0, ieta1, PhiBin(phi0), PhiBin(phi1), records);
+  }
+  else
+  {
+    SelectCells(ieta0, ieta1, PhiBin(phi0), fNPhi-1, records);
+    SelectCells(ieta0, ieta1, 0, PhiBin(phi1 - TMath::TwoPi()), records);
+  }
+}
+
+//_______________________________________________________________________________________________
+/// Append the records with ptMin <= pT <= ptMax, by increasing pT. They must be sorted
+/// by the caller to recover the list order.
+//_______________________________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SelectPtRange(Float_t ptMin, Float_t ptMax, std::vector<Int_t> & records) const
+{
+  if ( !fBuilt || ptMax < ptMin ) return;
+
+  std::vector<Int_t>::const_iterator first =
+    std::lower_bound(fPtRecords.begin(), fPtRecords.end(), ptMin, PtLess(fPt));
+  std::vector<Int_t>::const_iterator last  =
+    std::upper_bound(first, fPtRecords.end(), ptMax, PtLess(fPt));
+
+  records.insert(records.end(), first, last);
+}
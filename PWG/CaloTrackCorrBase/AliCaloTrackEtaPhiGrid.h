@@ -0,0 +1,117 @@
+#ifndef ALICALOTRACKETAPHIGRID_H
+#define ALICALOTRACKETAPHIGRID_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackEtaPhiGrid
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Eta-phi and pT indexed view of the tracks or clusters of one reader list.
+///
+/// Filled once per event by AliCaloTrackReader with the kinematics of the
+/// entries of one of its lists (CTS, EMCAL or PHOS), plus their module, MC
+/// label, charge and TOF bits, so that the analyses of the maker do not each
+/// recompute them from the tracks and clusters. The isolation cone and UE band
+/// sums of AliIsolationCut visit only the cells overlapping the regions of
+/// each candidate, and the hadron correlation loop only the records in its
+/// associated pT range, instead of the whole list.
+///
+/// Records are kept in the order of the list, each cell holding the indices
+/// of its records in increasing order. Once sorted, the records selected in
+/// several cells are then visited in the same order as the list.
+/// Phi is expected in [0, 2pi[, entries outside the eta range go to the
+/// first or last eta bin.
+//_________________________________________________________________________
+
+#include <vector>
+#include <Rtypes.h>
+
+class AliCaloTrackEtaPhiGrid {
+
+ public:
+
+  /// Bits of the records, only set for tracks
+  enum recordBits { kTOFOut = BIT(0), ///< kTOFout status bit set
+                    kTOFBC0 = BIT(1)  ///< TOF bunch crossing is 0, for kTOFOut tracks
+  } ;
+
+  AliCaloTrackEtaPhiGrid() ;
+  virtual ~AliCaloTrackEtaPhiGrid() { ; }
+
+  void     SetBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi) ;
+
+  /// Remove the records, keeping the storage, and mark the grid as not built.
+  void     Reset() ;
+  void     Add(Int_t entry, Float_t pt, Float_t eta, Float_t phi, Int_t id, Bool_t hasID,
+               Float_t e = 0, Int_t module = -1, Int_t label = -1, Int_t charge = 0, UInt_t bits = 0) ;
+  void     Build() ;
+
+  Bool_t   IsBuilt()                 const { return fBuilt               ; }
+  void     Invalidate()                    { fBuilt = kFALSE             ; }
+
+  Int_t    GetNRecords()             const { return fPt.size()           ; }
+  Int_t    GetEntry(Int_t irec)      const { return fEntry[irec]         ; }
+  Float_t  GetPt  (Int_t irec)       const { return fPt   [irec]         ; }
+  Float_t  GetEta (Int_t irec)       const { return fEta  [irec]         ; }
+  Float_t  GetPhi (Int_t irec)       const { return fPhi  [irec]         ; }
+  Int_t    GetID  (Int_t irec)       const { return fID   [irec]         ; }
+  Bool_t   HasID  (Int_t irec)       const { return fHasID[irec]         ; }
+  Float_t  GetE   (Int_t irec)       const { return fE    [irec]         ; }
+  Int_t    GetModule(Int_t irec)     const { return fModule[irec]        ; }
+  Int_t    GetLabel (Int_t irec)     const { return fLabel [irec]        ; }
+  Int_t    GetCharge(Int_t irec)     const { return fCharge[irec]        ; }
+  Bool_t   TestBits (Int_t irec, UInt_t bits) const { return (fBits[irec] & bits) == bits ; }
+
+  void     SelectAll(std::vector<Int_t> & records) const ;
+  void     SelectBox(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax,
+                     std::vector<Int_t> & records) const ;
+  void     SelectPtRange(Float_t ptMin, Float_t ptMax, std::vector<Int_t> & records) const ;
+
+ private:
+
+  /// Order of the records by pT, also comparing a record with a pT value
+  struct PtLess {
+    const std::vector<Float_t> & fPtRef;
+    PtLess(const std::vector<Float_t> & pt) : fPtRef(pt) { }
+    bool operator()(Int_t   irec1, Int_t   irec2) const { return fPtRef[irec1] < fPtRef[irec2] ; }
+    bool operator()(Int_t   irec,  Float_t pt   ) const { return fPtRef[irec ] < pt            ; }
+    bool operator()(Float_t pt,    Int_t   irec ) const { return pt            < fPtRef[irec ] ; }
+  };
+
+  Int_t    EtaBin(Double_t eta) const ;
+  Int_t    PhiBin(Double_t phi) const ;
+  void     SelectCells(Int_t ieta0, Int_t ieta1, Int_t iphi0, Int_t iphi1,
+                       std::vector<Int_t> & records) const ;
+
+  Int_t    fNEta;                        ///< Number of eta bins
+  Int_t    fNPhi;                        ///< Number of phi bins, in [0, 2pi[
+  Float_t  fEtaMin;                      ///< Lower edge of the first eta bin
+  Double_t fInvEtaWidth;                 ///< Inverse of the eta bin width
+  Double_t fInvPhiWidth;                 ///< Inverse of the phi bin width
+  Bool_t   fBuilt;                       ///< Cells filled since last Reset()
+
+  std::vector<Float_t> fPt;              ///< Transverse momentum of each record
+  std::vector<Float_t> fEta;             ///< Pseudorapidity of each record
+  std::vector<Float_t> fPhi;             ///< Azimuthal angle of each record, in [0, 2pi[
+  std::vector<Int_t>   fID;              ///< Track or cluster ID, see fHasID
+  std::vector<Bool_t>  fHasID;           ///< Entry is an AliVTrack or AliVCluster, fID is valid
+  std::vector<Int_t>   fEntry;           ///< Position of the record in the reader list
+  std::vector<Float_t> fE;               ///< Energy of each record
+  std::vector<Short_t> fModule;          ///< Calorimeter (super) module of clusters, -1 for tracks
+  std::vector<Int_t>   fLabel;           ///< MC label of each record
+  std::vector<Char_t>  fCharge;          ///< Charge of the tracks, 0 for clusters
+  std::vector<UInt_t>  fBits;            ///< See recordBits
+  std::vector<Int_t>   fCell;            ///< Cell of each record
+  std::vector<Int_t>   fCellStart;       ///< [nCells+1] first position of each cell in fCellRecords
+  std::vector<Int_t>   fCellRecords;     ///< Records sorted by cell
+  std::vector<Int_t>   fPtRecords;       ///< Records sorted by increasing pT, in list order for equal pT
+
+  /// Copy constructor not implemented.
+  AliCaloTrackEtaPhiGrid(              const AliCaloTrackEtaPhiGrid & g) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackEtaPhiGrid & operator = (const AliCaloTrackEtaPhiGrid & g) ;
+
+} ;
+
+#endif //ALICALOTRACKETAPHIGRID_H
@@ -47,6 +47,8 @@
 // ---- CaloTrackCorr ---
 #include "AliCalorimeterUtils.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
+#include "AliCaloTrackParticle.h"
 #include "AliMCAnalysisUtils.h"
 
 // ---- Jets ----
@@ -168,7 +170,9 @@ fInputBackgroundJetBranchName("jets"),
 fAcceptEventsWithBit(0),     fRejectEventsWithBit(0),         
 fRejectEMCalTriggerEventsL1HighWithL1Low(0),
 fRemoveCentralityTriggerOutliers(0),
-fMomentum(),                 fParRun(kFALSE),                 fCurrentParIndex(0),
+fMomentum(),                 fCTSTracksGrid(0x0),             fEMCALClustersGrid(0x0),
+fPHOSClustersGrid(0x0),
+fParRun(kFALSE),             fCurrentParIndex(0),
 fOutputContainer(0x0),       fhEMCALClusterEtaPhi(0),         fhEMCALClusterEtaPhiFidCut(0),     
 fhEMCALClusterDisToBadE(0),  fhEMCALClusterTimeE(0),      
 fhEMCALClusterBadTrigger(0), fhCentralityBadTrigger(0),       fhEMCALClusterCentralityBadTrigger(0),
@@ -240,6 +244,10 @@ void AliCaloTrackReader::DeletePointers()
     delete fPHOSClusters ;
   }
   
+  delete fCTSTracksGrid ;
+  delete fEMCALClustersGrid ;
+  delete fPHOSClustersGrid ;
+  
   if(fVertex)
   {
     for (Int_t i = 0; i < fNMixedEvent; i++)
@@ -1777,6 +1785,11 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
 {  
   fEventNumber         = iEntry;
   fTriggerClusterIndex = -1;
+  
+  // Eta-phi indices of the previous event
+  if(fCTSTracksGrid)     fCTSTracksGrid     -> Invalidate();
+  if(fEMCALClustersGrid) fEMCALClustersGrid -> Invalidate();
+  if(fPHOSClustersGrid)  fPHOSClustersGrid  -> Invalidate();
   fTriggerClusterId    = -1;
   fIsTriggerMatch      = kFALSE;
   fTriggerClusterBC    = -10000;
@@ -4276,6 +4289,10 @@ void AliCaloTrackReader::ResetLists()
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
   
+  if(fCTSTracksGrid)     fCTSTracksGrid     -> Invalidate();
+  if(fEMCALClustersGrid) fEMCALClustersGrid -> Invalidate();
+  if(fPHOSClustersGrid)  fPHOSClustersGrid  -> Invalidate();
+  
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
   
@@ -4284,6 +4301,141 @@ void AliCaloTrackReader::ResetLists()
   //fBackgroundJets->Reset();
 }
 
+//___________________________________________________________________
+/// \return Eta-phi index of the selected tracks, with their kinematics
+/// and track ID as used in the isolation cone loops, MC label, charge
+/// and TOF bits. Built the first time it is requested in the event.
+//___________________________________________________________________
+const AliCaloTrackEtaPhiGrid * AliCaloTrackReader::GetCTSTracksEtaPhiGrid()
+{
+  if ( !fCTSTracks ) return 0x0;
+  
+  if ( !fCTSTracksGrid ) fCTSTracksGrid = new AliCaloTrackEtaPhiGrid();
+  
+  if ( fCTSTracksGrid->IsBuilt() ) return fCTSTracksGrid;
+  
+  fCTSTracksGrid->Reset();
+  
+  Double_t bz = GetInputEvent()->GetMagneticField();
+  
+  TVector3 mom;
+  for(Int_t itrack = 0; itrack < fCTSTracks->GetEntries(); itrack++)
+  {
+    TObject * obj = fCTSTracks->At(itrack);
+    
+    AliVTrack * track = dynamic_cast<AliVTrack*>(obj);
+    if ( track )
+    {
+      mom.SetXYZ(track->Px(),track->Py(),track->Pz());
+      Float_t phi = mom.Phi();
+      if ( phi < 0 ) phi+=TMath::TwoPi();
+      
+      UInt_t bits = 0;
+      if ( (track->GetStatus() & AliVTrack::kTOFout) == AliVTrack::kTOFout )
+      {
+        bits |= AliCaloTrackEtaPhiGrid::kTOFOut;
+        if ( track->GetTOFBunchCrossing(bz) == 0 ) bits |= AliCaloTrackEtaPhiGrid::kTOFBC0;
+      }
+      
+      fCTSTracksGrid->Add(itrack, mom.Pt(), mom.Eta(), phi, GetTrackID(track), kTRUE,
+                          track->E(), -1, track->GetLabel(), track->Charge(), bits);
+      continue;
+    }
+    
+    // Mixed event stored in AliCaloTrackParticles
+    AliCaloTrackParticle * trackmix = dynamic_cast<AliCaloTrackParticle*>(obj);
+    if ( !trackmix )
+    {
+      AliWarning("Wrong track data type, continue");
+      continue;
+    }
+    
+    Float_t phi = trackmix->Phi();
+    if ( phi < 0 ) phi+=TMath::TwoPi();
+    fCTSTracksGrid->Add(itrack, trackmix->Pt(), trackmix->Eta(), phi, -1, kFALSE,
+                        trackmix->E(), -1, trackmix->GetLabel());
+  }
+  
+  fCTSTracksGrid->Build();
+  
+  return fCTSTracksGrid;
+}
+
+//___________________________________________________________________
+/// \return Eta-phi index of the selected EMCal clusters, see FillClustersEtaPhiGrid().
+//___________________________________________________________________
+const AliCaloTrackEtaPhiGrid * AliCaloTrackReader::GetEMCALClustersEtaPhiGrid()
+{
+  if ( !fEMCALClusters ) return 0x0;
+  
+  if ( !fEMCALClustersGrid ) fEMCALClustersGrid = new AliCaloTrackEtaPhiGrid();
+  
+  if ( !fEMCALClustersGrid->IsBuilt() ) FillClustersEtaPhiGrid(fEMCALClusters, fEMCALClustersGrid);
+  
+  return fEMCALClustersGrid;
+}
+
+//___________________________________________________________________
+/// \return Eta-phi index of the selected PHOS clusters, see FillClustersEtaPhiGrid().
+//___________________________________________________________________
+const AliCaloTrackEtaPhiGrid * AliCaloTrackReader::GetPHOSClustersEtaPhiGrid()
+{
+  if ( !fPHOSClusters ) return 0x0;
+  
+  if ( !fPHOSClustersGrid ) fPHOSClustersGrid = new AliCaloTrackEtaPhiGrid();
+  
+  if ( !fPHOSClustersGrid->IsBuilt() ) FillClustersEtaPhiGrid(fPHOSClusters, fPHOSClustersGrid);
+  
+  return fPHOSClustersGrid;
+}
+
+//___________________________________________________________________
+/// Fill the eta-phi index of a cluster array, with the cluster ID, module
+/// number, MC label and the kinematics assuming that the cluster comes in
+/// straight line from the vertex of its event, as in the isolation cone loops.
+//___________________________________________________________________
+void AliCaloTrackReader::FillClustersEtaPhiGrid(TObjArray * clusters, AliCaloTrackEtaPhiGrid * grid)
+{
+  grid->Reset();
+  
+  for(Int_t iclus = 0; iclus < clusters->GetEntries(); iclus++)
+  {
+    TObject * obj = clusters->At(iclus);
+    
+    AliVCluster * calo = dynamic_cast<AliVCluster*>(obj);
+    if ( calo )
+    {
+      // Get the index where the cluster comes, to retrieve the corresponding vertex
+      Int_t evtIndex = 0 ;
+      if ( fMixedEvent )
+        evtIndex = fMixedEvent->EventIndexForCaloCluster(calo->GetID()) ;
+      
+      calo->GetMomentum(fMomentum, GetVertex(evtIndex)) ;
+      
+      Float_t phi = fMomentum.Phi();
+      if ( phi < 0 ) phi+=TMath::TwoPi();
+      grid->Add(iclus, fMomentum.Pt(), fMomentum.Eta(), phi, calo->GetID(), kTRUE,
+                fMomentum.E(), GetCaloUtils()->GetModuleNumber(calo), calo->GetLabel());
+      continue;
+    }
+    
+    // Mixed event stored in AliCaloTrackParticles
+    AliCaloTrackParticle * calomix = dynamic_cast<AliCaloTrackParticle*>(obj);
+    if ( !calomix )
+    {
+      AliWarning("Wrong calo data type, continue");
+      continue;
+    }
+    
+    Float_t phi = calomix->Phi();
+    if ( phi < 0 ) phi+=TMath::TwoPi();
+    grid->Add(iclus, calomix->Pt(), calomix->Eta(), phi, -1, kFALSE,
+              calomix->E(), calomix->GetSModNumber(), calomix->GetLabel());
+  }
+  
+  grid->Build();
+}
+
 //___________________________________________
 /// Tag event depending on trigger name.
 /// Set also the L1 bit defining the EGA or EJE triggers.
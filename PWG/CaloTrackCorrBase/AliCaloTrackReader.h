@@ -48,6 +48,7 @@ class AliESDtrackCuts;
 //class AliTriggerAnalysis;
 class AliEventplane;
 class AliVCluster;
+class AliCaloTrackEtaPhiGrid;
 #include "AliLog.h"
 #include "AliEventCuts.h"
 //#include "AliAnalysisTaskEmcalEmbeddingHelper.h"
@@ -351,6 +352,13 @@ public:
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
   
+  // Eta-phi and pT indexed view of the arrays, built once per event on first request
+  
+  const AliCaloTrackEtaPhiGrid * GetCTSTracksEtaPhiGrid()   ;
+  const AliCaloTrackEtaPhiGrid * GetEMCALClustersEtaPhiGrid() ;
+  const AliCaloTrackEtaPhiGrid * GetPHOSClustersEtaPhiGrid()  ;
+  void             FillClustersEtaPhiGrid(TObjArray * clusters, AliCaloTrackEtaPhiGrid * grid) ;
+  
   //-------------------------------------
   // Event/track selection methods
   //-------------------------------------
@@ -1171,6 +1179,10 @@ public:
   Bool_t           fRemoveCentralityTriggerOutliers; ///< Reject events from centrality triggers out of expected ranges (PbPb 2011,2018)
   
   TLorentzVector   fMomentum;                      //!<! Temporal TLorentzVector container, avoid declaration of TLorentzVectors per event.
+  
+  AliCaloTrackEtaPhiGrid * fCTSTracksGrid;         //!<! Eta-phi index of fCTSTracks.
+  AliCaloTrackEtaPhiGrid * fEMCALClustersGrid;     //!<! Eta-phi index of fEMCALClusters.
+  AliCaloTrackEtaPhiGrid * fPHOSClustersGrid;      //!<! Eta-phi index of fPHOSClusters.
 
   // Handle runs affected by PAR
   Bool_t           fParRun;                        ///<  Flag set true when run affected by PAR
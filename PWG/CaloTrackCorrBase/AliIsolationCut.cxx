@@ -14,6 +14,7 @@
  **************************************************************************/
 
 // --- ROOT system ---
+#include <algorithm>
 #include <TObjArray.h>
 #include <TH3F.h>
 #include <TCustomBinning.h>
@@ -29,6 +30,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -46,13 +48,14 @@ ClassImp(AliIsolationCut) ;
 AliIsolationCut::AliIsolationCut() :
 TObject(),
 fFillHistograms(0),  fFillEtaPhiHistograms(0),      fFillHighMultHistograms(0), 
-fMakeConeExcessCorr(0),
+fMakeConeExcessCorr(0), fUseEtaPhiGrid(0),
 fConeSize(0.),       fConeSizeBandGap(0.),          fUEBandRectangularExclusion(0),
 fPtThreshold(0.),    fPtThresholdMax(10000.),
 fSumPtThreshold(0.), fSumPtThresholdMax(10000.),    fSumPtThresholdGap(0.),
 fPtFraction(0.),     fICMethod(0),                  fPartInCone(0),
 fFracIsThresh(1),    fIsTMClusterInConeRejected(1), fDistMinToTrigger(-1.),
 fDebug(0),           fMomentum(),                   fTrackVector(),
+fGridRecords(),
 fEMCEtaSize(-1),     fEMCPhiMin(-1),                fEMCPhiMax(-1),
 fTPCEtaSize(-1),     fTPCPhiSize(-1),
 // Histograms
@@ -195,14 +198,58 @@ void AliIsolationCut::CalculateCaloSignalInCone
   TObjArray * refclusters  = 0x0;
   Int_t       nclusterrefs = 0;
   
+  // Visit only the clusters in the eta-phi cells of the reader grid
+  // overlapping the cone and UE regions, kinematics already calculated
+  //
+  const AliCaloTrackEtaPhiGrid * grid = 0x0;
+  if ( fUseEtaPhiGrid && !bgCls && !useRefs )
+  {
+    if      ( calorimeter == AliFiducialCut::kPHOS  ) grid = reader->GetPHOSClustersEtaPhiGrid ();
+    else if ( calorimeter == AliFiducialCut::kEMCAL ) grid = reader->GetEMCALClustersEtaPhiGrid();
+  }
+  
+  Int_t nEntries = plNe->GetEntries();
+  if ( grid )
+  {
+    SelectEtaPhiGridRecords(grid, etaC, phiC);
+    nEntries = fGridRecords.size();
+  }
+  
   // Get the clusters
   //
   //printf("Loop calo\n");
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  for(Int_t ipr = 0;ipr < nEntries ; ipr ++ )
   {
-    AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
+    AliVCluster * calo = 0x0;
     
-    if ( calo )
+    if ( grid )
+    {
+      Int_t irec = fGridRecords[ipr];
+      
+      if ( grid->HasID(irec) )
+      {
+        calo = static_cast<AliVCluster *>(plNe->At(grid->GetEntry(irec))) ;
+        
+        // Do not count the candidate (photon or pi0) or the daughters of the candidate
+        if ( grid->GetID(irec) == pCandidate->GetCaloLabel(0) ||
+             grid->GetID(irec) == pCandidate->GetCaloLabel(1)   ) continue ;
+        
+        // Skip matched clusters with tracks in case of neutral+charged analysis
+        if ( fIsTMClusterInConeRejected )
+        {
+          Bool_t bRes = kFALSE, bEoP = kFALSE;
+          Bool_t matched = pid->IsTrackMatched(calo, reader->GetCaloUtils(), 
+                                               reader->GetInputEvent(),
+                                               bEoP,bRes);
+          if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
+        }
+      }
+      
+      pt  = grid->GetPt (irec);
+      eta = grid->GetEta(irec);
+      phi = grid->GetPhi(irec);
+    }
+    else if ( (calo = dynamic_cast<AliVCluster *>(plNe->At(ipr))) )
     {
       // Get the index where the cluster comes, to retrieve the corresponding vertex
       Int_t evtIndex = 0 ;
@@ -547,16 +594,55 @@ void AliIsolationCut::CalculateTrackSignalInCone
   
   TObjArray * reftracks  = 0x0;
   Int_t       ntrackrefs = 0;
-    
+  
+  // Visit only the tracks in the eta-phi cells of the reader grid
+  // overlapping the cone and UE regions, kinematics already calculated
+  //
+  const AliCaloTrackEtaPhiGrid * grid = 0x0;
+  if ( fUseEtaPhiGrid && !bgTrk && !useRefs ) grid = reader->GetCTSTracksEtaPhiGrid();
+  
+  Int_t nEntries = plCTS->GetEntries();
+  if ( grid )
+  {
+    SelectEtaPhiGridRecords(grid, etaTrig, phiTrig);
+    nEntries = fGridRecords.size();
+  }
+  
   //-----------------------------------------------------------
   // Get the tracks in cone
   //
   //-----------------------------------------------------------
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  for(Int_t ipr = 0;ipr < nEntries ; ipr ++ )
   {
-    AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
+    AliVTrack* track = 0x0;
     
-    if(track)
+    if ( grid )
+    {
+      Int_t irec = fGridRecords[ipr];
+      
+      if ( grid->HasID(irec) )
+      {
+        track = static_cast<AliVTrack*>(plCTS->At(grid->GetEntry(irec))) ;
+        
+        // Do not count the candidate or its daughters, see below
+        if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS )
+        {
+          Bool_t contained = kFALSE;
+          
+          for(Int_t i = 0; i < 4; i++) 
+          {
+            if( grid->GetID(irec) == pCandidate->GetTrackLabel(i) ) contained = kTRUE;
+          }
+          
+          if ( contained ) continue ;
+        }
+      }
+      
+      ptTrack  = grid->GetPt (irec);
+      etaTrack = grid->GetEta(irec);
+      phiTrack = grid->GetPhi(irec);
+    }
+    else if ( (track = dynamic_cast<AliVTrack*>(plCTS->At(ipr))) )
     {
       // In case of isolation of single tracks or conversion photon (2 tracks) or pi0 (4 tracks),
       // do not count the candidate or the daughters of the candidate
@@ -841,6 +927,46 @@ void AliIsolationCut::CalculateTrackSignalInCone
   if ( bFillAOD && reftracks ) pCandidate->AddObjArray(reftracks);  
 }
 
+//_________________________________________________________________________________________________________________________________
+/// Fill fGridRecords with the records of the reader eta-phi grid that may contribute to the
+/// cone, UE bands or perpendicular cones of the candidate, in the order of the reader list.
+/// All of them if the eta-phi histograms of all tracks/clusters are filled.
+///
+/// \param grid: eta-phi index of the reader tracks or clusters.
+/// \param etaC: pseudorapidity of candidate particle.
+/// \param phiC: azimuthal angle of candidate particle, in [0, 2pi[.
+//_________________________________________________________________________________________________________________________________
+void AliIsolationCut::SelectEtaPhiGridRecords(const AliCaloTrackEtaPhiGrid * grid, Float_t etaC, Float_t phiC)
+{
+  fGridRecords.clear();
+  
+  if ( fFillHistograms && fFillEtaPhiHistograms )
+  {
+    grid->SelectAll(fGridRecords);
+    return;
+  }
+  
+  // Slightly larger than the cone, the cells are only a preselection
+  Float_t size = fConeSize + 0.01;
+  
+  if ( fICMethod >= kSumBkgSubIC )
+  {
+    // Phi band and perpendicular cones, within the cone in eta
+    grid->SelectBox(etaC-size, etaC+size, 
+                    phiC-TMath::PiOver2()-size, phiC+TMath::PiOver2()+size, fGridRecords);
+    
+    // Eta band, within the cone in phi
+    grid->SelectBox(-1e6, 1e6, phiC-size, phiC+size, fGridRecords);
+  }
+  else
+  {
+    grid->SelectBox(etaC-size, etaC+size, phiC-size, phiC+size, fGridRecords);
+  }
+  
+  std::sort(fGridRecords.begin(), fGridRecords.end());
+  fGridRecords.erase(std::unique(fGridRecords.begin(), fGridRecords.end()), fGridRecords.end());
+}
+
 //_________________________________________________________________________________________________________________________________
 /// Get normalization of cluster background band.
 //_________________________________________________________________________________________________________________________________
@@ -2228,6 +2354,8 @@ TString AliIsolationCut::GetICParametersList()
   parList+=onePar ;
   snprintf(onePar,buffersize,"fMakeConeExcessCorr=%d;",fMakeConeExcessCorr) ;
   parList+=onePar ;
+  snprintf(onePar,buffersize,"fUseEtaPhiGrid=%d;",fUseEtaPhiGrid) ;
+  parList+=onePar ;
   snprintf(onePar,buffersize,"fNeutralOverChargedRatio={%1.2e,%1.2e,%1.2e,%1.2e};",
            fNeutralOverChargedRatio[0],fNeutralOverChargedRatio[1],fNeutralOverChargedRatio[2],fNeutralOverChargedRatio[3]) ;
   parList+=onePar ;
@@ -2248,6 +2376,7 @@ void AliIsolationCut::InitParameters()
   fConeSizeBandGap      = 0.0 ;
   fUEBandRectangularExclusion = kTRUE;
   fMakeConeExcessCorr   = kFALSE;
+  fUseEtaPhiGrid        = kTRUE;
   fPtThreshold          = 0.5  ;
   fPtThresholdMax       = 10000.;
   fSumPtThreshold       = 2.0 ;
@@ -2793,6 +2922,7 @@ void AliIsolationCut::Print(const Option_t * opt) const
   printf("using fraction for high pt leading instead of frac ? %i\n",fFracIsThresh);
   printf("minimum distance to candidate, R>%1.2f\n",fDistMinToTrigger);
   printf("correct cone excess = %d \n",fMakeConeExcessCorr);
+  printf("use eta-phi grid = %d \n",fUseEtaPhiGrid);
   printf("NeutralOverChargedRatio param={%1.2e,%1.2e,%1.2e,%1.2e} \n",
   fNeutralOverChargedRatio[0],fNeutralOverChargedRatio[1],fNeutralOverChargedRatio[2],fNeutralOverChargedRatio[3]) ;
   printf("    \n") ;
@@ -24,12 +24,14 @@ class TObjArray ;
 class TList ;
 class TH3F ;
 #include <TLorentzVector.h>
+#include <vector>
 
 // --- ANALYSIS system ---
 class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID ;
 class AliHistogramRanges ;
+class AliCaloTrackEtaPhiGrid ;
 
 class AliIsolationCut : public TObject {
 
@@ -101,6 +103,8 @@ class AliIsolationCut : public TObject {
                                         Float_t & perpBandPtSum,
                                         Double_t  histoWeight=1,Float_t centrality = -1) ;
   
+  void       SelectEtaPhiGridRecords(const AliCaloTrackEtaPhiGrid * grid, Float_t etaC, Float_t phiC) ;
+  
   // Cone background studies medthods
 
   void       GetDetectorAngleLimits( AliCaloTrackReader * reader, Int_t calorimeter );
@@ -193,6 +197,9 @@ class AliIsolationCut : public TObject {
   void       SwitchOnConeExcessCorrection ()                   { fMakeConeExcessCorr = kTRUE  ; }
   void       SwitchOffConeExcessCorrection()                   { fMakeConeExcessCorr = kFALSE ; }
   
+  void       SwitchOnEtaPhiGrid ()                             { fUseEtaPhiGrid = kTRUE  ; }
+  void       SwitchOffEtaPhiGrid()                             { fUseEtaPhiGrid = kFALSE ; }
+  
  private:
 
   Bool_t     fFillHistograms;                          ///< Fill histograms if GetCreateOuputObjects() was called. 
@@ -203,6 +210,8 @@ class AliIsolationCut : public TObject {
   
   Bool_t     fMakeConeExcessCorr;                      ///< Make cone excess from detector correction. 
   
+  Bool_t     fUseEtaPhiGrid;                           ///< Loop only on the reader tracks/clusters in the eta-phi cells overlapping the cone and UE regions.
+  
   Float_t    fConeSize ;                               ///< Size of the isolation cone
  
   Float_t    fConeSizeBandGap ;                        ///< Gap to add to size of the isolation cone when filling eta/phi bands for UE estimation
@@ -239,6 +248,8 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;                             //!<! Track moment, temporal object.
   
+  std::vector<Int_t> fGridRecords;                     //!<! Records of the reader eta-phi grid to visit for the current candidate, temporal.
+  
   Float_t    fEMCEtaSize;                              ///< Eta size of Calo
   Float_t    fEMCPhiMin;                               ///< Minimim Phi limit of Calo
   Float_t    fEMCPhiMax;                               ///< Maximum Phi limit of Calo
@@ -372,7 +383,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,15) ;
+  ClassDef(AliIsolationCut,16) ;
   /// \endcond
 
 } ;
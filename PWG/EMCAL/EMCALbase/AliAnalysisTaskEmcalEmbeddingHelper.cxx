@@ -26,6 +26,8 @@
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TBranch.h>
+#include <TObjArray.h>
 #include <TGrid.h>
 #include <TGridResult.h>
 #include <TSystem.h>
@@ -173,7 +175,11 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fPreselectFromHeaders(true),
+  fPrefetchNextFile(true),
+  fSelectionBranches(),
+  fSelectionTreeNumber(-1)
 {
   if (fgInstance != nullptr) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -250,7 +256,11 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fPreselectFromHeaders(true),
+  fPrefetchNextFile(true),
+  fSelectionBranches(),
+  fSelectionTreeNumber(-1)
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -336,6 +346,8 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
   res = fYAMLConfig.GetProperty("printTimingInfoInLog", fPrintTimingInfoToLog, false);
+  res = fYAMLConfig.GetProperty("preselectFromHeaders", fPreselectFromHeaders, false);
+  res = fYAMLConfig.GetProperty("prefetchNextFile", fPrefetchNextFile, false);
   // More general embedding helper properties
   res = fYAMLConfig.GetProperty("filePattern", fFilePattern, false);
   res = fYAMLConfig.GetProperty("inputFilename", fInputFilename, false);
@@ -904,6 +916,7 @@ void AliAnalysisTaskEmcalEmbeddingHelper::DetermineFirstFileToEmbed()
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 {
   Int_t attempts = -1;
+  Bool_t selected = kFALSE;
 
   do {
     // Reset to start of tree
@@ -927,10 +940,11 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       InitTree();
     }
 
-    // Load current event
+    // Load current event (possibly only the branches needed for the selection, see LoadEntryForSelection())
     // Can be a simple less than, because fFileNumber counts from 0.
+    Bool_t fullEntry = kTRUE;
     if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
+      fullEntry = LoadEntryForSelection(fCurrentEntry);
     }
     else {
       AliError("====================================================================================================");
@@ -948,8 +962,9 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
       // Access the relevant entry
       // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
-      fChain->GetEntry(fCurrentEntry);
+      fullEntry = LoadEntryForSelection(fCurrentEntry);
     }
+    Long64_t entry = fCurrentEntry;
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
 
     // Set relevant event properties
@@ -968,7 +983,19 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       RecordEmbeddedEventProperties();
     }
 
-  } while (!IsEventSelected());
+    if (!fullEntry) {
+      // Apply the selection of this class on the branches read so far and only read the full
+      // entry if it passes. Derived classes may select on the full event, so the complete
+      // selection is applied afterwards.
+      if (!PreselectEmbeddedEvent()) continue;
+
+      fChain->GetEntry(entry);
+      // The MC header has been read again, so the pythia header must be retrieved again
+      SetEmbeddedEventProperties();
+    }
+
+    selected = IsEventSelected();
+  } while (!selected);
 
   if (fCreateHisto) {
     fHistManager.FillTH1("fHistEventCount", "Accepted");
@@ -1058,6 +1085,26 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEventSelected()
   return kFALSE;
 }
 
+/**
+ * Applies the embedded event selection of this class (not the one of derived classes) when only the
+ * branches read by LoadEntryForSelection() are available, with the same rejection counting as IsEventSelected().
+ *
+ * @return kTRUE if the event passes the selection of this class.
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::PreselectEmbeddedEvent()
+{
+  if (AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()) {
+    return kTRUE;
+  }
+
+  if (fCreateHisto) {
+    // Keep count of number of rejected events
+    fHistManager.FillTH1("fHistEventCount", "Rejected");
+  }
+
+  return kFALSE;
+}
+
 /**
  * Performs the embedded event selection on the current external event.
  *
@@ -1597,6 +1644,12 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // (re)set whether we have wrapped the tree
   fWrappedAroundTree = false;
 
+  // Find the branches of the new tree needed for the selection and start opening the next file
+  SetupSelectionBranches();
+  if (fPrefetchNextFile) {
+    PrefetchNextFile();
+  }
+
   // Note that the tree in the new file has been initialized
   fInitializedNewFile = kTRUE;
   
@@ -1610,6 +1663,80 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
 
 }
 
+/**
+ * Find the branches of the current tree of the chain which are needed by CheckIsEmbeddedEventSelected():
+ * the header (physics selection), the vertices (vertex selection) and, if available, the MC header
+ * (pt hard and outlier rejection). Only possible for AODs, otherwise the full entry is always read.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetupSelectionBranches()
+{
+  fSelectionBranches.clear();
+  fSelectionTreeNumber = -1;
+
+  if (!fPreselectFromHeaders || !dynamic_cast<AliAODEvent*>(fExternalEvent)) return;
+
+  TTree * tree = fChain->GetTree();
+  if (!tree) return;
+
+  TBranch * header = tree->GetBranch("header");
+  TBranch * vertices = tree->GetBranch("vertices");
+  if (!header || !vertices) {
+    AliDebugStream(2) << "Header or vertices branch not found in the tree, the full entries will be read for the selection.\n";
+    return;
+  }
+  fSelectionBranches.push_back(header);
+  fSelectionBranches.push_back(vertices);
+
+  TBranch * mcHeader = tree->GetBranch(AliAODMCHeader::StdBranchName());
+  if (mcHeader) {
+    fSelectionBranches.push_back(mcHeader);
+  }
+
+  fSelectionTreeNumber = fChain->GetTreeNumber();
+}
+
+/**
+ * Load an entry of the chain. If the selection branches of its tree are known (see SetupSelectionBranches()),
+ * only these branches are read. Otherwise the full entry is read.
+ *
+ * @param[in] entry Entry in the chain
+ *
+ * @return kTRUE if the full entry has been read.
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::LoadEntryForSelection(Long64_t entry)
+{
+  if (!fSelectionBranches.empty()) {
+    Long64_t localEntry = fChain->LoadTree(entry);
+    if (localEntry >= 0 && fChain->GetTreeNumber() == fSelectionTreeNumber) {
+      for (auto branch : fSelectionBranches) {
+        branch->GetEntry(localEntry);
+      }
+      return kFALSE;
+    }
+  }
+
+  fChain->GetEntry(entry);
+  return kTRUE;
+}
+
+/**
+ * Request an asynchronous open of the file following the current one in the chain, so that it is
+ * (at least partially) opened by the time the chain moves to it. TFile::Open() called by the chain
+ * picks up the pending request for the same name. After the last file, embedding restarts from the
+ * first one of the chain.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PrefetchNextFile()
+{
+  Int_t treeNumber = fChain->GetTreeNumber();
+  if (fMaxNumberOfFiles < 2 || treeNumber < 0) return;
+
+  TObject * element = fChain->GetListOfFiles()->At((treeNumber + 1) % fMaxNumberOfFiles);
+  if (element) {
+    AliDebugStream(3) << "Asynchronously opening the next file to embed: " << element->GetTitle() << "\n";
+    TFile::AsyncOpen(element->GetTitle());
+  }
+}
+
 /**
  * Extract pythia information from a cross section file. Modified from AliAnalysisTaskEmcal::PythiaInfoFromFile().
  *
@@ -2007,6 +2134,8 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "File list filename: \"" << fFileListFilename << "\"\n";
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
+  tempSS << "Preselect from headers: " << fPreselectFromHeaders << "\n";
+  tempSS << "Prefetch next file: " << fPrefetchNextFile << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
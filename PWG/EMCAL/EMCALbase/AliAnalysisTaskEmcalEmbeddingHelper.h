@@ -19,6 +19,7 @@
 class TString;
 class TChain;
 class TFile;
+class TBranch;
 class AliVEvent;
 class AliMCEvent;
 class AliVHeader;
@@ -123,6 +124,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
   TString GetFileListFilename()                             const { return fFileListFilename; }
   bool GetCreateHistos()                                    const { return fCreateHisto; }
+  bool GetPreselectFromHeaders()                            const { return fPreselectFromHeaders; }
+  bool GetPrefetchNextFile()                                const { return fPrefetchNextFile; }
   TString GetExternalFilePath()                             const ;
   
   // Set
@@ -136,6 +139,13 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetAOD(const char * treeName = "aodTree")                  { fTreeName     = treeName; }
   /// Set whether to print and plot execution time of InitTree()
   void SetPrintTimingInfoToLog(bool b)                            { fPrintTimingInfoToLog = b;}
+  /**
+   * Apply the embedded event selection after reading only the header, vertices and MC header branches
+   * of the AOD entry, reading the full entry only for the events which pass it. Enabled by default.
+   */
+  void SetPreselectFromHeaders(bool b)                            { fPreselectFromHeaders = b; }
+  /// Open the next file of the chain asynchronously when starting to embed a new file. Enabled by default.
+  void SetPrefetchNextFile(bool b)                                { fPrefetchNextFile = b; }
   /**
    * Enable to begin embedding at a random entry in each embedded file. Will then loop around in order
    * so that all entries are made available.
@@ -308,6 +318,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   virtual Bool_t  CheckIsEmbeddedEventSelected();
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            SetupSelectionBranches();
+  Bool_t          LoadEntryForSelection(Long64_t entry);
+  Bool_t          PreselectEmbeddedEvent();
+  void            PrefetchNextFile()    ;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   // Validation helper
   void            ValidatePhysicsSelectionForInternalEventSelection();
@@ -387,6 +401,11 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   bool                                          fPrintTimingInfoToLog; ///< Flag to print time to execute InitTree(), for logging purposes
   TStopwatch                                    fTimer            ;    //!<! Timer for the InitTree() function
 
+  bool                                          fPreselectFromHeaders; ///< If true, read only the branches needed by the embedded event selection until the event is accepted
+  bool                                          fPrefetchNextFile ; ///< If true, asynchronously open the next file of the chain when starting a new file
+  std::vector <TBranch *>                       fSelectionBranches; //!<! Branches of the current tree needed by the embedded event selection. Empty if the full entry is read
+  Int_t                                         fSelectionTreeNumber; //!<! Number of the tree in the chain the selection branches belong to
+
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
  private:
@@ -394,7 +413,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 14);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 15);
   /// \endcond
 };
 #endif
@@ -82,7 +82,9 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fCutRequireTPCRefit(kFALSE),            fCutRequireITSRefit(kFALSE),            fCutAcceptKinkDaughters(kFALSE),
   fCutMaxDCAToVertexXY(0),                fCutMaxDCAToVertexZ(0),                 fCutDCAToVertex2D(kFALSE),
   fCutRequireITSStandAlone(kFALSE),       fCutRequireITSpureSA(kFALSE),
-  fNMCGenerToAccept(0),                   fMCGenerToAcceptForTrack(1)
+  fNMCGenerToAccept(0),                   fMCGenerToAcceptForTrack(1),
+  fCellTableSM(),                         fCellTableBad(),                        fCellTableRecalib(),
+  fCellTableSingleChannel(),              fCellTableTime()
 {
   // Init parameters
   InitParameters();
@@ -151,7 +153,9 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fCutAcceptKinkDaughters(reco.fCutAcceptKinkDaughters),     fCutMaxDCAToVertexXY(reco.fCutMaxDCAToVertexXY),
   fCutMaxDCAToVertexZ(reco.fCutMaxDCAToVertexZ),             fCutDCAToVertex2D(reco.fCutDCAToVertex2D),
   fCutRequireITSStandAlone(reco.fCutRequireITSStandAlone),   fCutRequireITSpureSA(reco.fCutRequireITSpureSA),
-  fNMCGenerToAccept(reco.fNMCGenerToAccept),                 fMCGenerToAcceptForTrack(reco.fMCGenerToAcceptForTrack)
+  fNMCGenerToAccept(reco.fNMCGenerToAccept),                 fMCGenerToAcceptForTrack(reco.fMCGenerToAcceptForTrack),
+  fCellTableSM(),           fCellTableBad(),                 fCellTableRecalib(),
+  fCellTableSingleChannel(),                                 fCellTableTime()
 {
   for (Int_t i = 0; i < 15 ; i++) { fMisalRotShift[i]      = reco.fMisalRotShift[i]      ;
                                     fMisalTransShift[i]    = reco.fMisalTransShift[i]    ; }
@@ -300,6 +304,9 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   for (Int_t j = 0; j < 4  ; j++)
    fBadStatusSelection[j] = reco.fBadStatusSelection[j] ;
 
+  // the table refers to the calibration maps, to be rebuilt
+  fCellTableSM.clear();
+
   if(fEMCALBadChannelMap) delete fEMCALBadChannelMap;
   if(reco.fEMCALBadChannelMap) {
     // Copy constructor - not taking ownership over calibration histograms
@@ -468,6 +475,122 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
   return kTRUE;
 }
 
+///
+/// Fill the calibration table used by RecalibrateCellValues(): super module,
+/// bad channel status, energy and time recalibration factors of each cell,
+/// indexed by absolute cell id. To be called once the calibration maps of
+/// the run are loaded.
+///
+//_______________________________________________________________________________
+void AliEMCALRecoUtils::InitCellCalibrationTable()
+{
+  AliEMCALGeometry* geom = AliEMCALGeometry::GetInstance();
+
+  if(!geom){
+    AliError("No instance of the geometry is available");
+    fCellTableSM.clear();
+    return;
+  }
+
+  const Int_t nCells = 24*48*geom->GetNumberOfSuperModules();
+
+  fCellTableSM           .assign(nCells, -1);
+  fCellTableBad          .assign(nCells, 0);
+  fCellTableRecalib      .assign(nCells, 1.);
+  fCellTableSingleChannel.assign(nCells, 1.);
+  fCellTableTime         .assign(8*nCells, 0.);
+
+  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0;
+
+  for (Int_t absID = 0; absID < nCells; absID++)
+  {
+    if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)) continue;
+
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
+
+    fCellTableSM[absID] = imod;
+
+    if(fUse1Dmap)
+      fCellTableBad[absID] = GetEMCALChannelStatus1D(absID,status);
+    else
+      fCellTableBad[absID] = GetEMCALChannelStatus(imod, ieta, iphi,status);
+
+    if(fUse1Drecalib)
+      fCellTableRecalib[absID] = GetEMCALChannelRecalibrationFactor1D(absID);
+    else
+      fCellTableRecalib[absID] = GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+
+    if (fEMCALSingleChannelRecalibrationFactors && !(fEMCALSingleChannelRecalibrationFactors->GetEntries() <= imod))
+      fCellTableSingleChannel[absID] = GetEMCALSingleChannelRecalibrationFactor(imod,ieta,iphi);
+
+    // The factors of the 4 BCs are the same with merged BCs, the getter reads the
+    // merged histograms. Low gain factors only exist with fLowGain, as in RecalibrateCellTime,
+    // otherwise their slots are left to 0 and not used.
+    for (Int_t ibc = 0; ibc < 4; ibc++)
+    {
+      fCellTableTime[ ibc   *nCells + absID] = GetEMCALChannelTimeRecalibrationFactor(ibc,absID,kFALSE);
+      if ( fLowGain )
+        fCellTableTime[(ibc+4)*nCells + absID] = GetEMCALChannelTimeRecalibrationFactor(ibc,absID,kTRUE);
+    }
+  }
+}
+
+///
+/// Same as AcceptCalibrateCell(), with the cell energy, time and gain given
+/// instead of read from the cells list, and the calibration read from the
+/// table filled by InitCellCalibrationTable().
+///
+/// \param absID: absolute cell ID number
+/// \param bc: bunch crossing number
+/// \param isLowGain: low gain cell
+/// \param amp: input cell energy amplitude, output calibrated amplitude
+/// \param time: input cell time, output calibrated time
+///
+/// \return bool quality of cell, exists or not
+///
+//_______________________________________________________________________________
+Bool_t AliEMCALRecoUtils::RecalibrateCellValues(Int_t absID, Int_t bc, Bool_t isLowGain,
+                                                Float_t & amp, Double_t & time)
+{
+  const Int_t nCells = fCellTableSM.size();
+
+  if ( absID < 0 || absID >= nCells || fCellTableSM[absID] < 0 )
+    return kFALSE;
+
+  // Do not include bad channels found in analysis,
+  if ( IsBadChannelsRemovalSwitchedOn() && fCellTableBad[absID] )
+    return kFALSE;
+
+  //Recalibrate energy
+  if (!fCellsRecalibrated && IsRecalibrationOn()){
+    // take out non lin from shaper for low gain cells
+    if(fUseShaperNonlin && isLowGain){
+      amp = CorrectShaperNonLin(amp,1.);
+    }
+
+    // correct cell energy based on pi0 calibration
+    amp *= fCellTableRecalib[absID];
+
+    // Single channel calibration
+    if (IsSingleChannelRecalibrationOn())
+      amp *= fCellTableSingleChannel[absID];
+  }
+
+  // Recalibrate time
+  if (IsTimeECorrectionOn())
+    CorrectCellTimeVsE(amp, time, isLowGain);
+  time-=fConstantTimeShift*1e-9; // only in case of old Run1 simulation
+
+  //Recalibrate time with L1 phase
+  RecalibrateCellTimeL1Phase(fCellTableSM[absID], bc, time, fCurrentParNumber);
+
+  // Correct for cable length and other delays
+  if (!fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0)
+    time -= fCellTableTime[(bc%4 + 4*(fLowGain && isLowGain))*nCells + absID]*1.e-9;
+
+  return kTRUE;
+}
+
 ///
 /// Given the list of AbsId cells of the cluster, get the maximum cell and
 /// check if there are fNCellsFromBorder from the calorimeter border.
@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 // Root includes
+#include <vector>
 #include <TArray.h>
 #include <TArrayL64.h>
 #include <TNamed.h>
@@ -170,6 +171,10 @@ public:
   Bool_t   AcceptCalibrateCell(Int_t absId, Int_t bc,
                                Float_t & amp, Double_t & time, AliVCaloCells* cells) ; // Energy and Time
   void     RecalibrateCells(AliVCaloCells * cells, Int_t bc) ; // Energy and Time
+  void     InitCellCalibrationTable() ;                         // Per run, for RecalibrateCellValues()
+  Bool_t   HasCellCalibrationTable()                     const { return !fCellTableSM.empty() ; }
+  Bool_t   RecalibrateCellValues(Int_t absId, Int_t bc, Bool_t isLowGain,
+                                 Float_t & amp, Double_t & time) ; // Energy and Time, as AcceptCalibrateCell
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
 
@@ -701,6 +706,13 @@ private:
   TString    fMCGenerToAccept[5];        ///<  List with name of generators that should not be included
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
   
+  // Calibration table per absolute cell id, see InitCellCalibrationTable()
+  std::vector<Short_t> fCellTableSM;            //!<! Super module of each cell, -1 if the cell does not exist
+  std::vector<UChar_t> fCellTableBad;           //!<! Cell rejected by the bad channel map
+  std::vector<Float_t> fCellTableRecalib;       //!<! Energy recalibration factor
+  std::vector<Float_t> fCellTableSingleChannel; //!<! Single channel recalibration factor, 1 if not available
+  std::vector<Float_t> fCellTableTime;          //!<! Time recalibration factor, [(bc%4 + 4*lowGain)*nCells + absId]
+  
   /// \cond CLASSIMP
   ClassDef(AliEMCALRecoUtils, 36) ;
   /// \endcond
@@ -89,9 +89,10 @@ void AliEmcalCorrectionCellBadChannel::UserCreateOutputObjects()
 }
 
 /**
- * Called for each event to process the event data.
+ * Configure the reco utils for the event, common to Run() and PrepareCellTransform().
+ * @return kFALSE if the event has no cells
  */
-Bool_t AliEmcalCorrectionCellBadChannel::Run()
+Bool_t AliEmcalCorrectionCellBadChannel::PrepareCells()
 {
   AliEmcalCorrectionComponent::Run();
   
@@ -117,6 +118,25 @@ Bool_t AliEmcalCorrectionCellBadChannel::Run()
   // mark the cells not recalibrated
   fRecoUtils->ResetCellsCalibrated();
 
+  return kTRUE;
+}
+
+/**
+ * Per-event setup of the per-cell transform, replacing Run() when the cell
+ * components are fused by the correction task.
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::PrepareCellTransform()
+{
+  return PrepareCells() && PrepareRecalibrateCellValues();
+}
+
+/**
+ * Called for each event to process the event data.
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::Run()
+{
+  if (!PrepareCells()) return kFALSE;
+  
   if(fCreateHisto)
     FillCellQA(fCellEnergyDistBefore); // "before" QA
   
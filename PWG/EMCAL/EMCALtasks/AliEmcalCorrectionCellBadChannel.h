@@ -32,12 +32,18 @@ class AliEmcalCorrectionCellBadChannel : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Per-cell transform, see AliEmcalCorrectionComponent
+  Bool_t HasCellTransform() const { return !fCreateHisto; }
+  Bool_t PrepareCellTransform();
+  void   TransformCell(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time) { RecalibrateCellValues(absId, highGain, energy, time); }
   
 protected:
   TH1F* fCellEnergyDistBefore;              //!<! cell energy distribution, before bad channel correction
   TH1F* fCellEnergyDistAfter;               //!<! cell energy distribution, after bad channel correction
   
 private:
+  Bool_t                 PrepareCells();
 
   AliEmcalCorrectionCellBadChannel(const AliEmcalCorrectionCellBadChannel &);             // Not implemented
   AliEmcalCorrectionCellBadChannel &operator=(const AliEmcalCorrectionCellBadChannel &);   // Not implemented
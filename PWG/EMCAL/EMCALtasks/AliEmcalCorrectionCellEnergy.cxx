@@ -95,9 +95,10 @@ void AliEmcalCorrectionCellEnergy::UserCreateOutputObjects()
 }
 
 /**
- * Called for each event to process the event data.
+ * Configure the reco utils for the event, common to Run() and PrepareCellTransform().
+ * @return kFALSE if the event has no cells
  */
-Bool_t AliEmcalCorrectionCellEnergy::Run()
+Bool_t AliEmcalCorrectionCellEnergy::PrepareCells()
 {
   AliEmcalCorrectionComponent::Run();
   
@@ -121,7 +122,25 @@ Bool_t AliEmcalCorrectionCellEnergy::Run()
   
   // mark the cells not recalibrated
   fRecoUtils->ResetCellsCalibrated();
-  
+
+  return kTRUE;
+}
+
+/**
+ * Per-event setup of the per-cell transform, replacing Run() when the cell
+ * components are fused by the correction task.
+ */
+Bool_t AliEmcalCorrectionCellEnergy::PrepareCellTransform()
+{
+  return PrepareCells() && PrepareRecalibrateCellValues();
+}
+
+/**
+ * Called for each event to process the event data.
+ */
+Bool_t AliEmcalCorrectionCellEnergy::Run()
+{
+  if (!PrepareCells()) return kFALSE;
   
   if(fCreateHisto)
     FillCellQA(fCellEnergyDistBefore); // "before" QA
@@ -32,12 +32,19 @@ class AliEmcalCorrectionCellEnergy : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Per-cell transform, see AliEmcalCorrectionComponent
+  Bool_t HasCellTransform() const { return !fCreateHisto; }
+  Bool_t PrepareCellTransform();
+  void   TransformCell(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time) { RecalibrateCellValues(absId, highGain, energy, time); }
+  void   FinishCellTransform() { fRecoUtils->SwitchOffRecalibration(); }
   
 protected:
   TH1F* fCellEnergyDistBefore;        //!<! cell energy distribution, before energy calibration
   TH1F* fCellEnergyDistAfter;         //!<! cell energy distribution, after energy calibration
 
 private:
+  Bool_t                 PrepareCells();
   Int_t                  InitRecalib();
   Int_t                  InitRunDepRecalib();
   
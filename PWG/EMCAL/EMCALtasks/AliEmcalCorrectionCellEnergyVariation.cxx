@@ -158,3 +158,26 @@ void AliEmcalCorrectionCellEnergyVariation::LoadEnergyScaleFunction(const std::s
   file->Close();
   delete file;
 }
+
+/**
+ * Per-event setup of the per-cell transform, replacing Run() when the cell
+ * components are fused by the correction task.
+ * @return kFALSE if no scale function is set
+ */
+Bool_t AliEmcalCorrectionCellEnergyVariation::PrepareCellTransform()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  return fEnergyScaleFunction != 0;
+}
+
+/**
+ * Scale the cell energy, as done in Run().
+ */
+void AliEmcalCorrectionCellEnergyVariation::TransformCell(Short_t /*absId*/, Bool_t /*highGain*/, Double_t & energy, Double_t & /*time*/)
+{
+  if (energy > fMinCellE && energy < fMaxCellE) {
+    Double_t ecell = energy * fEnergyScaleFunction->Eval(energy);
+    if (ecell > 0.) energy = ecell;
+  }
+}
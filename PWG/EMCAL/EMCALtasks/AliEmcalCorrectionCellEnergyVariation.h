@@ -30,6 +30,11 @@ class AliEmcalCorrectionCellEnergyVariation : public AliEmcalCorrectionComponent
   void UserCreateOutputObjects();
   void ExecOnce();
   Bool_t Run();
+
+  // Per-cell transform, see AliEmcalCorrectionComponent
+  Bool_t HasCellTransform() const { return kTRUE; }
+  Bool_t PrepareCellTransform();
+  void   TransformCell(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time);
   
 protected:
   
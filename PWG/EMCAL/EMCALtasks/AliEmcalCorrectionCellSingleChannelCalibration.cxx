@@ -76,9 +76,10 @@ void AliEmcalCorrectionCellSingleChannelCalibration::UserCreateOutputObjects()
 }
 
 /**
- * Called for each event to process the event data.
+ * Configure the reco utils for the event, common to Run() and PrepareCellTransform().
+ * @return kFALSE if the event has no cells
  */
-Bool_t AliEmcalCorrectionCellSingleChannelCalibration::Run()
+Bool_t AliEmcalCorrectionCellSingleChannelCalibration::PrepareCells()
 {
   AliEmcalCorrectionComponent::Run();
   
@@ -102,7 +103,25 @@ Bool_t AliEmcalCorrectionCellSingleChannelCalibration::Run()
   
   // mark the cells not recalibrated
   fRecoUtils->ResetCellsCalibrated();
-  
+
+  return kTRUE;
+}
+
+/**
+ * Per-event setup of the per-cell transform, replacing Run() when the cell
+ * components are fused by the correction task.
+ */
+Bool_t AliEmcalCorrectionCellSingleChannelCalibration::PrepareCellTransform()
+{
+  return PrepareCells() && PrepareRecalibrateCellValues();
+}
+
+/**
+ * Called for each event to process the event data.
+ */
+Bool_t AliEmcalCorrectionCellSingleChannelCalibration::Run()
+{
+  if (!PrepareCells()) return kFALSE;
   
   if(fCreateHisto)
     FillCellQA(fCellSingleChannelEnergyDistBefore); // "before" QA
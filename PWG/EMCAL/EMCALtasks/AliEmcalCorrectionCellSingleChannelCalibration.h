@@ -33,12 +33,19 @@ class AliEmcalCorrectionCellSingleChannelCalibration : public AliEmcalCorrection
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Per-cell transform, see AliEmcalCorrectionComponent
+  Bool_t HasCellTransform() const { return !fCreateHisto; }
+  Bool_t PrepareCellTransform();
+  void   TransformCell(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time) { RecalibrateCellValues(absId, highGain, energy, time); }
+  void   FinishCellTransform() { fRecoUtils->SwitchOffRecalibration(); }
   
  protected:
   TH1F* fCellSingleChannelEnergyDistBefore;        //!<! cell energy distribution, before energy calibration
   TH1F* fCellSingleChannelEnergyDistAfter;         //!<! cell energy distribution, after energy calibration
 
 private:
+  Bool_t                 PrepareCells();
   Int_t                  InitRecalib();
   
   // Change to false if experts
@@ -100,9 +100,10 @@ void AliEmcalCorrectionCellTimeCalib::UserCreateOutputObjects()
 }
 
 /**
- * Called for each event to process the event data.
+ * Configure the reco utils for the event, common to Run() and PrepareCellTransform().
+ * @return kFALSE if the event has no cells
  */
-Bool_t AliEmcalCorrectionCellTimeCalib::Run()
+Bool_t AliEmcalCorrectionCellTimeCalib::PrepareCells()
 {
   AliEmcalCorrectionComponent::Run();
   
@@ -140,6 +141,25 @@ Bool_t AliEmcalCorrectionCellTimeCalib::Run()
   
   // mark the cells not recalibrated
   fRecoUtils->ResetCellsCalibrated();
+
+  return kTRUE;
+}
+
+/**
+ * Per-event setup of the per-cell transform, replacing Run() when the cell
+ * components are fused by the correction task.
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::PrepareCellTransform()
+{
+  return PrepareCells() && PrepareRecalibrateCellValues();
+}
+
+/**
+ * Called for each event to process the event data.
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::Run()
+{
+  if (!PrepareCells()) return kFALSE;
   
   if(fCreateHisto)
     FillCellQA(fCellTimeDistBefore); // "before" QA
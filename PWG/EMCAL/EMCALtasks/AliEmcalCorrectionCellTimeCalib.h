@@ -32,12 +32,18 @@ class AliEmcalCorrectionCellTimeCalib : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Per-cell transform, see AliEmcalCorrectionComponent
+  Bool_t HasCellTransform() const { return !fCreateHisto; }
+  Bool_t PrepareCellTransform();
+  void   TransformCell(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time) { RecalibrateCellValues(absId, highGain, energy, time); }
   
 protected:
   TH1F* fCellTimeDistBefore;            //!<! cell energy distribution, before time calibration
   TH1F* fCellTimeDistAfter;             //!<! cell energy distribution, after time calibration
 
 private:
+  Bool_t     PrepareCells();
   Int_t      InitEDepTimeCalibration();
   Int_t      InitTimeCalibration();
   Int_t      InitTimeCalibrationL1Phase();
@@ -52,7 +52,9 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent() :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fBunchCrossNo(0),
+  fCellCalibrationTableRun(-1)
 
 {
   fVertex[0] = 0;
@@ -88,7 +90,9 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fBunchCrossNo(0),
+  fCellCalibrationTableRun(-1)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -209,24 +213,75 @@ void AliEmcalCorrectionComponent::UpdateCells()
   Int_t bunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
   
   if (fRecoUtils){
-    //In case of PAR run check global event ID
-    if(fRecoUtils->IsParRun()){
-      Short_t currentParIndex = 0;
-      ULong64_t globalEventID = (ULong64_t)bunchCrossNo + (ULong64_t)fEventManager.InputEvent()->GetOrbitNumber() * (ULong64_t)3564 + (ULong64_t)fEventManager.InputEvent()->GetPeriodNumber() * (ULong64_t)59793994260;
-      for(Short_t ipar=0;ipar<fRecoUtils->GetNPars();ipar++){
-        if(globalEventID >= fRecoUtils->GetGlobalIDPar(ipar)) {
-          currentParIndex++;
-        }
-      }
-      fRecoUtils->SetCurrentParNumber(currentParIndex);      
-    }
-    //end of PAR run settings
+    UpdateParNumber(bunchCrossNo);
 
     fRecoUtils->RecalibrateCells(fCaloCells, bunchCrossNo);
   }
   fCaloCells->Sort();
 }
 
+/**
+ * In case of PAR run, set the current PAR number of the reco utils from the global event ID.
+ * @param[in] bunchCrossNo Bunch crossing number of the event
+ */
+void AliEmcalCorrectionComponent::UpdateParNumber(Int_t bunchCrossNo)
+{
+  if(fRecoUtils->IsParRun()){
+    Short_t currentParIndex = 0;
+    ULong64_t globalEventID = (ULong64_t)bunchCrossNo + (ULong64_t)fEventManager.InputEvent()->GetOrbitNumber() * (ULong64_t)3564 + (ULong64_t)fEventManager.InputEvent()->GetPeriodNumber() * (ULong64_t)59793994260;
+    for(Short_t ipar=0;ipar<fRecoUtils->GetNPars();ipar++){
+      if(globalEventID >= fRecoUtils->GetGlobalIDPar(ipar)) {
+        currentParIndex++;
+      }
+    }
+    fRecoUtils->SetCurrentParNumber(currentParIndex);      
+  }
+}
+
+/**
+ * Per-event setup of RecalibrateCellValues(), the per-cell equivalent of UpdateCells(). The cell
+ * calibration table of the reco utils is rebuilt when the run changed, so it must be called once
+ * the calibration of the run is loaded.
+ * @return kFALSE if the reco utils would leave the cells unchanged
+ */
+Bool_t AliEmcalCorrectionComponent::PrepareRecalibrateCellValues()
+{
+  if (!fRecoUtils || !fEventManager.InputEvent()) return kFALSE;
+
+  // Same condition as AliEMCALRecoUtils::RecalibrateCells()
+  if (!fRecoUtils->IsRecalibrationOn() && !fRecoUtils->IsTimeRecalibrationOn() &&
+      !fRecoUtils->IsBadChannelsRemovalSwitchedOn() && !fRecoUtils->IsSingleChannelRecalibrationOn())
+    return kFALSE;
+
+  fBunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
+  UpdateParNumber(fBunchCrossNo);
+
+  if (fCellCalibrationTableRun != fRun || !fRecoUtils->HasCellCalibrationTable()) {
+    fRecoUtils->InitCellCalibrationTable();
+    fCellCalibrationTableRun = fRun;
+  }
+  return kTRUE;
+}
+
+/**
+ * Recalibrate one cell as UpdateCells() does, from the cell calibration table of the reco utils.
+ * @param[in] absId Absolute cell ID
+ * @param[in] highGain High gain cell
+ * @param[in,out] energy Cell energy, 0 if the cell is rejected
+ * @param[in,out] time Cell time, -1 if the cell is rejected
+ */
+void AliEmcalCorrectionComponent::RecalibrateCellValues(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time)
+{
+  Float_t ecell = energy;
+  if (fRecoUtils->RecalibrateCellValues(absId, fBunchCrossNo, !highGain, ecell, time)) {
+    energy = ecell;
+  }
+  else {
+    energy = 0;
+    time = -1;
+  }
+}
+
 /**
  * Check whether the run changed.
  */
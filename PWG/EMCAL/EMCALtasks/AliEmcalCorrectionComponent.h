@@ -53,9 +53,21 @@ class AliEmcalCorrectionComponent : public TNamed {
   virtual Bool_t Run();
   virtual Bool_t UserNotify();
   virtual Bool_t CheckIfRunChanged();
+
+  // Per-cell transform, run by AliEmcalCorrectionTask in one loop over the cells shared by
+  // consecutive components when "fuseCellComponents" is enabled
+  /// Whether the component can run as a per-cell transform (Run() does nothing else than modifying each cell independently)
+  virtual Bool_t HasCellTransform() const { return kFALSE; }
+  /// Per-event setup of the transform, kFALSE if the component leaves the cells unchanged in this event
+  virtual Bool_t PrepareCellTransform() { return kFALSE; }
+  /// Transform the energy and time of one cell, a rejected cell gets energy 0 and time -1
+  virtual void TransformCell(Short_t /*absId*/, Bool_t /*highGain*/, Double_t & /*energy*/, Double_t & /*time*/) {}
+  /// Called after the loop over the cells
+  virtual void FinishCellTransform() {}
   
   void GetEtaPhiDiff(const AliVTrack *t, const AliVCluster *v, Double_t &phidiff, Double_t &etadiff);
   void UpdateCells();
+  void UpdateParNumber(Int_t bunchCrossNo);
   void GetPass();
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
@@ -137,6 +149,12 @@ class AliEmcalCorrectionComponent : public TNamed {
   TString                fBasePath;                       ///< Base folder path to get root files
   TString                fCustomBadChannelFilePath;       ///< Custom path to bad channel map OADB file
 
+  Int_t                  fBunchCrossNo;                   //!<! Bunch crossing of the event, for the cell transform
+  Int_t                  fCellCalibrationTableRun;        //!<! Run of the reco utils cell calibration table
+
+  Bool_t                 PrepareRecalibrateCellValues();
+  void                   RecalibrateCellValues(Short_t absId, Bool_t highGain, Double_t & energy, Double_t & time);
+
  private:
   AliEmcalCorrectionComponent(const AliEmcalCorrectionComponent &);               // Not implemented
   AliEmcalCorrectionComponent &operator=(const AliEmcalCorrectionComponent &);    // Not implemented
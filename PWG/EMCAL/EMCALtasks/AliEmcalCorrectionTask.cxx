@@ -60,6 +60,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fBeamType(kNA),
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fFuseCellComponents(false),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -105,6 +106,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fBeamType(kNA),
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fFuseCellComponents(false),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -150,6 +152,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fBeamType(task.fBeamType),
   fForceBeamType(task.fForceBeamType),
   fNeedEmcalGeom(task.fNeedEmcalGeom),
+  fFuseCellComponents(task.fFuseCellComponents),
   fGeom(task.fGeom),
   fParticleCollArray(*(static_cast<TObjArray *>(task.fParticleCollArray.Clone()))),
   fClusterCollArray(*(static_cast<TObjArray *>(task.fClusterCollArray.Clone()))),
@@ -213,6 +216,7 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fBeamType, second.fBeamType);
   swap(first.fForceBeamType, second.fForceBeamType);
   swap(first.fNeedEmcalGeom, second.fNeedEmcalGeom);
+  swap(first.fFuseCellComponents, second.fFuseCellComponents);
   swap(first.fGeom, second.fGeom);
   swap(first.fParticleCollArray, second.fParticleCollArray);
   swap(first.fClusterCollArray, second.fClusterCollArray);
@@ -273,6 +277,7 @@ void AliEmcalCorrectionTask::Initialize(bool removeDummyTask)
 
   // Determine component execution order
   DetermineComponentsToExecute(fOrderedComponentsToExecute);
+  fYAMLConfig.GetProperty("fuseCellComponents", fFuseCellComponents, false);
 
   // Check for user defined settings that are not in the default file
   CheckForUnmatchedUserSettings();
@@ -1313,8 +1318,29 @@ Bool_t AliEmcalCorrectionTask::Run()
     component->SetCentralityBin(fCentBin);
     component->SetCentrality(fCent);
     component->SetVertex(fVertex);
+  }
 
-    component->Run();
+  std::size_t iComponent = 0;
+  while (iComponent < fCorrectionComponents.size())
+  {
+    // Find the consecutive per-cell components acting on the same cells
+    std::size_t iLast = iComponent;
+    AliVCaloCells * cells = fCorrectionComponents[iComponent]->GetCaloCells();
+    if (fFuseCellComponents && cells && fCorrectionComponents[iComponent]->HasCellTransform()) {
+      while (iLast + 1 < fCorrectionComponents.size() &&
+             fCorrectionComponents[iLast + 1]->HasCellTransform() &&
+             fCorrectionComponents[iLast + 1]->GetCaloCells() == cells) {
+        iLast++;
+      }
+    }
+
+    if (iLast > iComponent) {
+      RunFusedCellComponents(iComponent, iLast);
+    }
+    else {
+      fCorrectionComponents[iComponent]->Run();
+    }
+    iComponent = iLast + 1;
   }
 
   PostData(1, fOutput);
@@ -1322,6 +1348,54 @@ Bool_t AliEmcalCorrectionTask::Run()
   return kTRUE;
 }
 
+/**
+ * Run the per-cell components first to last, which share the same cells, in one loop over the cells
+ * instead of one loop per component. Each cell goes through the transforms of the components in the
+ * execution order, so the result is the same as running them one after the other.
+ *
+ * @param[in] first Index of the first component in fCorrectionComponents
+ * @param[in] last Index of the last component in fCorrectionComponents
+ */
+void AliEmcalCorrectionTask::RunFusedCellComponents(std::size_t first, std::size_t last)
+{
+  // Components leaving the cells unchanged in this event are skipped
+  std::vector <AliEmcalCorrectionComponent *> components;
+  for (std::size_t iComponent = first; iComponent <= last; iComponent++)
+  {
+    if (fCorrectionComponents[iComponent]->PrepareCellTransform()) {
+      components.push_back(fCorrectionComponents[iComponent]);
+    }
+  }
+  if (components.empty()) return;
+
+  AliVCaloCells * cells = fCorrectionComponents[first]->GetCaloCells();
+
+  Short_t  absId  =-1;
+  Double_t ecell = 0;
+  Double_t tcell = 0;
+  Double_t efrac = 0;
+  Int_t  mclabel = -1;
+
+  for (Int_t iCell = 0; iCell < cells->GetNumberOfCells(); iCell++)
+  {
+    cells->GetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+
+    // NOTE: GetCellHighGain() uses the cell position, not cell index, and thus should _NOT_ be used!
+    Bool_t cellHighGain = cells->GetHighGain(iCell);
+
+    for (auto component : components) {
+      component->TransformCell(absId, cellHighGain, ecell, tcell);
+    }
+
+    cells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac, cellHighGain);
+  }
+  cells->Sort();
+
+  for (auto component : components) {
+    component->FinishCellTransform();
+  }
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  */
@@ -191,6 +191,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void RunFusedCellComponents(std::size_t first, std::size_t last);
 
   // Initialization functions
   void InitializeConfiguration();
@@ -240,6 +241,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   BeamType                    fBeamType;                   //!<! Event beam type
   BeamType                    fForceBeamType;              ///< forced beam type
   Bool_t                      fNeedEmcalGeom;              ///< whether or not the task needs the emcal geometry
+  bool                        fFuseCellComponents;         ///< Run consecutive per-cell components in one loop over the cells
   AliEMCALGeometry           *fGeom;                       //!<! Emcal geometry
 
   TObjArray                   fParticleCollArray;          ///< Particle/track collection array
@@ -249,7 +251,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 9); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 10); // EMCal correction task
   /// \endcond
 };
 
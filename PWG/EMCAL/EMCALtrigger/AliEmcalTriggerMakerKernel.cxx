@@ -93,6 +93,7 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fSmearedEnergyIntegral(),
   fADCtoGeV(1.)
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
@@ -577,6 +578,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     }
   }
   outputcont.clear();
+  if(fPatchEnergySimpleSmeared) BuildSmearedEnergyIntegral();
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = patches.begin(); patchit != patches.end(); ++patchit){
     // Apply offline and recalc selection
     // Remove unwanted bits from the online bits (gamma bits from jet patches and vice versa)
@@ -616,12 +618,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -647,12 +644,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       fullpatch.SetSmearedEnergy(energysmear);
     }
     outputcont.push_back(fullpatch);
@@ -660,6 +652,26 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   // std::cout << "Finished finding trigger patches" << std::endl;
 }
 
+void AliEmcalTriggerMakerKernel::BuildSmearedEnergyIntegral(){
+  // entry (col, row) holds the sum of the smeared energy of all FastORs with lower column and lower row
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows();
+  const int stride = ncols + 1;
+  fSmearedEnergyIntegral.assign(stride * (nrows + 1), 0.);
+  for(int irow = 0; irow < nrows; irow++){
+    double rowsum = 0;
+    for(int icol = 0; icol < ncols; icol++){
+      rowsum += (*fPatchEnergySimpleSmeared)(icol, irow);
+      fSmearedEnergyIntegral[(irow + 1) * stride + icol + 1] = fSmearedEnergyIntegral[irow * stride + icol + 1] + rowsum;
+    }
+  }
+}
+
+double AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const {
+  const int stride = fPatchEnergySimpleSmeared->GetNumberOfCols() + 1;
+  return fSmearedEnergyIntegral[(row + size) * stride + col + size] - fSmearedEnergyIntegral[row * stride + col + size]
+       - fSmearedEnergyIntegral[(row + size) * stride + col]        + fSmearedEnergyIntegral[row * stride + col];
+}
+
 double AliEmcalTriggerMakerKernel::GetL0TriggerChannelAmplitude(Int_t col, Int_t row) const{
   double amp = 0;
   try {
@@ -572,6 +572,21 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Fill the summed-area table of the smeared energy map
+   */
+  void BuildSmearedEnergyIntegral();
+
+  /**
+   * Sum of the smeared energy in a square patch, from the summed-area table
+   * (four lookups independent of the patch size)
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Size of the patch
+   * @return Smeared energy of the patch
+   */
+  double GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -616,6 +631,7 @@ protected:
   AliEMCALTriggerDataGrid<double>           *fPatchEnergySimpleSmeared;   //!<! Data grid for smeared energy values from cell energies
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
+  std::vector<double>                       fSmearedEnergyIntegral;       //!<! Summed-area table of the smeared energy map
   Double_t                                  fRhoValues[kNIndRho];         //!<! Rho values for background subtraction (only online ADC)
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
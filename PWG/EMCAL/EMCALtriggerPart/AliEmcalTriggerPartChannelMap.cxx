@@ -42,10 +42,13 @@ AliEmcalTriggerPartChannelMap::AliEmcalTriggerPartChannelMap(int ncols, int nrow
     TObject(),
     fNADCCols(ncols),
     fNADCRows(nrows),
-    fADC(NULL)
+    fADC(NULL),
+    fIntegral(NULL),
+    fIntegralValid(false)
 {
   fADC = new double[fNADCCols * fNADCRows];
   memset(fADC, 0, sizeof(double) * fNADCCols * fNADCRows);
+  fIntegral = new double[(fNADCCols + 1) * (fNADCRows + 1)];
 }
 
 /**
@@ -53,6 +56,7 @@ AliEmcalTriggerPartChannelMap::AliEmcalTriggerPartChannelMap(int ncols, int nrow
  */
 AliEmcalTriggerPartChannelMap::~AliEmcalTriggerPartChannelMap() {
   delete[] fADC;
+  delete[] fIntegral;
 }
 
 /**
@@ -65,6 +69,7 @@ void AliEmcalTriggerPartChannelMap::SetADC(int col, int row, double adc) {
   if(row >= fNADCRows || col >= fNADCCols)
 	  throw BoundaryException(row, col, fNADCRows, fNADCCols);
   fADC[GetIndexInArray(col, row)] = adc;
+  fIntegralValid = false;
 }
 
 /**
@@ -77,6 +82,7 @@ void AliEmcalTriggerPartChannelMap::AddADC(int col, int row, double adc) {
   if(row >= fNADCRows || col >= fNADCCols)
 	  throw BoundaryException(row, col, fNADCRows, fNADCCols);
   fADC[GetIndexInArray(col, row)] += adc;
+  fIntegralValid = false;
 }
 
 /**
@@ -84,6 +90,7 @@ void AliEmcalTriggerPartChannelMap::AddADC(int col, int row, double adc) {
  */
 void AliEmcalTriggerPartChannelMap::Reset() {
   memset(fADC, 0, sizeof(double) * fNADCCols * fNADCRows);
+  fIntegralValid = false;
 }
 
 /**
@@ -97,3 +104,41 @@ double AliEmcalTriggerPartChannelMap::GetADC(int col, int row) const {
 	  throw BoundaryException(row, col, fNADCRows, fNADCCols);
   return fADC[GetIndexInArray(col, row)];
 }
+
+/**
+ * Get the sum of the ADC values in the patch of ncols x nrows channels
+ * starting at position (col, row). Uses the summed-area table of the map,
+ * built on the first call after the ADC values changed, so that the sum
+ * costs four lookups whatever the size of the patch. Checks for boundary.
+ * @param col Column of the lower corner of the patch
+ * @param row Row of the lower corner of the patch
+ * @param ncols Number of columns of the patch
+ * @param nrows Number of rows of the patch
+ * @return Sum of the ADC values in the patch
+ */
+double AliEmcalTriggerPartChannelMap::GetPatchADC(int col, int row, int ncols, int nrows) const {
+  if(col < 0 || row < 0 || row + nrows > fNADCRows || col + ncols > fNADCCols)
+	  throw BoundaryException(row + nrows - 1, col + ncols - 1, fNADCRows, fNADCCols);
+  if(!fIntegralValid) BuildIntegral();
+  const int stride = fNADCCols + 1;
+  return fIntegral[(row + nrows) * stride + col + ncols] - fIntegral[row * stride + col + ncols]
+       - fIntegral[(row + nrows) * stride + col]         + fIntegral[row * stride + col];
+}
+
+/**
+ * Fill the summed-area table: the entry (col, row) holds the sum of the
+ * ADC values of all channels with lower column and lower row.
+ */
+void AliEmcalTriggerPartChannelMap::BuildIntegral() const {
+  const int stride = fNADCCols + 1;
+  memset(fIntegral, 0, sizeof(double) * stride);
+  for(int row = 0; row < fNADCRows; row++){
+    double rowsum = 0;
+    fIntegral[(row + 1) * stride] = 0;
+    for(int col = 0; col < fNADCCols; col++){
+      rowsum += fADC[GetIndexInArray(col, row)];
+      fIntegral[(row + 1) * stride + col + 1] = fIntegral[row * stride + col + 1] + rowsum;
+    }
+  }
+  fIntegralValid = true;
+}
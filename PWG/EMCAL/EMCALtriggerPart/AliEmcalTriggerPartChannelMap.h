@@ -89,6 +89,7 @@ public:
 	void SetADC(int col, int row, double adc);
 	void AddADC(int col, int row, double adc);
 	double GetADC(int col, int row) const;
+	double GetPatchADC(int col, int row, int ncols, int nrows) const;
 	/**
 	 * Get the number of columns in the map
 	 * @return The number of colums
@@ -103,9 +104,12 @@ public:
 protected:
 
 	inline int GetIndexInArray(int col, int row) const;
+	void BuildIntegral() const;
 	int                     fNADCCols;      ///< Number of columns
 	int                     fNADCRows;      ///< Number of rows
 	double                  *fADC;          ///< Array of Trigger ADC values
+	double                  *fIntegral;     //!<! Summed-area table of the ADC values, (fNADCCols+1) x (fNADCRows+1)
+	mutable bool            fIntegralValid; //!<! Summed-area table up to date with the ADC values
 
 	ClassDef(AliEmcalTriggerPartChannelMap, 1);
 };
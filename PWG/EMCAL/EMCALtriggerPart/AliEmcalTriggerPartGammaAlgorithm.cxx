@@ -50,7 +50,7 @@ AliEmcalTriggerPartGammaAlgorithm::~AliEmcalTriggerPartGammaAlgorithm() {
 /**
  * Gamma trigger algorithm
  * 1. Loop over all rows (- patchsize) to get the starting position of the patch
- * 2. Loop over ADC values in the 2x2 window
+ * 2. Sum of the ADC values in the 2x2 window, from the summed-area table of the channel map
  * 3. Sorting of the trigger patches so that the highest energetic patch (main patch is the first)
  * 4. Fill the output trigger object
  * @param channes Input channel map
@@ -63,10 +63,7 @@ std::vector<AliEmcalTriggerPartRawPatch> AliEmcalTriggerPartGammaAlgorithm::Find
 	for(unsigned char irow = 0; irow < channels->GetNumberOfRows() - 1; ++irow){
 		for(unsigned char icol = 0; icol < channels->GetNumberOfCols() - 1; ++icol){
 			// 2x2 window
-			adcsum = 0;
-			for(unsigned char jrow = 0; jrow < 2; jrow++)
-				for(unsigned char jcol = 0; jcol < 2; jcol++)
-					adcsum += channels->GetADC(icol + jcol, irow + jrow);
+			adcsum = channels->GetPatchADC(icol, irow, 2, 2);
 
 			// make decision, low and high threshold
 			int triggerBits(0);
@@ -50,7 +50,7 @@ AliEmcalTriggerPartJetAlgorithm::~AliEmcalTriggerPartJetAlgorithm() {
 /**
  * Gamma trigger algorithm
  * 1. Loop over all rows (- patchsize) to get the starting position of the patch
- * 2. Loop over ADC values in the 16x16 window
+ * 2. Sum of the ADC values in the 16x16 window, from the summed-area table of the channel map
  * 3. Sorting of the trigger patches so that the highest energetic patch (main patch is the first)
  * 4. Fill the output trigger object
  * @param channes Input channel map
@@ -63,10 +63,7 @@ std::vector<AliEmcalTriggerPartRawPatch> AliEmcalTriggerPartJetAlgorithm::FindPa
 	for(unsigned char irow = 0; irow < channels->GetNumberOfRows() - 15; irow+=4){
 		for(unsigned char icol = 0; icol < channels->GetNumberOfCols() - 15; icol+=4){
 			// 16x16 window
-			adcsum = 0;
-			for(unsigned char jrow = 0; jrow < 16; jrow++)
-				for(unsigned char jcol = 0; jcol < 16; jcol++)
-					adcsum += channels->GetADC(icol + jcol, irow + jrow);
+			adcsum = channels->GetPatchADC(icol, irow, 16, 16);
 
 			// make decision, low and high threshold
 			int triggerBits(0);
@@ -94,10 +91,7 @@ std::vector<AliEmcalTriggerPartRawPatch> AliEmcalTriggerPartJetAlgorithm::FindPa
 	for(unsigned char irow = 0; irow < channels->GetNumberOfRows() - 8-1; irow+=4){
 		for(unsigned char icol = 0; icol < channels->GetNumberOfCols() - 8-1; icol+=4){
 			// 8x8 window
-			adcsum = 0;
-			for(unsigned char jrow = 0; jrow < 8; jrow++)
-				for(unsigned char jcol = 0; jcol < 8; jcol++)
-					adcsum += channels->GetADC(icol + jcol, irow + jrow);
+			adcsum = channels->GetPatchADC(icol, irow, 8, 8);
 
 			// make decision, low and high threshold
 			int triggerBits(0);
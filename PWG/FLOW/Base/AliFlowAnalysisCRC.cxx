@@ -764,6 +764,13 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
     }
   }
 
+  // harmonics and powers of particle weights needed per track in the loop below (see CalculateTrackHarmonics()):
+  Int_t nMaxHar = TMath::Max(TMath::Max(12*n,20),TMath::Max(TMath::Max(fCRCnHar,fFlowNHarmMax),6));
+  Int_t nMaxPow = TMath::Max(TMath::Max(8,fCRCnHar),TMath::Max(fQVecPower,fFlowNHarmMax+1));
+  fTrackCosH.resize(nMaxHar+1);
+  fTrackSinH.resize(nMaxHar+1);
+  fTrackWPow.resize(nMaxPow+1);
+
   // loop over particles **********************************************************************************************
 
   for(Int_t i=0;i<nPrim;i++) {
@@ -839,13 +846,15 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           if(fPhiExclZoneHist->GetBinContent(fPhiExclZoneHist->FindBin(dEta,dPhi))<0.5) continue;
         }
 
+        this->CalculateTrackHarmonics(dPhi,wPhiEta*wPhi*wPt*wEta*wTrack);
+
         // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
         for(Int_t m=0;m<12;m++) // to be improved - hardwired 6
         {
           for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
           {
-            (*fReQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi);
-            (*fImQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi);
+            (*fReQ)(m,k)+=fTrackWPow[k]*fTrackCosH[(m+1)*n];
+            (*fImQ)(m,k)+=fTrackWPow[k]*fTrackSinH[(m+1)*n];
           }
         }
         // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
@@ -853,7 +862,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         {
           for(Int_t k=0;k<9;k++)
           {
-            (*fSpk)(p,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k);
+            (*fSpk)(p,k)+=fTrackWPow[k];
           }
         }
         // Differential flow:
@@ -870,21 +879,21 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
               {
                 for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
                 {
-                  fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                  fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                  fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],fTrackWPow[k]*fTrackCosH[(m+1)*n],1.);
+                  fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],fTrackWPow[k]*fTrackSinH[(m+1)*n],1.);
                   if(m==0) // s_{p,k} does not depend on index m
                   {
-                    fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                    fs1dEBE[0][pe][k]->Fill(ptEta[pe],fTrackWPow[k],1.);
                   } // end of if(m==0) // s_{p,k} does not depend on index m
                 } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
               } // end of if(fCalculateDiffFlow)
               if(fCalculate2DDiffFlow)
               {
-                fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,fTrackWPow[k]*fTrackCosH[(m+1)*n],1.);
+                fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,fTrackWPow[k]*fTrackSinH[(m+1)*n],1.);
                 if(m==0) // s_{p,k} does not depend on index m
                 {
-                  fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                  fs2dEBE[0][k]->Fill(dPt,dEta,fTrackWPow[k],1.);
                 } // end of if(m==0) // s_{p,k} does not depend on index m
               } // end of if(fCalculate2DDiffFlow)
             } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -901,21 +910,21 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
                 {
                   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
                   {
-                    fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                    fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                    fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],fTrackWPow[k]*fTrackCosH[(m+1)*n],1.);
+                    fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],fTrackWPow[k]*fTrackSinH[(m+1)*n],1.);
                     if(m==0) // s_{p,k} does not depend on index m
                     {
-                      fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                      fs1dEBE[2][pe][k]->Fill(ptEta[pe],fTrackWPow[k],1.);
                     } // end of if(m==0) // s_{p,k} does not depend on index m
                   } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
                 } // end of if(fCalculateDiffFlow)
                 if(fCalculate2DDiffFlow)
                 {
-                  fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                  fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                  fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,fTrackWPow[k]*fTrackCosH[(m+1)*n],1.);
+                  fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,fTrackWPow[k]*fTrackSinH[(m+1)*n],1.);
                   if(m==0) // s_{p,k} does not depend on index m
                   {
-                    fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                    fs2dEBE[2][k]->Fill(dPt,dEta,fTrackWPow[k],1.);
                   } // end of if(m==0) // s_{p,k} does not depend on index m
                 } // end of if(fCalculate2DDiffFlow)
               } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -1013,6 +1022,9 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           if(dPhi>2.136283 && dPhi<2.324779) continue;
         }
 
+        // (wPhi, wPt, wEta and wTrack are 1 here, the powers of the weight are those of wPhiEta)
+        this->CalculateTrackHarmonics(dPhi,wPhiEta*wPhi*wPt*wEta*wTrack);
+
         // Generic Framework: Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
         Double_t MaxPtCut = 3.;
         if(fMinMulZN==99) MaxPtCut = 1.;
@@ -1021,8 +1033,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           {
             for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
             {
-              (*fReQGF)(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos(m*dPhi);
-              (*fImQGF)(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin(m*dPhi);
+              (*fReQGF)(m,k) += fTrackWPow[k]*fTrackCosH[m];
+              (*fImQGF)(m,k) += fTrackWPow[k]*fTrackSinH[m];
             }
           }
         }
@@ -1040,8 +1052,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           {
             for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
             {
-              (*fReQGFPt[ptb])(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos(m*dPhi);
-              (*fImQGFPt[ptb])(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin(m*dPhi);
+              (*fReQGFPt[ptb])(m,k) += fTrackWPow[k]*fTrackCosH[m];
+              (*fImQGFPt[ptb])(m,k) += fTrackWPow[k]*fTrackSinH[m];
             }
           }
         }
@@ -1057,14 +1069,14 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
             {
               for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
               {
-                fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],fTrackWPow[k]*fTrackCosH[(m+1)*n],1.);
+                fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],fTrackWPow[k]*fTrackSinH[(m+1)*n],1.);
               } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
             } // end of if(fCalculateDiffFlow)
             if(fCalculate2DDiffFlow)
             {
-              fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-              fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+              fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,fTrackWPow[k]*fTrackCosH[(m+1)*n],1.);
+              fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,fTrackWPow[k]*fTrackSinH[(m+1)*n],1.);
             } // end of if(fCalculate2DDiffFlow)
           } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
         } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
@@ -1072,31 +1084,31 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         // Charge-Rapidity Correlations
         for (Int_t h=0;h<fCRCnHar;h++) {
 
-          fCRCQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fCRCQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+          fCRCQRe[cw][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+          fCRCQIm[cw][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
           fCRCMult[cw][h]->Fill(dEta,wPhiEta);
 
-          fCRC2QRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fCRC2QIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-          fCRC2Mul[cw][h]->Fill(dEta,pow(wPhiEta,h));
+          fCRC2QRe[cw][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+          fCRC2QIm[cw][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
+          fCRC2Mul[cw][h]->Fill(dEta,fTrackWPow[h]);
 
-          fCRCZDCQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fCRCZDCQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+          fCRCZDCQRe[cw][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+          fCRCZDCQIm[cw][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
           fCRCZDCMult[cw][h]->Fill(dEta,wPhiEta);
 
           if(fRandom->Integer(2)>0.5) {
-            fCRC2QRe[2][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCRC2QIm[2][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-            fCRC2Mul[2][h]->Fill(dEta,pow(wPhiEta,h));
+            fCRC2QRe[2][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+            fCRC2QIm[2][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
+            fCRC2Mul[2][h]->Fill(dEta,fTrackWPow[h]);
           }
 
           if(fRandom->Integer(2)>0.5) {
-            fCRCZDCQRe[2][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCRCZDCQIm[2][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCRCZDCQRe[2][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+            fCRCZDCQIm[2][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
             fCRCZDCMult[2][h]->Fill(dEta,wPhiEta);
           } else {
-            fCRCZDCQRe[3][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCRCZDCQIm[3][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCRCZDCQRe[3][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+            fCRCZDCQIm[3][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
             fCRCZDCMult[3][h]->Fill(dEta,wPhiEta);
           }
 
@@ -1113,19 +1125,19 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
               Double_t weraw = fZDCESESpecWeightsHist[fZDCESEclEbE]->GetBinContent(fZDCESESpecWeightsHist[fZDCESEclEbE]->FindBin(fCentralityEBE,dPt));
               if(weraw > 0.) SpecWeig = 1./weraw;
             }
-            fCMEQRe[cw][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCMEQIm[cw][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCMEQRe[cw][h]->Fill(dEta,SpecWeig*wPhiEta*fTrackCosH[h+1]);
+            fCMEQIm[cw][h]->Fill(dEta,SpecWeig*wPhiEta*fTrackSinH[h+1]);
             fCMEMult[cw][h]->Fill(dEta,SpecWeig*wPhiEta);
-            fCMEQRe[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Cos((h+1.)*dPhi));
-            fCMEQIm[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Sin((h+1.)*dPhi));
+            fCMEQRe[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*fTrackCosH[h+1]);
+            fCMEQIm[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*fTrackSinH[h+1]);
             fCMEMult[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.));
             
             //@shi add histogram for both charges
-            fCMEQReBothCharge[0][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCMEQImBothCharge[0][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCMEQReBothCharge[0][h]->Fill(dEta,SpecWeig*wPhiEta*fTrackCosH[h+1]);
+            fCMEQImBothCharge[0][h]->Fill(dEta,SpecWeig*wPhiEta*fTrackSinH[h+1]);
             fCMEMultBothCharge[0][h]->Fill(dEta,SpecWeig*wPhiEta);
-            fCMEQReBothCharge[1][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Cos((h+1.)*dPhi));
-            fCMEQImBothCharge[1][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Sin((h+1.)*dPhi));
+            fCMEQReBothCharge[1][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*fTrackCosH[h+1]);
+            fCMEQImBothCharge[1][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*fTrackSinH[h+1]);
             fCMEMultBothCharge[1][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.));
 			
             // spectra
@@ -1142,42 +1154,42 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
 
             if(fFlowQCDeltaEta>0.) {
 
-              fPOIPtDiffQRe[k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-              fPOIPtDiffQIm[k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-              fPOIPtDiffMul[k][h]->Fill(dPt,pow(wPhiEta,k));
+              fPOIPtDiffQRe[k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+              fPOIPtDiffQIm[k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+              fPOIPtDiffMul[k][h]->Fill(dPt,fTrackWPow[k]);
 
-              fPOIPtDiffQReCh[cw][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-              fPOIPtDiffQImCh[cw][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-              fPOIPtDiffMulCh[cw][k][h]->Fill(dPt,pow(wPhiEta,k));
+              fPOIPtDiffQReCh[cw][k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+              fPOIPtDiffQImCh[cw][k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+              fPOIPtDiffMulCh[cw][k][h]->Fill(dPt,fTrackWPow[k]);
 
-              fPOIPhiDiffQRe[k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-              fPOIPhiDiffQIm[k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-              fPOIPhiDiffMul[k][h]->Fill(dPhi,pow(wPhiEta,k));
+              fPOIPhiDiffQRe[k][h]->Fill(dPhi,fTrackWPow[k]*fTrackCosH[h+1]);
+              fPOIPhiDiffQIm[k][h]->Fill(dPhi,fTrackWPow[k]*fTrackSinH[h+1]);
+              fPOIPhiDiffMul[k][h]->Fill(dPhi,fTrackWPow[k]);
 
-              fPOIPhiEtaDiffQRe[k][h]->Fill(dPhi,dEta,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-              fPOIPhiEtaDiffQIm[k][h]->Fill(dPhi,dEta,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-              fPOIPhiEtaDiffMul[k][h]->Fill(dPhi,dEta,pow(wPhiEta,k));
+              fPOIPhiEtaDiffQRe[k][h]->Fill(dPhi,dEta,fTrackWPow[k]*fTrackCosH[h+1]);
+              fPOIPhiEtaDiffQIm[k][h]->Fill(dPhi,dEta,fTrackWPow[k]*fTrackSinH[h+1]);
+              fPOIPhiEtaDiffMul[k][h]->Fill(dPhi,dEta,fTrackWPow[k]);
 
               if(fabs(dEta)>fFlowQCDeltaEta/2.) {
                 Int_t keta = (dEta<0.?0:1);
-                fPOIPtDiffQReEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                fPOIPtDiffQImEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                fPOIPtDiffMulEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k));
-                fPOIPhiDiffQReEG[keta][k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                fPOIPhiDiffQImEG[keta][k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                fPOIPhiDiffMulEG[keta][k][h]->Fill(dPhi,pow(wPhiEta,k));
+                fPOIPtDiffQReEG[keta][k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+                fPOIPtDiffQImEG[keta][k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+                fPOIPtDiffMulEG[keta][k][h]->Fill(dPt,fTrackWPow[k]);
+                fPOIPhiDiffQReEG[keta][k][h]->Fill(dPhi,fTrackWPow[k]*fTrackCosH[h+1]);
+                fPOIPhiDiffQImEG[keta][k][h]->Fill(dPhi,fTrackWPow[k]*fTrackSinH[h+1]);
+                fPOIPhiDiffMulEG[keta][k][h]->Fill(dPhi,fTrackWPow[k]);
               }
 
             } else if(fFlowQCDeltaEta<0. && fFlowQCDeltaEta>-1.) {
 
               if(dEta>0.) {
-                fPOIPtDiffQRe[k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                fPOIPtDiffQIm[k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                fPOIPtDiffMul[k][h]->Fill(dPt,pow(wPhiEta,k));
+                fPOIPtDiffQRe[k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+                fPOIPtDiffQIm[k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+                fPOIPtDiffMul[k][h]->Fill(dPt,fTrackWPow[k]);
 
-                fPOIPhiDiffQRe[k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                fPOIPhiDiffQIm[k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                fPOIPhiDiffMul[k][h]->Fill(dPhi,pow(wPhiEta,k));
+                fPOIPhiDiffQRe[k][h]->Fill(dPhi,fTrackWPow[k]*fTrackCosH[h+1]);
+                fPOIPhiDiffQIm[k][h]->Fill(dPhi,fTrackWPow[k]*fTrackSinH[h+1]);
+                fPOIPhiDiffMul[k][h]->Fill(dPhi,fTrackWPow[k]);
 
                 Double_t boundetagap = fabs(fFlowQCDeltaEta);
 
@@ -1185,9 +1197,9 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
                   Int_t keta;
                   if(dEta>0. && dEta<0.4-boundetagap/2.) keta = 0;
                   else keta = 1;
-                  fPOIPtDiffQReEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                  fPOIPtDiffQImEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                  fPOIPtDiffMulEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k));
+                  fPOIPtDiffQReEG[keta][k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+                  fPOIPtDiffQImEG[keta][k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+                  fPOIPtDiffMulEG[keta][k][h]->Fill(dPt,fTrackWPow[k]);
                 }
               } else {
                 bFillDis = kFALSE;
@@ -1197,13 +1209,13 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
             } else if(fFlowQCDeltaEta<-1. && fFlowQCDeltaEta>-2.) {
 
               if(dEta<0.) {
-                fPOIPtDiffQRe[k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                fPOIPtDiffQIm[k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                fPOIPtDiffMul[k][h]->Fill(dPt,pow(wPhiEta,k));
+                fPOIPtDiffQRe[k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+                fPOIPtDiffQIm[k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+                fPOIPtDiffMul[k][h]->Fill(dPt,fTrackWPow[k]);
 
-                fPOIPhiDiffQRe[k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                fPOIPhiDiffQIm[k][h]->Fill(dPhi,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                fPOIPhiDiffMul[k][h]->Fill(dPhi,pow(wPhiEta,k));
+                fPOIPhiDiffQRe[k][h]->Fill(dPhi,fTrackWPow[k]*fTrackCosH[h+1]);
+                fPOIPhiDiffQIm[k][h]->Fill(dPhi,fTrackWPow[k]*fTrackSinH[h+1]);
+                fPOIPhiDiffMul[k][h]->Fill(dPhi,fTrackWPow[k]);
 
                 Double_t boundetagap = fabs(fFlowQCDeltaEta)-1.;
 
@@ -1211,9 +1223,9 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
                   Int_t keta;
                   if(dEta<0. && dEta>-0.4+boundetagap/2.) keta = 0;
                   else keta = 1;
-                  fPOIPtDiffQReEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Cos((h+1.)*dPhi));
-                  fPOIPtDiffQImEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k)*TMath::Sin((h+1.)*dPhi));
-                  fPOIPtDiffMulEG[keta][k][h]->Fill(dPt,pow(wPhiEta,k));
+                  fPOIPtDiffQReEG[keta][k][h]->Fill(dPt,fTrackWPow[k]*fTrackCosH[h+1]);
+                  fPOIPtDiffQImEG[keta][k][h]->Fill(dPt,fTrackWPow[k]*fTrackSinH[h+1]);
+                  fPOIPtDiffMulEG[keta][k][h]->Fill(dPt,fTrackWPow[k]);
                 }
               } else {
                 bFillDis = kFALSE;
@@ -1225,11 +1237,11 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         }
 
         for (Int_t h=0;h<fFlowNHarmMax;h++) {
-          fEtaDiffQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fEtaDiffQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-          fEtaDiffMul[cw][h]->Fill(dEta,pow(wPhiEta,h+1));
-          fPOIEtaPtQRe[cw][h]->Fill(dEta,dPt,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fPOIEtaPtQIm[cw][h]->Fill(dEta,dPt,wPhiEta*TMath::Sin((h+1.)*dPhi));
+          fEtaDiffQRe[cw][h]->Fill(dEta,wPhiEta*fTrackCosH[h+1]);
+          fEtaDiffQIm[cw][h]->Fill(dEta,wPhiEta*fTrackSinH[h+1]);
+          fEtaDiffMul[cw][h]->Fill(dEta,fTrackWPow[h+1]);
+          fPOIEtaPtQRe[cw][h]->Fill(dEta,dPt,wPhiEta*fTrackCosH[h+1]);
+          fPOIEtaPtQIm[cw][h]->Fill(dEta,dPt,wPhiEta*fTrackSinH[h+1]);
           fPOIEtaPtMul[cw][h]->Fill(dEta,dPt,wPhiEta);
         }
 
@@ -1242,14 +1254,14 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
 
         if(bFillDis && bPassZDCcuts && fCalculateFlowZDC && fUseZDC) {
 
-          fFlowSPZDCv1etaPro[fCenBin][0][7]->Fill(dEta,TMath::Cos(dPhi)*ZARe+TMath::Sin(dPhi)*ZAIm,wPhiEta);
-          fFlowSPZDCv1etaPro[fCenBin][0][8]->Fill(dEta,TMath::Cos(dPhi)*ZCRe+TMath::Sin(dPhi)*ZCIm,wPhiEta);
+          fFlowSPZDCv1etaPro[fCenBin][0][7]->Fill(dEta,fTrackCosH[1]*ZARe+fTrackSinH[1]*ZAIm,wPhiEta);
+          fFlowSPZDCv1etaPro[fCenBin][0][8]->Fill(dEta,fTrackCosH[1]*ZCRe+fTrackSinH[1]*ZCIm,wPhiEta);
           if(cw==0) {
-            fFlowSPZDCv1etaPro[fCenBin][0][9]->Fill(dEta,TMath::Cos(dPhi)*ZARe+TMath::Sin(dPhi)*ZAIm,wPhiEta);
-            fFlowSPZDCv1etaPro[fCenBin][0][10]->Fill(dEta,TMath::Cos(dPhi)*ZCRe+TMath::Sin(dPhi)*ZCIm,wPhiEta);
+            fFlowSPZDCv1etaPro[fCenBin][0][9]->Fill(dEta,fTrackCosH[1]*ZARe+fTrackSinH[1]*ZAIm,wPhiEta);
+            fFlowSPZDCv1etaPro[fCenBin][0][10]->Fill(dEta,fTrackCosH[1]*ZCRe+fTrackSinH[1]*ZCIm,wPhiEta);
           } else {
-            fFlowSPZDCv1etaPro[fCenBin][0][11]->Fill(dEta,TMath::Cos(dPhi)*ZARe+TMath::Sin(dPhi)*ZAIm,wPhiEta);
-            fFlowSPZDCv1etaPro[fCenBin][0][12]->Fill(dEta,TMath::Cos(dPhi)*ZCRe+TMath::Sin(dPhi)*ZCIm,wPhiEta);
+            fFlowSPZDCv1etaPro[fCenBin][0][11]->Fill(dEta,fTrackCosH[1]*ZARe+fTrackSinH[1]*ZAIm,wPhiEta);
+            fFlowSPZDCv1etaPro[fCenBin][0][12]->Fill(dEta,fTrackCosH[1]*ZCRe+fTrackSinH[1]*ZCIm,wPhiEta);
           }
 
         }
@@ -1261,8 +1273,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         fCRCQVecPhiRbRHist[fRunBin]->Fill(fCentralityEBE,dPhi,dEta,wPhiEta);
         fCRCQVecPhiRbRHistCh[fRunBin][cw]->Fill(fCentralityEBE,dPhi,dEta,wPhiEta);
         for (Int_t h=0;h<6;h++) {
-          fCRCQVecHarCosProCh[cw]->Fill(fCentralityEBE,(Double_t)h+0.5,dEta,TMath::Cos((h+1.)*dPhi),wPhiEta);
-          fCRCQVecHarSinProCh[cw]->Fill(fCentralityEBE,(Double_t)h+0.5,dEta,TMath::Sin((h+1.)*dPhi),wPhiEta);
+          fCRCQVecHarCosProCh[cw]->Fill(fCentralityEBE,(Double_t)h+0.5,dEta,fTrackCosH[h+1],wPhiEta);
+          fCRCQVecHarSinProCh[cw]->Fill(fCentralityEBE,(Double_t)h+0.5,dEta,fTrackSinH[h+1],wPhiEta);
         }
         Double_t FillCw = (fbFlagIsPosMagField==kTRUE?(cw==0?0.5:1.5):(cw==0?2.5:3.5));
         if(fCentralityEBE>5. && fCentralityEBE<40.) {
@@ -8325,6 +8337,34 @@ Bool_t AliFlowAnalysisCRC::MultCut2015o()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisCRC::CalculateTrackHarmonics(Double_t dPhi, Double_t w)
+{
+  // Fill cos(h*phi), sin(h*phi) and w^k for the current track, for all harmonics
+  // and powers used in the loop over particles in Make(). Only cos(phi) and sin(phi)
+  // are evaluated, higher harmonics follow from e^{i(h+1)phi} = e^{ih*phi}*e^{i*phi}.
+
+  Int_t nHar = fTrackCosH.size();
+  Int_t nPow = fTrackWPow.size();
+  if(nHar>0) {
+    fTrackCosH[0] = 1.;
+    fTrackSinH[0] = 0.;
+  }
+  if(nHar>1) {
+    fTrackCosH[1] = TMath::Cos(dPhi);
+    fTrackSinH[1] = TMath::Sin(dPhi);
+  }
+  for(Int_t h=2; h<nHar; h++) {
+    fTrackCosH[h] = fTrackCosH[h-1]*fTrackCosH[1]-fTrackSinH[h-1]*fTrackSinH[1];
+    fTrackSinH[h] = fTrackSinH[h-1]*fTrackCosH[1]+fTrackCosH[h-1]*fTrackSinH[1];
+  }
+  if(nPow>0) fTrackWPow[0] = 1.;
+  for(Int_t k=1; k<nPow; k++) {
+    fTrackWPow[k] = fTrackWPow[k-1]*w;
+  }
+}
+
+//=======================================================================================================================
+
 void AliFlowAnalysisCRC::CalculateCRCQVec()
 {
   // VZERO
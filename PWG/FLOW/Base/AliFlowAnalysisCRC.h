@@ -31,6 +31,7 @@
 #include "TNamed.h"
 #include <complex>
 #include <cmath>
+#include <vector>
 
 class TObjArray;
 class TList;
@@ -232,6 +233,7 @@ public:
   virtual void CalculateCRCZDC();
   virtual void CalculateCRCPtCorr();
   virtual void CalculateCRCQVec();
+  virtual void CalculateTrackHarmonics(Double_t dPhi, Double_t w);
   virtual void CalculateVZvsZDC();
   virtual void CalculateCMETPC();
   virtual void CalculateCMEZDC();
@@ -1504,6 +1506,9 @@ private:
   const static Int_t fkGFPtB = 8;
   TMatrixD *fReQGFPt[fkGFPtB]; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
   TMatrixD *fImQGFPt[fkGFPtB]; //! fImQ[m][k] = sum_{i=1}^{M} w_{i}^{k} sin(m*phi_{i})
+  std::vector<Double_t> fTrackCosH; //! cos(h*phi) of the current track, h = 0,1,...
+  std::vector<Double_t> fTrackSinH; //! sin(h*phi) of the current track, h = 0,1,...
+  std::vector<Double_t> fTrackWPow; //! w^k of the current track, k = 0,1,...
   TH1D *fIntFlowCorrelationsEBE; //! 1st bin: <2>, 2nd bin: <4>, 3rd bin: <6>, 4th bin: <8>
   TH1D *fIntFlowEventWeightsForCorrelationsEBE; //! 1st bin: eW_<2>, 2nd bin: eW_<4>, 3rd bin: eW_<6>, 4th bin: eW_<8>
   TH1D *fIntFlowCorrelationsAllEBE; //! to be improved (add comment)
@@ -2470,7 +2475,7 @@ private:
   Bool_t fbFlagIsBadRunForC34;
   Bool_t fStoreExtraHistoForSubSampling;
 
-  ClassDef(AliFlowAnalysisCRC,74);
+  ClassDef(AliFlowAnalysisCRC,75);
 
 };
 
@@ -23,6 +23,7 @@
 #define AliFlowAnalysisWithQCumulants_cxx
 
 #include "Riostream.h"
+#include <algorithm>
 #include "AliFlowCommonConstants.h"
 #include "AliFlowCommonHist.h"
 #include "AliFlowCommonHistResults.h"
@@ -368,7 +369,6 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fNumberOfPOIsEBE = anEvent->GetNumberOfPOIs(); // number of POIs (i.e. number of particles of interest)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
- Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -376,9 +376,14 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  if(fStoreControlHistograms){this->FillControlHistograms(anEvent);}                                                              
                                                                                                                                                                                                                                                                                         
  // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
+ //    (tracks are first collected into flat arrays, then all harmonics and powers of weights are built in one pass)
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
- Int_t n = fHarmonic; // shortcut for the harmonic 
+ fTrackPhiEBE.clear();
+ fTrackPtEBE.clear();
+ fTrackEtaEBE.clear();
+ fTrackWeightEBE.clear();
+ fTrackFlagEBE.clear();
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
@@ -386,12 +391,16 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
   if(aftsTrack)
   {
    if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
-   if(aftsTrack->InRPSelection()) // RP condition:
+   dPhi = aftsTrack->Phi();
+   dPt  = aftsTrack->Pt();
+   dEta = aftsTrack->Eta();
+   wPhi = 1.;
+   wPt  = 1.;
+   wEta = 1.;
+   wTrack = 1.;
+   if(aftsTrack->InRPSelection()) // RP condition (particle weights are used only for RPs, also when they are POIs):
    {    
     nCounterNoRPs++;
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -409,144 +418,18 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
-    // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
-    {
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
-     } 
-    }
-    // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
-    // Differential flow:
-    if(fCalculateDiffFlow || fCalculate2DDiffFlow)
-    {
-     ptEta[0] = dPt; 
-     ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      {
-       if(fCalculateDiffFlow)
-       {
-        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-        {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-       } // end of if(fCalculateDiffFlow) 
-       if(fCalculate2DDiffFlow)
-       {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-        if(m==0) // s_{p,k} does not depend on index m
-        {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-        } // end of if(m==0) // s_{p,k} does not depend on index m
-       } // end of if(fCalculate2DDiffFlow)
-      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
-     {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
-      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-      {
-       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-       {
-        if(fCalculateDiffFlow)
-        {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
-        {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
-       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
-    } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
    } // end of if(pTrack->InRPSelection())
-   if(aftsTrack->InPOISelection())
-   {
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
-    wPhi = 1.;
-    wPt  = 1.;
-    wEta = 1.;
-    wTrack = 1.;
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && aftsTrack->InRPSelection()) // determine phi weight for POI && RP particle:
-    {
-     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
-    }
-    if(fUsePtWeights && fPtWeights && fnBinsPt && aftsTrack->InRPSelection()) // determine pt weight for POI && RP particle:
-    {
-     wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
-    }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && aftsTrack->InRPSelection()) // determine eta weight for POI && RP particle: 
-    {
-     wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
-    }      
-    // Access track weight for POI && RP particle:
-    if(aftsTrack->InRPSelection() && fUseTrackWeights)
-    {
-     wTrack = aftsTrack->Weight(); 
-    }
-    ptEta[0] = dPt;
-    ptEta[1] = dEta;
-    // Calculate p_{m*n,k} ('p-vector' for POIs): 
-    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-    {
-     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     {
-      if(fCalculateDiffFlow)
-      {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
-      {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-   } // end of if(pTrack->InPOISelection())    
+   fTrackPhiEBE.push_back(dPhi);
+   fTrackPtEBE.push_back(dPt);
+   fTrackEtaEBE.push_back(dEta);
+   fTrackWeightEBE.push_back(wPhi*wPt*wEta*wTrack);
+   fTrackFlagEBE.push_back((aftsTrack->InRPSelection() ? 1 : 0) + (aftsTrack->InPOISelection() ? 2 : 0));
   } else // to if(aftsTrack)
     {
      printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
     }
  } // end of for(Int_t i=0;i<nPrim;i++) 
+ this->CalculateQvectorsEBE();
 
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
  for(Int_t p=0;p<8;p++)
@@ -24916,6 +24799,225 @@ void AliFlowAnalysisWithQCumulants::CheckPointersUsedInFinish()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithQCumulants::CalculateQvectorsEBE()
+{
+ // Calculate Re[Q_{m*n,k}], Im[Q_{m*n,k}] (m = 1,2,...,12, k = 0,1,...,8), S_{p,k} (before taking the power p+1)
+ // and the e-b-e profiles for differential flow from the tracks collected in Make().
+ 
+ // cos((m+1)*n*phi) and sin((m+1)*n*phi) are obtained by complex-power recurrence
+ // e^{i(m+1)n*phi} = e^{imn*phi}*e^{in*phi}, the powers w^k of the particle weight by successive
+ // multiplication. The differential quantities are summed per bin in flat arrays, and
+ // each populated bin is filled only once per event in the e-b-e profiles (see FillDiffFlowProfilesEBE()).
+
+ Int_t n = fHarmonic; // shortcut for the harmonic 
+ Int_t nTracks = (Int_t)fTrackPhiEBE.size();
+ Double_t dReQ[12][9] = {{0.}};
+ Double_t dImQ[12][9] = {{0.}};
+ Double_t dS[9] = {0.};
+ Double_t dCos[12] = {0.}; // cos((m+1)*n*phi)
+ Double_t dSin[12] = {0.}; // sin((m+1)*n*phi)
+ Double_t wPow[9] = {0.}; // w^k
+ const Double_t wPowOne[9] = {1.,1.,1.,1.,1.,1.,1.,1.,1.}; // POIs which are not RPs are not weighted
+ Bool_t bDiffFlow = fCalculateDiffFlow || fCalculate2DDiffFlow;
+ 
+ for(Int_t i=0;i<nTracks;i++)
+ {
+  Double_t dPhi = fTrackPhiEBE[i];
+  dCos[0] = TMath::Cos(n*dPhi);
+  dSin[0] = TMath::Sin(n*dPhi);
+  for(Int_t m=1;m<12;m++)
+  {
+   dCos[m] = dCos[m-1]*dCos[0]-dSin[m-1]*dSin[0];
+   dSin[m] = dSin[m-1]*dCos[0]+dCos[m-1]*dSin[0];
+  }
+  wPow[0] = 1.;
+  for(Int_t k=1;k<9;k++)
+  {
+   wPow[k] = wPow[k-1]*fTrackWeightEBE[i];
+  }
+  Bool_t bRP = fTrackFlagEBE[i] & 1;
+  Bool_t bPOI = fTrackFlagEBE[i] & 2;
+  if(bRP)
+  {
+   for(Int_t m=0;m<12;m++)
+   {
+    for(Int_t k=0;k<9;k++)
+    {
+     dReQ[m][k]+=wPow[k]*dCos[m];
+     dImQ[m][k]+=wPow[k]*dSin[m];
+    }
+   }
+   for(Int_t k=0;k<9;k++)
+   {
+    dS[k]+=wPow[k];
+   }
+  } // end of if(bRP)
+  if(!bDiffFlow){continue;}
+  if(bRP)
+  {
+   this->AddToDiffFlowSumsEBE(0,fTrackPtEBE[i],fTrackEtaEBE[i],dCos,dSin,wPow); // r_{m*n,k} and s_{p,k} for RPs
+   if(bPOI)
+   {
+    this->AddToDiffFlowSumsEBE(2,fTrackPtEBE[i],fTrackEtaEBE[i],dCos,dSin,wPow); // q_{m*n,k} and s_{p,k} for RPs && POIs
+   }
+  }
+  if(bPOI)
+  {
+   this->AddToDiffFlowSumsEBE(1,fTrackPtEBE[i],fTrackEtaEBE[i],dCos,dSin,bRP ? wPow : wPowOne); // p_{m*n,k} for POIs
+  }
+ } // end of for(Int_t i=0;i<nTracks;i++)
+ 
+ for(Int_t m=0;m<12;m++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {
+   (*fReQ)(m,k)+=dReQ[m][k];
+   (*fImQ)(m,k)+=dImQ[m][k];
+  }
+ }
+ for(Int_t p=0;p<8;p++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {
+   (*fSpk)(p,k)+=dS[k];
+  }
+ }
+ if(bDiffFlow){this->FillDiffFlowProfilesEBE();}
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateQvectorsEBE()
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::AddToDiffFlowSumsEBE(Int_t t, Double_t dPt, Double_t dEta, const Double_t *dCos, const Double_t *dSin, const Double_t *wPow)
+{
+ // Add one track to the per-bin sums of Re and Im of r/p/q_{m*n,k} (m = 1,...,4) and s_{p,k}, type t (0 = RP, 1 = POI, 2 = RP&&POI).
+ // Layout of the sums in each bin: Re[m][k], Im[m][k], s[k], number of tracks.
+
+ const Int_t nSums = 2*4*9+9+1;
+ Double_t ptEta[2] = {dPt,dEta};
+ Double_t *binSums[3] = {NULL}; // at most one pt bin, one eta bin and one 2D bin per track
+ Int_t nBinSums = 0;
+ if(fCalculateDiffFlow)
+ {
+  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+  {
+   TProfile *style = fReRPQ1dEBE[t][pe][0][0];
+   Int_t bin = style->FindBin(ptEta[pe]);
+   std::vector<Double_t> &sums = fDiffFlowSums1dEBE[t][pe];
+   if(sums.empty()){sums.assign((style->GetNbinsX()+2)*nSums,0.);}
+   Double_t *s = &sums[bin*nSums];
+   if(s[nSums-1]==0.){fDiffFlowBins1dEBE[t][pe].push_back(bin);}
+   binSums[nBinSums++] = s;
+  }
+ } // end of if(fCalculateDiffFlow)
+ if(fCalculate2DDiffFlow)
+ {
+  TProfile2D *style = fReRPQ2dEBE[t][0][0];
+  Int_t bin = style->FindBin(dPt,dEta);
+  std::vector<Double_t> &sums = fDiffFlowSums2dEBE[t];
+  if(sums.empty()){sums.assign((style->GetNbinsX()+2)*(style->GetNbinsY()+2)*nSums,0.);}
+  Double_t *s = &sums[bin*nSums];
+  if(s[nSums-1]==0.){fDiffFlowBins2dEBE[t].push_back(bin);}
+  binSums[nBinSums++] = s;
+ } // end of if(fCalculate2DDiffFlow)
+ for(Int_t b=0;b<nBinSums;b++)
+ {
+  Double_t *s = binSums[b];
+  for(Int_t m=0;m<4;m++)
+  {
+   for(Int_t k=0;k<9;k++)
+   {
+    s[m*9+k]+=wPow[k]*dCos[m];
+    s[36+m*9+k]+=wPow[k]*dSin[m];
+   }
+  }
+  for(Int_t k=0;k<9;k++)
+  {
+   s[72+k]+=wPow[k];
+  }
+  s[nSums-1]+=1.;
+ }
+
+} // end of void AliFlowAnalysisWithQCumulants::AddToDiffFlowSumsEBE(...)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::FillDiffFlowProfilesEBE()
+{
+ // Fill the e-b-e profiles for differential flow from the per-bin sums, and reset the sums.
+ // Each populated bin is filled once with the average over its N tracks and weight N,
+ // which gives the same bin content and bin entries as filling every track with weight 1.
+ // (s_{p,k} is not needed for POIs, t = 1.)
+
+ const Int_t nSums = 2*4*9+9+1;
+ for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP&&POI )
+ { 
+  if(fCalculateDiffFlow)
+  {
+   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+   {
+    std::vector<Int_t> &bins = fDiffFlowBins1dEBE[t][pe];
+    for(UInt_t b=0;b<bins.size();b++)
+    {
+     Double_t *s = &fDiffFlowSums1dEBE[t][pe][bins[b]*nSums];
+     Double_t dN = s[nSums-1];
+     Double_t x = fReRPQ1dEBE[t][pe][0][0]->GetXaxis()->GetBinCenter(bins[b]);
+     for(Int_t m=0;m<4;m++)
+     {
+      for(Int_t k=0;k<9;k++)
+      {
+       fReRPQ1dEBE[t][pe][m][k]->Fill(x,s[m*9+k]/dN,dN);
+       fImRPQ1dEBE[t][pe][m][k]->Fill(x,s[36+m*9+k]/dN,dN);
+      }
+     }
+     if(t!=1)
+     {
+      for(Int_t k=0;k<9;k++)
+      {
+       fs1dEBE[t][pe][k]->Fill(x,s[72+k]/dN,dN);
+      }
+     }
+     std::fill(s,s+nSums,0.);
+    } // end of for(UInt_t b=0;b<bins.size();b++)
+    bins.clear();
+   } // end of for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+  } // end of if(fCalculateDiffFlow)
+  if(fCalculate2DDiffFlow)
+  {
+   std::vector<Int_t> &bins = fDiffFlowBins2dEBE[t];
+   for(UInt_t b=0;b<bins.size();b++)
+   {
+    Double_t *s = &fDiffFlowSums2dEBE[t][bins[b]*nSums];
+    Double_t dN = s[nSums-1];
+    Int_t binX = 0, binY = 0, binZ = 0;
+    fReRPQ2dEBE[t][0][0]->GetBinXYZ(bins[b],binX,binY,binZ);
+    Double_t x = fReRPQ2dEBE[t][0][0]->GetXaxis()->GetBinCenter(binX);
+    Double_t y = fReRPQ2dEBE[t][0][0]->GetYaxis()->GetBinCenter(binY);
+    for(Int_t m=0;m<4;m++)
+    {
+     for(Int_t k=0;k<9;k++)
+     {
+      fReRPQ2dEBE[t][m][k]->Fill(x,y,s[m*9+k]/dN,dN);
+      fImRPQ2dEBE[t][m][k]->Fill(x,y,s[36+m*9+k]/dN,dN);
+     }
+    }
+    if(t!=1)
+    {
+     for(Int_t k=0;k<9;k++)
+     {
+      fs2dEBE[t][k]->Fill(x,y,s[72+k]/dN,dN);
+     }
+    }
+    std::fill(s,s+nSums,0.);
+   } // end of for(UInt_t b=0;b<bins.size();b++)
+   bins.clear();
+  } // end of if(fCalculate2DDiffFlow)
+ } // end of for(Int_t t=0;t<3;t++)
+
+} // end of void AliFlowAnalysisWithQCumulants::FillDiffFlowProfilesEBE()
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::CheckPointersUsedInMake()
 {
  // Check all pointers used in method Make(). // to be improved - check other pointers as well
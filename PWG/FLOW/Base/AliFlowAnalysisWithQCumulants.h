@@ -14,6 +14,7 @@
 #ifndef ALIFLOWANALYSISWITHQCUMULANTS_H
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
+#include <vector>
 #include "TMatrixD.h"
 #include "TH2D.h"
 #include "TRandom3.h"
@@ -82,6 +83,9 @@ class AliFlowAnalysisWithQCumulants{
     virtual void FillCommonControlHistograms(AliFlowEventSimple *anEvent);
     virtual void FillControlHistograms(AliFlowEventSimple *anEvent);
     virtual void ResetEventByEventQuantities();
+    virtual void CalculateQvectorsEBE();
+    virtual void AddToDiffFlowSumsEBE(Int_t t, Double_t dPt, Double_t dEta, const Double_t *dCos, const Double_t *dSin, const Double_t *wPow);
+    virtual void FillDiffFlowProfilesEBE();
     // 2b.) Reference flow:
     virtual void CalculateIntFlowCorrelations(); 
     virtual void CalculateIntFlowCorrelationsUsingParticleWeights();
@@ -720,6 +724,16 @@ class AliFlowAnalysisWithQCumulants{
   TProfile2D *fReRPQ2dEBE[3][4][9]; // real part of r_{m*n,k}(pt,eta), p_{m*n,k}(pt,eta) and q_{m*n,k}(pt,eta)
   TProfile2D *fImRPQ2dEBE[3][4][9]; // imaginary part of r_{m*n,k}(pt,eta), p_{m*n,k}(pt,eta) and q_{m*n,k}(pt,eta)
   TProfile2D *fs2dEBE[3][9]; //! [t][k] // to be improved
+  //   flat arrays used to build all of the above in one pass over the tracks (see CalculateQvectorsEBE()):
+  std::vector<Double_t> fTrackPhiEBE; //! phi of RPs and POIs in the current event
+  std::vector<Double_t> fTrackPtEBE; //! pt of RPs and POIs in the current event
+  std::vector<Double_t> fTrackEtaEBE; //! eta of RPs and POIs in the current event
+  std::vector<Double_t> fTrackWeightEBE; //! product of particle weights (1 for POIs which are not RPs)
+  std::vector<Int_t> fTrackFlagEBE; //! 1 = RP, 2 = POI, 3 = RP&&POI
+  std::vector<Double_t> fDiffFlowSums1dEBE[3][2]; //! [t][0=pt,1=eta] per bin: Re[m][k], Im[m][k], s[k], number of tracks
+  std::vector<Int_t> fDiffFlowBins1dEBE[3][2]; //! [t][0=pt,1=eta] bins filled in the current event
+  std::vector<Double_t> fDiffFlowSums2dEBE[3]; //! [t] as above, per global bin of the (pt,eta) profiles
+  std::vector<Int_t> fDiffFlowBins2dEBE[3]; //! [t] bins filled in the current event
   //  4d.) profiles:
   //   1D:
   TProfile *fDiffFlowCorrelationsPro[2][2][4]; //! [0=RP,1=POI][0=pt,1=eta][correlation index]
@@ -847,7 +861,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 5);
 
 };
 
@@ -22,10 +22,14 @@
 //  update:      You Zhou, Nikhef, yzhou@nikhef.nl
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <thread>
 #include <Riostream.h>
 #include <TMath.h>
 #include <TEllipse.h>
 #include <TRandom.h>
+#include <TRandom3.h>
+#include <TROOT.h>
 #include <TNamed.h>
 #include <TObjArray.h>
 #include <TNtuple.h>
@@ -172,7 +176,15 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fRandom(0),
+  fSigFlucCdf(),
+  fXA(),
+  fYA(),
+  fSigA(),
+  fGridStart(),
+  fGridNucleons(),
+  fHits()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +334,15 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fRandom(0),
+  fSigFlucCdf(),
+  fXA(),
+  fYA(),
+  fSigA(),
+  fGridStart(),
+  fGridNucleons(),
+  fHits()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -456,18 +476,52 @@ AliGlauberMC& AliGlauberMC::operator=(const AliGlauberMC& in)
   return *this;
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::SetRandom(TRandom* rnd)
+{
+  // Use rnd instead of gRandom for this generator and its nuclei. The nucleon
+  // radii and the fluctuating sigNN are then sampled from tables, since
+  // TF1::GetRandom always uses gRandom: set all parameters before.
+  fRandom = rnd;
+  fANucleus.SetRandom(rnd);
+  fBNucleus.SetRandom(rnd);
+  fSigFlucCdf.clear();
+  if (fRandom && fDoFluc) {
+    InitSigFluc();
+    AliGlauberNucleus::TabulateCdf(fSigFluc,fSigFlucCdf);
+  }
+}
+
+//______________________________________________________________________________
+TRandom *AliGlauberMC::GetRandom() const
+{
+  return fRandom ? fRandom : gRandom;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::InitSigFluc()
+{
+  if (!fDoFluc || fSigFluc) return;
+  fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
+  fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
+  cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberMC::GetRandomSigNN() const
+{
+  if (!fRandom) return fSigFluc->GetRandom();
+  Double_t xmin=0, xmax=0;
+  fSigFluc->GetRange(xmin,xmax);
+  return AliGlauberNucleus::SampleCdf(fSigFlucCdf,xmin,xmax,fRandom);
+}
+
 //______________________________________________________________________________
 Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
 {
   // prepare event
 
-  if (fDoFluc) {
-    if (!fSigFluc) {
-      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
-      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
-      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
-    }
-  }
+  InitSigFluc();
 
   fANucleus.ThrowNucleons(-bgen/2.);
   fNucleonsA = fANucleus.GetNucleons();
@@ -480,7 +534,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonA->SetInNucleusA();
     nucleonA->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonA->SetSigNN(fSigFluc->GetRandom());
+      nucleonA->SetSigNN(GetRandomSigNN());
   }
   fBNucleus.ThrowNucleons(bgen/2.);
   fNucleonsB = fBNucleus.GetNucleons();
@@ -493,16 +547,11 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonB->SetInNucleusB();
     nucleonB->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonB->SetSigNN(fSigFluc->GetRandom());
+      nucleonB->SetSigNN(GetRandomSigNN());
   }
 
   if (fDoFluc) {
-    if (!fSigFluc) {
-      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
-      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
-      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
-    }
-    fXSect = fSigFluc->GetRandom();
+    fXSect = GetRandomSigNN();
   }
   // "ball" diameter = distance at which two balls interact
   Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
@@ -511,34 +560,103 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
-  // for each of the A nucleons in nucleus B
-  for (Int_t i = 0; i<fBN; i++)
+  // The nucleons of A are sorted into a grid of the transverse plane, with
+  // cells at least as large as the largest interaction distance, so that each
+  // nucleon of B is only compared with the nucleons of A in the 3x3 cells
+  // around it. The pairs are still counted in the order of the full A x B loop.
+  const Int_t kMaxGridCells = 256; // per dimension
+  fXA.resize(fAN);
+  fYA.resize(fAN);
+  fSigA.resize(fAN);
+  Double_t xmin = 0, xmax = 0, ymin = 0, ymax = 0;
+  Double_t sigmax = fXSect;
+  for (Int_t j = 0; j<fAN; j++)
   {
-    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-    for (Int_t j = 0 ; j < fAN ; j++)
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+    fXA[j]   = nucleonA->GetX();
+    fYA[j]   = nucleonA->GetY();
+    fSigA[j] = nucleonA->GetSigNN();
+    if (j==0 || fXA[j]<xmin) xmin = fXA[j];
+    if (j==0 || fXA[j]>xmax) xmax = fXA[j];
+    if (j==0 || fYA[j]<ymin) ymin = fYA[j];
+    if (j==0 || fYA[j]>ymax) ymax = fYA[j];
+  }
+  if (fDoFluc) {
+    sigmax = 0;
+    for (Int_t j = 0; j<fAN; j++) sigmax = TMath::Max(sigmax,fSigA[j]);
+    for (Int_t i = 0; i<fBN; i++) sigmax = TMath::Max(sigmax,((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i)))->GetSigNN());
+  }
+  const Double_t cell = TMath::Max(TMath::Sqrt(sigmax/(TMath::Pi()*10)),
+                                   TMath::Max(xmax-xmin,ymax-ymin)/(kMaxGridCells-1));
+
+  if (fAN>0 && cell>0)
+  {
+    const Int_t nx = Int_t((xmax-xmin)/cell)+1;
+    const Int_t ny = Int_t((ymax-ymin)/cell)+1;
+    fGridStart.assign(nx*ny+1,0);
+    fGridNucleons.resize(fAN);
+    for (Int_t j = 0; j<fAN; j++)
+      ++fGridStart[1+Int_t((fXA[j]-xmin)/cell)*ny+Int_t((fYA[j]-ymin)/cell)];
+    for (Int_t c = 0; c<nx*ny; c++)
+      fGridStart[c+1] += fGridStart[c];
+    for (Int_t j = 0; j<fAN; j++)
+      fGridNucleons[fGridStart[Int_t((fXA[j]-xmin)/cell)*ny+Int_t((fYA[j]-ymin)/cell)]++] = j;
+    for (Int_t c = nx*ny; c>0; c--)
+      fGridStart[c] = fGridStart[c-1];
+    fGridStart[0] = 0;
+
+    // for each of the A nucleons in nucleus B
+    for (Int_t i = 0; i<fBN; i++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
-      Double_t dij = dx*dx+dy*dy;
-      if (fDoFluc) {
-	//fXSect = nucleonA->GetSigNN();
-	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
-	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
+      AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+      const Double_t xB = nucleonB->GetX();
+      const Double_t yB = nucleonB->GetY();
+      const Int_t cx = Int_t(TMath::Floor((xB-xmin)/cell));
+      const Int_t cy = Int_t(TMath::Floor((yB-ymin)/cell));
+      if (cx<-1 || cx>nx || cy<-1 || cy>ny) continue;
+      fHits.clear();
+      for (Int_t ix = TMath::Max(cx-1,0); ix<=TMath::Min(cx+1,nx-1); ix++)
+      {
+        for (Int_t iy = TMath::Max(cy-1,0); iy<=TMath::Min(cy+1,ny-1); iy++)
+        {
+          const Int_t c = ix*ny+iy;
+          for (Int_t k = fGridStart[c]; k<fGridStart[c+1]; k++)
+          {
+            const Int_t j = fGridNucleons[k];
+            Double_t dx = xB-fXA[j];
+            Double_t dy = yB-fYA[j];
+            Double_t dij = dx*dx+dy*dy;
+            if (fDoFluc) {
+              //fXSect = nucleonA->GetSigNN();
+              //fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
+              d2 = TMath::Max(fSigA[j],nucleonB->GetSigNN())/(TMath::Pi()*10); // in fm^2
+            }
+            if (dij < d2)
+              fHits.push_back(std::make_pair(j,dij));
+          }
+        }
       }
-      if (dij < d2)
+      std::sort(fHits.begin(),fHits.end());
+      for (UInt_t h = 0; h<fHits.size(); h++)
       {
-	bNN += dij;
-	++Nco;
+        const Double_t dij = fHits[h].second;
+        if (fDoFluc)
+          d2 = TMath::Max(fSigA[fHits[h].first],nucleonB->GetSigNN())/(TMath::Pi()*10);
+        bNN += dij;
+        ++Nco;
         nucleonB->Collide();
-        nucleonA->Collide();
-	if (dij<d2/4)
-	  ++Ncohc;
+        ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(fHits[h].first)))->Collide();
+        if (dij<d2/4)
+          ++Ncohc;
       }
     }
   }
 
+  if (fDoFluc && fAN>0 && fBN>0) {
+    // value left by the last pair of the A x B loop, which is written to the ntuple
+    fXSect = TMath::Max(fSigA[fAN-1],((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(fBN-1)))->GetSigNN());
+  }
+
   if (Nco>0) {
     fNcollw = Ncohc;
     fBNN = bNN/Nco;
@@ -1267,7 +1385,7 @@ Int_t AliGlauberMC::NegativeBinomialRandom(Int_t k, Double_t nmean) const
   {
     array[i] = NegativeBinomialDistribution(i,k,nmean) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 
 }
@@ -1278,7 +1396,7 @@ Int_t AliGlauberMC::NegativeBinomialRandomSV(Double_t k, Double_t nbar) const
   // negative binomial distribution generator, S. Voloshin, 09-May-2007
   Double_t sum=0.;
   Int_t i=0;
-  Double_t ran=gRandom->Rndm();
+  Double_t ran=GetRandom()->Rndm();
   Double_t trm=1./pow(1.+nbar/k,k);
   if (trm==0.)
   {
@@ -1308,7 +1426,7 @@ Int_t AliGlauberMC::DoubleNegativeBinomialRandom( Int_t k,
   {
     array[i] = alpha*NegativeBinomialDistribution(i,k,nmean)+(1-alpha)*NegativeBinomialDistribution(i,k2,nmean2) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 }
 
@@ -1506,7 +1624,7 @@ Bool_t AliGlauberMC::NextEvent(Double_t bgen)
   {
     if(bgen<0||!succes) //get impactparameter
     {
-      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*gRandom->Rndm()+fBMin*fBMin);
+      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandom()->Rndm()+fBMin*fBMin);
     }
     if ( (succes=CalcEvent(bgen)) ) break; //ends if we have particparts
   }
@@ -1682,9 +1800,81 @@ Double_t AliGlauberMC::GetPsi4m2() const
 }
 */
 //______________________________________________________________________________
-void AliGlauberMC::Run(Int_t nevents)
+void AliGlauberMC::FillNtupleRow(Float_t *v) const
+{
+  //values of the current event, in the order of the ntuple variables
+  v[0]  = GetNpart();
+  v[1]  = GetNcoll();
+  v[2]  = fBMC;
+  v[3]  = fMeanXParts;
+  v[4]  = fMeanYParts;
+  v[5]  = fMeanX2Parts;
+  v[6]  = fMeanY2Parts;
+  v[7]  = fMeanXYParts;
+  v[8]  = fSx2Parts;
+  v[9]  = fSy2Parts;
+  v[10] = fSxyParts;
+  v[11] = fMeanXSystem;
+  v[12] = fMeanYSystem;
+  v[13] = fMeanXA;
+  v[14] = fMeanYA;
+  v[15] = fMeanXB;
+  v[16] = fMeanYB;
+  v[17] = GetEccentricity();
+  v[18] = GetStoa();
+  v[19] = GetEccentricityColl();
+  v[20] = GetEccentricityCom();
+  v[21] = GetEccentricityPart();
+  v[22] = GetEccentricityPartColl();
+  v[23] = GetEccentricityPartCom();
+  if (fDoPartProd)
+  {
+    v[24] = GetdNdEta();
+    v[25] = GetdNdEta();
+    v[26] = v[24]+v[25];
+  }
+  else
+  {
+    v[24] = 0;
+    v[25] = 0;
+    v[26] = 0;
+  }
+  v[27]=fXSect;
+
+  Float_t mytAA=-999;
+  if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
+  v[28]=mytAA;
+  //_____________epsilon2,3,4,4_______
+  v[29] = GetEpsilon2Part();
+  v[30] = GetEpsilon3Part();
+  v[31] = GetEpsilon4Part();
+  v[32] = GetEpsilon5Part();
+  v[33] = GetEpsilon2Coll();
+  v[34] = GetEpsilon3Coll();
+  v[35] = GetEpsilon4Coll();
+  v[36] = GetEpsilon5Coll();
+  v[37] = GetEpsilon2Com();
+  v[38] = GetEpsilon3Com();
+  v[39] = GetEpsilon4Com();
+  v[40] = GetEpsilon5Com();
+  v[41] = GetPsi2();
+  v[42] = GetPsi3();
+  v[43] = GetPsi4();
+  v[44] = GetPsi5();
+  v[45] = fBNN;
+  v[46] = fXSect;
+  v[47] = fNcollw;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::Run(Int_t nevents, Int_t nThreads, UInt_t seed)
 {
   //example run
+  //with nThreads>1 or a seed the events are generated in chunks of fixed size by copies
+  //of this object, each chunk with its own random stream seeded from seed (drawn from
+  //gRandom if 0). The ntuple is filled in chunk order, so that for a given seed the result
+  //does not depend on the number of threads. With one thread and no seed the events are
+  //generated by this object with gRandom.
   cout << "Generating " << nevents << " events..." << endl;
   TString name(Form("nt_%s_%s",fANucleus.GetName(),fBNucleus.GetName()));
   TString title(Form("%s + %s (x-sect = %d mb)",fANucleus.GetName(),fBNucleus.GetName(),(Int_t) fXSect));
@@ -1696,87 +1886,142 @@ void AliGlauberMC::Run(Int_t nevents)
   }
   Int_t q = 0;
   Int_t u = 0;
-  for (Int_t i = 0; i<nevents; i++)
+  if (nThreads<=1 && !seed)
   {
-
-    if(!NextEvent())
+    for (Int_t i = 0; i<nevents; i++)
     {
-      u++;
-      continue;
+
+      if(!NextEvent())
+      {
+        u++;
+        continue;
+      }
+
+      q++;
+      Float_t v[48];
+      FillNtupleRow(v);
+
+      //always at the end
+      fnt->Fill(v);
+
+      if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
     }
+    std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
+    return;
+  }
 
-    q++;
-    Float_t v[48];
-    v[0]  = GetNpart();
-    v[1]  = GetNcoll();
-    v[2]  = fBMC;
-    v[3]  = fMeanXParts;
-    v[4]  = fMeanYParts;
-    v[5]  = fMeanX2Parts;
-    v[6]  = fMeanY2Parts;
-    v[7]  = fMeanXYParts;
-    v[8]  = fSx2Parts;
-    v[9]  = fSy2Parts;
-    v[10] = fSxyParts;
-    v[11] = fMeanXSystem;
-    v[12] = fMeanYSystem;
-    v[13] = fMeanXA;
-    v[14] = fMeanYA;
-    v[15] = fMeanXB;
-    v[16] = fMeanYB;
-    v[17] = GetEccentricity();
-    v[18] = GetStoa();
-    v[19] = GetEccentricityColl();
-    v[20] = GetEccentricityCom();
-    v[21] = GetEccentricityPart();
-    v[22] = GetEccentricityPartColl();
-    v[23] = GetEccentricityPartCom();
-    if (fDoPartProd)
+  if (nThreads<1) nThreads = 1;
+  const Int_t kEventsPerChunk  = 1000;
+  const Int_t kChunksPerThread = 4; // chunks per thread kept in memory before filling the ntuple
+  const Int_t nChunks = (nevents+kEventsPerChunk-1)/kEventsPerChunk;
+
+  // the chunk seeds are drawn serially, 0 would mean a time-based seed
+  TRandom3 seeder(seed ? seed : 1+gRandom->Integer(kMaxUInt-1));
+  std::vector<UInt_t> seeds(nChunks);
+  for (Int_t iChunk=0; iChunk<nChunks; iChunk++) seeds[iChunk] = 1+seeder.Integer(kMaxUInt-1);
+
+  ROOT::EnableThreadSafety();
+  InitSigFluc();
+  std::vector<TRandom3> randoms(nThreads);
+  std::vector<AliGlauberMC*> workers(nThreads);
+  for (Int_t iW=0; iW<nThreads; iW++)
+  {
+    workers[iW] = MakeWorker();
+    workers[iW]->SetRandom(&randoms[iW]);
+  }
+
+  const Int_t nPerRound = nThreads*kChunksPerThread;
+  std::vector<std::vector<Float_t> > rows(nPerRound);
+  std::vector<Int_t> discarded(nThreads,0);
+  for (Int_t first=0; first<nChunks; first+=nPerRound)
+  {
+    const Int_t end = TMath::Min(first+nPerRound,nChunks);
+    std::vector<std::thread> threads;
+    for (Int_t iW=0; iW<nThreads; iW++)
     {
-      v[24] = GetdNdEta();
-      v[25] = GetdNdEta();
-      v[26] = v[24]+v[25];
+      threads.push_back(std::thread(&AliGlauberMC::RunChunks,workers[iW],first+iW,nThreads,end,nevents,kEventsPerChunk,
+                                    std::cref(seeds),std::ref(rows),std::ref(discarded[iW])));
     }
-    else
+    for (Int_t iW=0; iW<nThreads; iW++) threads[iW].join();
+
+    for (Int_t iChunk=first; iChunk<end; iChunk++)
     {
-      v[24] = 0;
-      v[25] = 0;
-      v[26] = 0;
+      const std::vector<Float_t> &chunk = rows[iChunk%nPerRound];
+      for (UInt_t iRow=0; iRow<chunk.size(); iRow+=48)
+      {
+        fnt->Fill(&chunk[iRow]);
+        q++;
+      }
     }
-    v[27]=fXSect;
-
-    Float_t mytAA=-999;
-    if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
-    v[28]=mytAA;
-    //_____________epsilon2,3,4,4_______
-    v[29] = GetEpsilon2Part();
-    v[30] = GetEpsilon3Part();
-    v[31] = GetEpsilon4Part();
-    v[32] = GetEpsilon5Part();
-    v[33] = GetEpsilon2Coll();
-    v[34] = GetEpsilon3Coll();
-    v[35] = GetEpsilon4Coll();
-    v[36] = GetEpsilon5Coll();
-    v[37] = GetEpsilon2Com();
-    v[38] = GetEpsilon3Com();
-    v[39] = GetEpsilon4Com();
-    v[40] = GetEpsilon5Com();
-    v[41] = GetPsi2();
-    v[42] = GetPsi3();
-    v[43] = GetPsi4();
-    v[44] = GetPsi5();
-    v[45] = fBNN;
-    v[46] = fXSect;
-    v[47] = fNcollw;
-
-    //always at the end
-    fnt->Fill(v);
-
-    if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
+    std::cout << "Generating Event # " << TMath::Min(end*kEventsPerChunk,nevents) << "... \r" << flush;
+  }
+
+  for (Int_t iW=0; iW<nThreads; iW++)
+  {
+    u += discarded[iW];
+    fEvents      += workers[iW]->fEvents;
+    fTotalEvents += workers[iW]->fTotalEvents;
+    if (workers[iW]->fMaxNpartFound > fMaxNpartFound) fMaxNpartFound = workers[iW]->fMaxNpartFound;
+    delete workers[iW];
   }
   std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::RunChunks(Int_t first, Int_t step, Int_t end, Int_t nevents, Int_t nPerChunk, const std::vector<UInt_t> &seeds,
+                             std::vector<std::vector<Float_t> > &rows, Int_t &discarded)
+{
+  //generate the chunks first, first+step, ... < end of Run, into rows[chunk % rows.size()]
+  for (Int_t iChunk=first; iChunk<end; iChunk+=step)
+  {
+    std::vector<Float_t> &chunk = rows[iChunk%rows.size()];
+    chunk.clear();
+    fRandom->SetSeed(seeds[iChunk]);
+    const Int_t n = TMath::Min(nPerChunk,nevents-iChunk*nPerChunk);
+    for (Int_t i = 0; i<n; i++)
+    {
+      if(!NextEvent())
+      {
+        discarded++;
+        continue;
+      }
+      Float_t v[48];
+      FillNtupleRow(v);
+      chunk.insert(chunk.end(),v,v+48);
+    }
+  }
+}
+
+//______________________________________________________________________________
+AliGlauberMC *AliGlauberMC::MakeWorker() const
+{
+  //new generator with the same settings, for one thread of Run
+  //(the copy constructor shares the nucleus density functions)
+  AliGlauberMC *mc = new AliGlauberMC(fANucleus.GetName(),fBNucleus.GetName(),fXSect);
+  const AliGlauberNucleus *nuc[2] = {&fANucleus,&fBNucleus};
+  AliGlauberNucleus *mcnuc[2] = {&mc->fANucleus,&mc->fBNucleus};
+  for (Int_t i=0; i<2; i++)
+  {
+    mcnuc[i]->SetR(nuc[i]->GetR());
+    mcnuc[i]->SetA(nuc[i]->GetA());
+    mcnuc[i]->SetW(nuc[i]->GetW());
+    mcnuc[i]->SetMinDist(nuc[i]->GetMinDist());
+  }
+  mc->fBMin       = fBMin;
+  mc->fBMax       = fBMax;
+  mc->fMultType   = fMultType;
+  mc->fX          = fX;
+  mc->fNpp        = fNpp;
+  mc->fDoPartProd = fDoPartProd;
+  mc->fDoFluc     = fDoFluc;
+  mc->fOmega      = fOmega;
+  mc->fSig0       = fSig0;
+  mc->fLambda     = fLambda;
+  memcpy(mc->fdNdEtaParam,fdNdEtaParam,sizeof(fdNdEtaParam));
+  mc->InitSigFluc();
+  return mc;
+}
+
 //---------------------------------------------------------------------------------
 void AliGlauberMC::RunAndSaveNtuple( Int_t n,
                                      const Option_t *sysA,
@@ -1785,14 +2030,16 @@ void AliGlauberMC::RunAndSaveNtuple( Int_t n,
                                      Double_t mind,
                                      Double_t r,
                                      Double_t a,
-                                     const char *fname)
+                                     const char *fname,
+                                     Int_t nThreads,
+                                     UInt_t seed)
 {
   //example run
   AliGlauberMC mcg(sysA,sysB,signn);
   mcg.SetMinDistance(mind);
   mcg.Setr(r);
   mcg.Seta(a);
-  mcg.Run(n);
+  mcg.Run(n,nThreads,seed);
   TNtuple  *nt=mcg.GetNtuple();
   TFile out(fname,"recreate",fname,9);
   if(nt) nt->Write();
@@ -14,11 +14,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "AliGlauberNucleus.h"
+#include <vector>
 #include <Riostream.h>
 #include <TNamed.h>
 
 class TObjArray;
 class TNtuple;
+class TRandom;
 
 using std::cout;
 using std::endl;
@@ -38,7 +40,7 @@ public:
    AliGlauberMC& operator=(const AliGlauberMC& in);
    void         Draw(Option_t* option);
 
-   void         Run(Int_t nevents);
+   void         Run(Int_t nevents, Int_t nThreads=1, UInt_t seed=0);
    Bool_t       NextEvent(Double_t bgen=-1);
    Bool_t       CalcEvent(Double_t bgen);
 
@@ -100,6 +102,7 @@ public:
    void   Seta(Double_t a)  {fANucleus.SetA(a); fBNucleus.SetA(a);}
    void   SetDoFluc(Double_t omega, Double_t sig0, Double_t lam, Bool_t on=kTRUE) 
             {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;}
+   void   SetRandom(TRandom* rnd);
    static void       PrintVersion()         {cout << "AliGlauberMC " << Version() << endl;}
    static const char *Version()             {return "v1.2";}
    static void       RunAndSaveNtuple( Int_t n,
@@ -109,7 +112,9 @@ public:
                                        Double_t mind=0.4,
 				       Double_t r=6.62,
 				       Double_t a=0.546,
-                                       const char *fname="glau_pbpb_ntuple.root");
+                                       const char *fname="glau_pbpb_ntuple.root",
+                                       Int_t nThreads=1,
+                                       UInt_t seed=0);
    void RunAndSaveNucleons( Int_t n,
                             const Option_t *sysA,
                             const Option_t *sysB,
@@ -251,7 +256,22 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   TRandom     *fRandom;         //!random generator (gRandom if not set)
+   std::vector<Double_t> fSigFlucCdf;  //!tabulated cumulative of fSigFluc, sampled with fRandom
+   std::vector<Double_t> fXA;          //!x of the nucleons of A
+   std::vector<Double_t> fYA;          //!y of the nucleons of A
+   std::vector<Double_t> fSigA;        //!sigNN of the nucleons of A
+   std::vector<Int_t>    fGridStart;   //!first entry of each grid cell in fGridNucleons
+   std::vector<Int_t>    fGridNucleons;//!nucleons of A ordered by grid cell
+   std::vector<std::pair<Int_t,Double_t> > fHits; //!nucleons of A hit by the current nucleon of B, with the distance^2
    Bool_t       CalcResults(Double_t bgen);
+   void         InitSigFluc();
+   Double_t     GetRandomSigNN() const;
+   TRandom     *GetRandom() const;
+   void         FillNtupleRow(Float_t *v) const;
+   AliGlauberMC *MakeWorker() const;
+   void         RunChunks(Int_t first, Int_t step, Int_t end, Int_t nevents, Int_t nPerChunk, const std::vector<UInt_t> &seeds,
+                          std::vector<std::vector<Float_t> > &rows, Int_t &discarded);
 
    ClassDef(AliGlauberMC,4)
 };
@@ -23,6 +23,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <Riostream.h>
 #include <TMath.h>
 #include <TEllipse.h>
@@ -49,7 +50,9 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fRandom(NULL),
+  fCdf()
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -77,7 +80,9 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fF(in.fF),
   fTrials(in.fTrials),
   fFunction(in.fFunction),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fRandom(NULL),
+  fCdf()
 {
   //copy ctor
   if (in.fNucleons)
@@ -225,6 +230,59 @@ void AliGlauberNucleus::SetW(Double_t iw)
    }
 }
 
+//______________________________________________________________________________
+void AliGlauberNucleus::SetRandom(TRandom* rnd)
+{
+   // Use rnd instead of gRandom to throw the nucleons. The radial density is
+   // then sampled from a table instead of TF1::GetRandom (which always uses
+   // gRandom), so set the parameters of the nucleus before.
+   fRandom = rnd;
+   fCdf.clear();
+   if (fRandom && fFunction)
+      TabulateCdf(fFunction,fCdf);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::TabulateCdf(TF1* func, std::vector<Double_t>& cdf, Int_t nbins)
+{
+   // cumulative of func in nbins equal bins of its range, normalised to 1
+   Double_t xmin=0, xmax=0;
+   func->GetRange(xmin,xmax);
+   const Double_t dx = (xmax-xmin)/nbins;
+   cdf.assign(nbins+1,0.);
+   for (Int_t i = 0; i<nbins; i++) {
+      const Double_t f = func->Eval(xmin+(i+0.5)*dx);
+      cdf[i+1] = cdf[i] + (f>0 ? f : 0);
+   }
+   if (cdf[nbins]>0) {
+      for (Int_t i = 1; i<=nbins; i++)
+         cdf[i] /= cdf[nbins];
+   }
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::SampleCdf(const std::vector<Double_t>& cdf, Double_t xmin, Double_t xmax, TRandom* rnd)
+{
+   // inverse of the cumulative, linear inside each bin
+   const Int_t nbins = cdf.size()-1;
+   const Double_t u = rnd->Rndm();
+   Int_t bin = std::upper_bound(cdf.begin(),cdf.end(),u)-cdf.begin()-1;
+   if (bin<0) bin = 0;
+   if (bin>=nbins) bin = nbins-1;
+   const Double_t width = cdf[bin+1]-cdf[bin];
+   const Double_t frac = width>0 ? (u-cdf[bin])/width : 0.5;
+   return xmin + (bin+frac)*(xmax-xmin)/nbins;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::GetRandomR() const
+{
+   if (!fRandom) return fFunction->GetRandom();
+   Double_t xmin=0, xmax=0;
+   fFunction->GetRange(xmin,xmax);
+   return SampleCdf(fCdf,xmin,xmax,fRandom);
+}
+
 //______________________________________________________________________________
 void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
 {
@@ -243,12 +301,14 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    Double_t sumy=0;       
    Double_t sumz=0;       
 
+   TRandom* rnd = fRandom ? fRandom : gRandom;
+
    Bool_t hulthen = (TString(GetName())=="dh");
    if (fN==2 && hulthen) { //special treatmeant for Hulten
 
-      Double_t r = fFunction->GetRandom()/2;
-      Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-      Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+      Double_t r = GetRandomR()/2;
+      Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+      Double_t ctheta = 2*rnd->Rndm() - 1 ;
       Double_t stheta = sqrt(1-ctheta*ctheta);
      
       AliGlauberNucleon *nucleon1=(AliGlauberNucleon*)(fNucleons->UncheckedAt(0));
@@ -270,9 +330,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
       nucleon->Reset();
       while(1) {
          fTrials++;
-         Double_t r = fFunction->GetRandom();
-         Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-         Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+         Double_t r = GetRandomR();
+         Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+         Double_t ctheta = 2*rnd->Rndm() - 1 ;
          Double_t stheta = TMath::Sqrt(1-ctheta*ctheta);
          Double_t x = r * stheta * cos(phi) + xshift;
          Double_t y = r * stheta * sin(phi);      
@@ -15,9 +15,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 //class TNamed;
+#include <vector>
 #include <TNamed.h>
 class TObjArray;
 class TF1;
+class TRandom;
 
 class AliGlauberNucleus : public TNamed {
 private:
@@ -30,8 +32,11 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   TRandom*   fRandom;     //!Random generator (gRandom if not set)
+   std::vector<Double_t> fCdf; //!Tabulated cumulative of fFunction, sampled with fRandom
 
    void       Lookup(Option_t* name);
+   Double_t   GetRandomR() const;
 
 public:
    AliGlauberNucleus(Option_t* iname="Au", Int_t iN=0, Double_t iR=0, Double_t ia=0, Double_t iw=0, TF1* ifunc=0);
@@ -45,6 +50,7 @@ public:
    Double_t   GetR()             const {return fR;}
    Double_t   GetA()             const {return fA;}
    Double_t   GetW()             const {return fW;}
+   Double_t   GetMinDist()       const {return fMinDist;}
    TObjArray *GetNucleons()      const {return fNucleons;}
    Int_t      GetTrials()        const {return fTrials;}
    void       SetN(Int_t in)           {fN=in;}
@@ -52,8 +58,12 @@ public:
    void       SetA(Double_t ia);
    void       SetW(Double_t iw);
    void       SetMinDist(Double_t min) {fMinDist=min;}
+   void       SetRandom(TRandom* rnd);
    void       ThrowNucleons(Double_t xshift=0.);
 
+   static void     TabulateCdf(TF1* func, std::vector<Double_t>& cdf, Int_t nbins=2000);
+   static Double_t SampleCdf(const std::vector<Double_t>& cdf, Double_t xmin, Double_t xmax, TRandom* rnd);
+
    ClassDef(AliGlauberNucleus,1)
 };
 
@@ -9,6 +9,7 @@
 #include "AliGenPythiaEventHeader.h"
 
 #include "AliEventClassifierSpherocity.h"
+#include "AliEventShapeUtils.h"
 #include "AliIsPi0PhysicalPrimary.h"
 
 using namespace std;
@@ -42,50 +43,24 @@ Bool_t AliEventClassifierSpherocity::TrackPassesSelection(AliMCParticle* track,
 }
 
 void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, AliStack *stack) {
-  // This implementation is adapted from PWGLF/SPECTRA/Spherocity/AliTransverseEventShape.cxx
+  // The minimum over the axes is computed exactly by AliEventShapeUtils, instead of the
+  // scan of 3600 trial axes adapted from PWGLF/SPECTRA/Spherocity/AliTransverseEventShape.cxx
   fClassifierValue = 0.0;
 
-  Float_t sumRatioSquare = 0;
-  Float_t minimalSumRatioSquare = 2;
-  
-  // Step size in phi unit vector used to find m spherocity
-  Float_t phiStepSize = 0.1;
-
-  // Computing total pt
-  Float_t sumapt = 0;
+  vector<Double_t> px;
+  vector<Double_t> py;
   Int_t ntracks = event->GetNumberOfTracks();
   for (Int_t iTrack = 0; iTrack < ntracks; iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
     if (!TrackPassesSelection(track, stack, iTrack)) continue;
-    sumapt += track->Pt();
-  }
-  
-  // Getting thrust
-  for(Int_t i = 0; i < 360/(phiStepSize); ++i){
-    Float_t numerator = 0;
-    Float_t phiparam  = 0;
-    Float_t nx = 0;
-    Float_t ny = 0;
-    phiparam=((TMath::Pi()) * i * phiStepSize) / 180; // parametrization of the angle
-    nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-    ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-    for(Int_t iTrack = 0; iTrack < ntracks; ++iTrack){
-      AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
-      if (!TrackPassesSelection(track, stack, iTrack)) continue;
-      
-      Float_t pxA = track->Pt() * TMath::Cos(track->Phi());
-      Float_t pyA = track->Pt() * TMath::Sin(track->Phi());
-      //product between p projection in XY plane and the unitary vector
-      numerator += TMath::Abs( ny * pxA - nx * pyA );
-    }
-    
-    sumRatioSquare = TMath::Power((numerator / sumapt), 2);
-    if(sumRatioSquare < minimalSumRatioSquare)  //minimization of pFull
-      {
-	minimalSumRatioSquare = sumRatioSquare;
-      }
+    px.push_back(track->Pt() * TMath::Cos(track->Phi()));
+    py.push_back(track->Pt() * TMath::Sin(track->Phi()));
   }
 
-  // Compute the final spherocity:
-  fClassifierValue = (minimalSumRatioSquare * TMath::Pi() * TMath::Pi()) / 4.0;
+  // Without tracks, keep the value given by the scan of the trial axes
+  if (px.empty()) {
+    fClassifierValue = (2 * TMath::Pi() * TMath::Pi()) / 4.0;
+    return;
+  }
+  fClassifierValue = AliEventShapeUtils::Spherocity(px.size(), &px[0], &py[0]);
 }
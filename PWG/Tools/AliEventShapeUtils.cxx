@@ -0,0 +1,364 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Transverse event shapes (spherocity, thrust, sphericity) from flat px/py arrays.
+//
+
+#include <algorithm>
+#include <vector>
+
+#include <TError.h>
+#include <TMath.h>
+
+#include "AliEventShapeUtils.h"
+
+ClassImp(AliEventShapeUtils)
+
+Bool_t   AliEventShapeUtils::fgCheckLegacy       = kFALSE;
+Double_t AliEventShapeUtils::fgLegacyTolerance   = 1e-6;
+Int_t    AliEventShapeUtils::fgNLegacyMismatches = 0;
+
+namespace {
+
+/// Particle direction, for the sort in azimuth
+struct ShapeParticle {
+  Double_t fPhi;
+  Double_t fX;
+  Double_t fY;
+  bool operator<(const ShapeParticle &other) const { return fPhi < other.fPhi; }
+};
+
+}
+
+/**
+ * Spherocity, exact minimum over the transverse axes.
+ *
+ * The particles are folded to [0, pi[, where |sin(phi_i - theta)| is sin(phi_i - theta)
+ * for the particles with phi_i >= theta and -sin(phi_i - theta) for the others, so that with
+ * the particles sorted by phi the sum for each candidate axis comes from prefix sums.
+ *
+ * @param[in] n Number of particles
+ * @param[in] px Particle px
+ * @param[in] py Particle py
+ * @param[in] ptWeighted Use the particle momenta, otherwise unit vectors
+ * @param[out] axisPhi If not 0, azimuth of the spherocity axis, in [0, pi[
+ * @return Spherocity in [0, 1], -1 if there is no particle with pT > 0
+ */
+Double_t AliEventShapeUtils::Spherocity(Int_t n, const Double_t *px, const Double_t *py, Bool_t ptWeighted, Double_t *axisPhi)
+{
+  std::vector<ShapeParticle> particles;
+  particles.reserve(n);
+
+  Double_t sumw = 0;
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pt = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+    if (pt <= 0) continue;
+    Double_t w = ptWeighted ? pt : 1.;
+    ShapeParticle p;
+    p.fX = px[i] * w / pt;
+    p.fY = py[i] * w / pt;
+    p.fPhi = TMath::ATan2(p.fY, p.fX);
+    if (p.fPhi < 0 || p.fPhi >= TMath::Pi()) {
+      p.fPhi += p.fPhi < 0 ? TMath::Pi() : -TMath::Pi();
+      p.fX = -p.fX;
+      p.fY = -p.fY;
+    }
+    particles.push_back(p);
+    sumw += w;
+  }
+  if (particles.empty()) return -1;
+
+  std::sort(particles.begin(), particles.end());
+
+  Double_t sumX = 0, sumY = 0;
+  for (UInt_t i = 0; i < particles.size(); i++) {
+    sumX += particles[i].fX;
+    sumY += particles[i].fY;
+  }
+
+  // Particles before the candidate axis, with phi < theta
+  Double_t belowX = 0, belowY = 0;
+  Double_t minSum = sumw;
+  Double_t minPhi = 0;
+  for (UInt_t j = 0; j < particles.size(); j++) {
+    const Double_t theta = particles[j].fPhi;
+    const Double_t diffX = (sumX - belowX) - belowX;
+    const Double_t diffY = (sumY - belowY) - belowY;
+    const Double_t sum = diffY * TMath::Cos(theta) - diffX * TMath::Sin(theta);
+    if (sum < minSum) {
+      minSum = sum;
+      minPhi = theta;
+    }
+    belowX += particles[j].fX;
+    belowY += particles[j].fY;
+  }
+  if (minSum < 0) minSum = 0;
+  if (axisPhi) *axisPhi = minPhi;
+
+  Double_t ratio = minSum / sumw;
+  Double_t spherocity = ratio * ratio * TMath::Pi() * TMath::Pi() / 4.;
+
+  if (fgCheckLegacy) {
+    Double_t legacy = SpherocityLegacy(n, px, py, ptWeighted);
+    if (TMath::Abs(spherocity - legacy) > fgLegacyTolerance) {
+      fgNLegacyMismatches++;
+      ::Warning("AliEventShapeUtils::Spherocity", "Spherocity %f differs from legacy value %f (%d particles)", spherocity, legacy, n);
+    }
+  }
+
+  return spherocity;
+}
+
+/**
+ * Thrust, exact maximum over the transverse axes.
+ *
+ * For a given axis, the sum is the projection on the axis of the momenta on its side minus the
+ * momenta on the other side. It is maximal for the axis along this difference, which changes only
+ * when a particle crosses the line perpendicular to the axis, so the maximum is reached for the
+ * particles of a half turn starting at one of them, [phi_j, phi_j + pi[ or [phi_j, phi_j + pi],
+ * on one side. These half turns are swept with two pointers.
+ *
+ * @param[in] n Number of particles
+ * @param[in] px Particle px
+ * @param[in] py Particle py
+ * @param[out] axisPhi If not 0, azimuth of the thrust axis, in ]-pi, pi]
+ * @return Thrust in [0.5, 1] for two or more particles, -1 if there is no particle with pT > 0
+ */
+Double_t AliEventShapeUtils::Thrust(Int_t n, const Double_t *px, const Double_t *py, Double_t *axisPhi)
+{
+  std::vector<ShapeParticle> particles;
+  particles.reserve(n);
+
+  Double_t sumpt = 0, sumX = 0, sumY = 0;
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pt = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+    if (pt <= 0) continue;
+    ShapeParticle p;
+    p.fX = px[i];
+    p.fY = py[i];
+    p.fPhi = TMath::ATan2(py[i], px[i]);
+    if (p.fPhi < 0) p.fPhi += TMath::TwoPi();
+    particles.push_back(p);
+    sumpt += pt;
+    sumX += px[i];
+    sumY += py[i];
+  }
+  if (particles.empty()) return -1;
+
+  std::sort(particles.begin(), particles.end());
+
+  const Int_t np = particles.size();
+
+  // Half turn window [phi_j, phi_j + pi[ over the particles, the second turn with phi + 2pi
+  Double_t windowX = 0, windowY = 0;
+  Double_t maxDiff2 = -1;
+  Double_t maxDiffX = 0, maxDiffY = 0;
+  Int_t last = 0;
+  for (Int_t j = 0; j < np; j++) {
+    if (last < j) {
+      last = j;
+      windowX = 0;
+      windowY = 0;
+    }
+    while (last < j + np) {
+      Int_t k = last % np;
+      Double_t phi = particles[k].fPhi + (last >= np ? TMath::TwoPi() : 0.);
+      if (phi >= particles[j].fPhi + TMath::Pi()) break;
+      windowX += particles[k].fX;
+      windowY += particles[k].fY;
+      last++;
+    }
+
+    // Particles exactly back-to-back to particle j, only in the closed half turn
+    Double_t backX = 0, backY = 0;
+    for (Int_t kk = last; kk < j + np; kk++) {
+      Int_t k = kk % np;
+      Double_t phi = particles[k].fPhi + (kk >= np ? TMath::TwoPi() : 0.);
+      if (phi != particles[j].fPhi + TMath::Pi()) break;
+      backX += particles[k].fX;
+      backY += particles[k].fY;
+    }
+
+    for (Int_t iclosed = 0; iclosed < 2; iclosed++) {
+      Double_t diffX = 2 * (windowX + iclosed * backX) - sumX;
+      Double_t diffY = 2 * (windowY + iclosed * backY) - sumY;
+      Double_t diff2 = diffX * diffX + diffY * diffY;
+      if (diff2 > maxDiff2) {
+        maxDiff2 = diff2;
+        maxDiffX = diffX;
+        maxDiffY = diffY;
+      }
+    }
+
+    windowX -= particles[j].fX;
+    windowY -= particles[j].fY;
+  }
+  if (axisPhi) *axisPhi = TMath::ATan2(maxDiffY, maxDiffX);
+
+  Double_t thrust = TMath::Sqrt(maxDiff2) / sumpt;
+
+  if (fgCheckLegacy) {
+    // The scan misses the axis by at most half a step
+    const Int_t nSteps = 3600;
+    Double_t legacy = ThrustLegacy(n, px, py, nSteps);
+    Double_t maxScanDiff = thrust * (1 - TMath::Cos(TMath::Pi() / nSteps)) + fgLegacyTolerance;
+    if (legacy > thrust + fgLegacyTolerance || thrust - legacy > maxScanDiff) {
+      fgNLegacyMismatches++;
+      ::Warning("AliEventShapeUtils::Thrust", "Thrust %f differs from legacy value %f (%d particles)", thrust, legacy, n);
+    }
+  }
+
+  return thrust;
+}
+
+/**
+ * Transverse sphericity, from the eigenvalues of the linearised transverse momentum tensor
+ * sum p_i^a p_i^b / pT_i / sum pT_i.
+ *
+ * @param[in] n Number of particles
+ * @param[in] px Particle px
+ * @param[in] py Particle py
+ * @return Sphericity in [0, 1], -1 if there is no particle with pT > 0
+ */
+Double_t AliEventShapeUtils::TransverseSphericity(Int_t n, const Double_t *px, const Double_t *py)
+{
+  Double_t s00 = 0, s01 = 0, s11 = 0, sumpt = 0;
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pt = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+    if (pt <= 0) continue;
+    s00 += px[i] * px[i] / pt;
+    s01 += px[i] * py[i] / pt;
+    s11 += py[i] * py[i] / pt;
+    sumpt += pt;
+  }
+  if (!(sumpt > 0)) return -1;
+
+  s00 /= sumpt;
+  s01 /= sumpt;
+  s11 /= sumpt;
+
+  Double_t trace = s00 + s11;
+  Double_t delta = trace * trace - 4 * (s00 * s11 - s01 * s01);
+  if (delta < 0) delta = 0;
+  Double_t lambda2 = (trace - TMath::Sqrt(delta)) / 2;
+  if (trace == 0) return 0;
+  return 2 * lambda2 / trace;
+}
+
+/**
+ * Legacy spherocity, as AliSpherocityEstimator::GetSpherocity: O(N^2) loop over the axes
+ * along each particle.
+ *
+ * @param[in] n Number of particles
+ * @param[in] px Particle px
+ * @param[in] py Particle py
+ * @param[in] ptWeighted Use the particle momenta, otherwise unit vectors
+ * @return Spherocity, -1 if there is no particle with pT > 0
+ */
+Double_t AliEventShapeUtils::SpherocityLegacy(Int_t n, const Double_t *px, const Double_t *py, Bool_t ptWeighted)
+{
+  Double_t sumw = 0;
+  std::vector<Double_t> nx, ny, wx, wy;
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pt = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+    if (pt <= 0) continue;
+    Double_t w = ptWeighted ? pt : 1.;
+    nx.push_back(px[i] / pt);
+    ny.push_back(py[i] / pt);
+    wx.push_back(w * nx.back());
+    wy.push_back(w * ny.back());
+    sumw += w;
+  }
+  if (nx.empty()) return -1;
+
+  Double_t retval = 2;
+  for (UInt_t i = 0; i < nx.size(); i++) {
+    Double_t num = 0;
+    for (UInt_t j = 0; j < nx.size(); j++)
+      num += TMath::Abs(ny[i] * wx[j] - nx[i] * wy[j]);
+    Double_t sFull = TMath::Power((num / sumw), 2);
+    if (sFull < retval)
+      retval = sFull;
+  }
+  return retval * TMath::Pi() * TMath::Pi() / 4;
+}
+
+/**
+ * Spherocity from a scan of nSteps trial axes over a full turn, as AliEventClassifierSpherocity
+ * and AliTransverseEventShape. It is at least the exact value, by up to the error of the step.
+ *
+ * @param[in] n Number of particles
+ * @param[in] px Particle px
+ * @param[in] py Particle py
+ * @param[in] ptWeighted Use the particle momenta, otherwise unit vectors
+ * @param[in] nSteps Number of trial axes
+ * @return Spherocity, -1 if there is no particle with pT > 0
+ */
+Double_t AliEventShapeUtils::SpherocityScan(Int_t n, const Double_t *px, const Double_t *py, Bool_t ptWeighted, Int_t nSteps)
+{
+  Double_t sumw = 0;
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pt = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+    if (pt > 0) sumw += ptWeighted ? pt : 1.;
+  }
+  if (!(sumw > 0)) return -1;
+
+  Double_t minRatio2 = 2;
+  for (Int_t istep = 0; istep < nSteps; istep++) {
+    Double_t phi = TMath::TwoPi() * istep / nSteps;
+    Double_t nx = TMath::Cos(phi);
+    Double_t ny = TMath::Sin(phi);
+    Double_t num = 0;
+    for (Int_t i = 0; i < n; i++) {
+      Double_t pt = TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+      if (pt <= 0) continue;
+      Double_t w = ptWeighted ? 1. : 1. / pt;
+      num += w * TMath::Abs(ny * px[i] - nx * py[i]);
+    }
+    Double_t ratio2 = (num / sumw) * (num / sumw);
+    if (ratio2 < minRatio2) minRatio2 = ratio2;
+  }
+  return minRatio2 * TMath::Pi() * TMath::Pi() / 4;
+}
+
+/**
+ * Thrust from a scan of nSteps trial axes over a full turn. It is at most the exact value, by
+ * up to the error of the step.
+ *
+ * @param[in] n Number of particles
+ * @param[in] px Particle px
+ * @param[in] py Particle py
+ * @param[in] nSteps Number of trial axes
+ * @return Thrust, -1 if there is no particle with pT > 0
+ */
+Double_t AliEventShapeUtils::ThrustLegacy(Int_t n, const Double_t *px, const Double_t *py, Int_t nSteps)
+{
+  Double_t sumpt = 0;
+  for (Int_t i = 0; i < n; i++) sumpt += TMath::Sqrt(px[i]*px[i] + py[i]*py[i]);
+  if (!(sumpt > 0)) return -1;
+
+  Double_t maxNum = 0;
+  for (Int_t istep = 0; istep < nSteps; istep++) {
+    Double_t phi = TMath::TwoPi() * istep / nSteps;
+    Double_t nx = TMath::Cos(phi);
+    Double_t ny = TMath::Sin(phi);
+    Double_t num = 0;
+    for (Int_t i = 0; i < n; i++)
+      num += TMath::Abs(nx * px[i] + ny * py[i]);
+    if (num > maxNum) maxNum = num;
+  }
+  return maxNum / sumpt;
+}
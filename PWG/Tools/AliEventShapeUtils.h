@@ -0,0 +1,63 @@
+/**
+ * \file AliEventShapeUtils.h
+ * \brief Declaration of class AliEventShapeUtils
+ *
+ * In this header file the class AliEventShapeUtils is declared.
+ * It computes the transverse event shapes (spherocity, sphericity and thrust) of a set of
+ * particles given by flat px/py arrays, so that the tasks do not carry their own loops.
+ *
+ * \date Oct 18, 2026
+ */
+#ifndef ALIEVENTSHAPEUTILS_H
+#define ALIEVENTSHAPEUTILS_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <Rtypes.h>
+
+/**
+ * \class AliEventShapeUtils
+ * \brief Transverse event shapes from flat px/py arrays
+ *
+ * Spherocity and thrust are computed exactly in O(N log N), by sorting the particles
+ * in azimuth and sweeping over the axes where the minimum or maximum can be reached,
+ * instead of scanning trial axes:
+ * - Spherocity, S0 = pi^2/4 (min_n sum |p_i x n| / sum p_i)^2. The sum is a sum of |sin| arcs,
+ *   concave between the directions of two consecutive particles, so its minimum is reached
+ *   for an axis along one of the particles, as in the O(N^2) AliSpherocityEstimator.
+ *   Unweighted spherocity uses unit vectors instead of the particle momenta.
+ * - Thrust, T = max_n sum |p_i . n| / sum p_i, reached for the axis along the difference of the
+ *   momenta on both sides of a line, one line per particle direction.
+ * - Transverse sphericity, 2 lambda2 / (lambda1 + lambda2) of the linearised momentum tensor
+ *   sum p_i^a p_i^b / pT_i, as in AliEventClassifierSphericity.
+ *
+ * Particles with pT = 0 are ignored; -1 is returned if no particle is left.
+ *
+ * The legacy implementations are kept (SpherocityLegacy(), ThrustLegacy()) and, if
+ * SetCheckLegacy() is on, each value is compared to them and a warning is printed in case
+ * of difference, counted in GetNLegacyMismatches().
+ */
+class AliEventShapeUtils {
+public:
+  static Double_t Spherocity(Int_t n, const Double_t *px, const Double_t *py, Bool_t ptWeighted = kTRUE, Double_t *axisPhi = 0);
+  static Double_t Thrust(Int_t n, const Double_t *px, const Double_t *py, Double_t *axisPhi = 0);
+  static Double_t TransverseSphericity(Int_t n, const Double_t *px, const Double_t *py);
+
+  static Double_t SpherocityLegacy(Int_t n, const Double_t *px, const Double_t *py, Bool_t ptWeighted = kTRUE);
+  static Double_t SpherocityScan(Int_t n, const Double_t *px, const Double_t *py, Bool_t ptWeighted = kTRUE, Int_t nSteps = 3600);
+  static Double_t ThrustLegacy(Int_t n, const Double_t *px, const Double_t *py, Int_t nSteps = 3600);
+
+  static void     SetCheckLegacy(Bool_t check, Double_t tolerance = 1e-6) { fgCheckLegacy = check; fgLegacyTolerance = tolerance; }
+  static Bool_t   IsCheckLegacy()                                         { return fgCheckLegacy; }
+  static Int_t    GetNLegacyMismatches()                                  { return fgNLegacyMismatches; }
+
+private:
+  static Bool_t   fgCheckLegacy;          ///< Compare the results to the legacy implementations
+  static Double_t fgLegacyTolerance;      ///< Tolerated difference with the legacy implementations
+  static Int_t    fgNLegacyMismatches;    ///< Number of values differing from the legacy implementations
+
+  ClassDef(AliEventShapeUtils, 0) // Transverse event shapes
+};
+
+#endif /* ALIEVENTSHAPEUTILS_H */
@@ -69,7 +69,19 @@ fCutRegistry(0x0),
 fEvent(0x0),
 fMCEvent(0x0),
 fHistogramToDisable(0x0),
-fHasMC(kFALSE)
+fHasMC(kFALSE),
+fSlotNames(),
+fSlotDisabled(),
+fCombinationPaths(),
+fCombinationIndex(),
+fHandleObjects(),
+fHandleResolved(),
+fLastEventSelection(),
+fLastTriggerClassName(),
+fLastCentrality(),
+fLastCuts(),
+fLastCutMC(),
+fLastCutCombinations()
 {
  /// default ctor
 }
@@ -103,6 +115,62 @@ TString AliAnalysisMuMuBase::BuildMCPath(const char* eventSelection, const char*
   return mcPath;
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::Combination(const char* eventSelection, const char* triggerClassName,
+                                       const char* centrality, const char* cut, Bool_t mc)
+{
+  /// Get the index of the path eventSelection/triggerClassName/centrality/cut
+  /// (or of its MC counterpart), to be used with HandleHisto.
+  /// The event part of the path does not change within one event, so it is
+  /// only compared to the one of the previous call, and the path string is only
+  /// built the first time a given combination is seen.
+
+  if ( fLastEventSelection != eventSelection ||
+       fLastTriggerClassName != triggerClassName ||
+       fLastCentrality != centrality )
+  {
+    fLastEventSelection = eventSelection;
+    fLastTriggerClassName = triggerClassName;
+    fLastCentrality = centrality;
+    fLastCuts.clear();
+    fLastCutMC.clear();
+    fLastCutCombinations.clear();
+  }
+
+  for ( std::vector<std::string>::size_type i = 0; i < fLastCuts.size(); ++i )
+  {
+    if ( fLastCutMC[i] == mc && fLastCuts[i] == cut )
+    {
+      return fLastCutCombinations[i];
+    }
+  }
+
+  TString path = mc ? BuildMCPath(eventSelection,triggerClassName,centrality,cut)
+                    : BuildPath(eventSelection,triggerClassName,centrality,cut);
+
+  Int_t combination;
+  std::map<std::string,Int_t>::const_iterator it = fCombinationIndex.find(path.Data());
+
+  if ( it != fCombinationIndex.end() )
+  {
+    combination = it->second;
+  }
+  else
+  {
+    combination = fCombinationPaths.size();
+    fCombinationPaths.push_back(path.Data());
+    fCombinationIndex[path.Data()] = combination;
+    fHandleObjects.push_back(std::vector<TObject*>());
+    fHandleResolved.push_back(std::vector<Bool_t>());
+  }
+
+  fLastCuts.push_back(cut);
+  fLastCutMC.push_back(mc);
+  fLastCutCombinations.push_back(combination);
+
+  return combination;
+}
+
 
 //_____________________________________________________________________________
 void
@@ -204,6 +272,8 @@ AliAnalysisMuMuBase::CreateHistos(const TObjArray& paths,
 
     HistogramCollection()->Adopt(pathName->String().Data(),h);
   }
+
+  ResetHandles();
 }
 
 //_____________________________________________________________________________
@@ -302,6 +372,8 @@ AliAnalysisMuMuBase::CreatePairTHnSparse(UInt_t dataType,
     if( HistogramCollection()->Adopt(pathName->String().Data(),h))
     printf("%s/%s adopted\n",pathName->String().Data(),h->GetName() );
   }
+
+  ResetHandles();
 }
 
 //_____________________________________________________________________________
@@ -349,6 +421,8 @@ AliAnalysisMuMuBase::CreateTrackTHnSparse(UInt_t dataType,
     if( HistogramCollection()->Adopt(pathName->String().Data(),h))
     printf("%s/%s adopted\n",pathName->String().Data(),h->GetName() );
   }
+
+  ResetHandles();
 }
 
 //_____________________________________________________________________________
@@ -407,6 +481,11 @@ void AliAnalysisMuMuBase::DisableHistograms(const char* pattern)
   }
 
   fHistogramToDisable->Add(new TObjString(spattern));
+
+  for ( std::vector<std::string>::size_type i = 0; i < fSlotNames.size(); ++i )
+  {
+    fSlotDisabled[i] = IsHistogramDisabled(fSlotNames[i].c_str());
+  }
 }
 
 //_____________________________________________________________________________
@@ -507,6 +586,48 @@ TProfile* AliAnalysisMuMuBase::Prof(const char* eventSelection,
 	return fHistogramCollection ? static_cast<TProfile*>(fHistogramCollection->GetObject(Form("/%s/%s/%s/%s",eventSelection,triggerClassName,cent,what),histoname)) : 0x0;
 }
 
+//_____________________________________________________________________________
+TObject* AliAnalysisMuMuBase::HandleObject(Int_t combination, Int_t slot)
+{
+  /// Get the object of slot for the given combination.
+  /// The lookup in the histogram collection is done once, its result (even
+  /// if null) being kept until the next ResetHandles
+
+  std::vector<TObject*>& objects = fHandleObjects[combination];
+  std::vector<Bool_t>& resolved = fHandleResolved[combination];
+
+  if ( slot >= static_cast<Int_t>(objects.size()) )
+  {
+    objects.resize(fSlotNames.size(),0x0);
+    resolved.resize(fSlotNames.size(),kFALSE);
+  }
+
+  if ( !resolved[slot] )
+  {
+    objects[slot] = fHistogramCollection ? fHistogramCollection->GetObject(fCombinationPaths[combination].c_str(),
+                                                                           fSlotNames[slot].c_str()) : 0x0;
+    resolved[slot] = kTRUE;
+  }
+
+  return objects[slot];
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::HistoSlot(const char* histoname)
+{
+  /// Register a histogram name to be used with HandleHisto and get its slot
+
+  for ( std::vector<std::string>::size_type i = 0; i < fSlotNames.size(); ++i )
+  {
+    if ( fSlotNames[i] == histoname ) return i;
+  }
+
+  fSlotNames.push_back(histoname);
+  fSlotDisabled.push_back(IsHistogramDisabled(histoname));
+
+  return fSlotNames.size()-1;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuBase::Init(AliCounterCollection& cc,
                                AliMergeableCollection& hc,
@@ -518,6 +639,8 @@ void AliAnalysisMuMuBase::Init(AliCounterCollection& cc,
   fHistogramCollection = &hc;
   fBinning             = &binning;
   fCutRegistry         = &registry;
+
+  ResetHandles();
 }
 
 //_____________________________________________________________________________
@@ -638,6 +761,18 @@ TProfile* AliAnalysisMuMuBase::MCProf(const char* eventSelection,
 	return fHistogramCollection ? static_cast<TProfile*>(fHistogramCollection->GetObject(Form("/%s/%s/%s/%s/%s",MCInputPrefix(),eventSelection,triggerClassName,cent,what),histoname)) : 0x0;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuBase::ResetHandles() const
+{
+  /// Forget the objects resolved so far, to be called whenever the content
+  /// of the histogram collection changes
+
+  for ( std::vector<std::vector<Bool_t> >::size_type i = 0; i < fHandleResolved.size(); ++i )
+  {
+    fHandleResolved[i].assign(fHandleResolved[i].size(),kFALSE);
+  }
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuBase::SetEvent(AliVEvent* event, AliMCEvent* mcEvent)
 {
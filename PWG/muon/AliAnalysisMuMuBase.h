@@ -13,6 +13,9 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TProfile.h"
+#include <map>
+#include <string>
+#include <vector>
 
 class AliCounterCollection;
 class AliAnalysisMuMuBinning;
@@ -101,7 +104,7 @@ public:
   Bool_t AlwaysFalse(const AliVParticle& /*particle*/, const AliVParticle& /*particle*/) const { return kFALSE; }
   void NameOfAlwaysFalse(TString& name) const { name = "NONE"; }
 
-  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; }
+  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; ResetHandles(); }
 
 protected:
 
@@ -194,6 +197,21 @@ protected:
 
   Int_t GetNbins(Double_t xmin, Double_t xmax, Double_t xstep);
 
+  /** Histogram handles, for the fill methods called for each track or pair.
+   * A slot is a registered histogram name (with its disabled state evaluated once),
+   * a combination is a registered path eventSelection/triggerClassName/centrality/cut.
+   * HandleHisto(combination,slot) then resolves the histogram once and caches it,
+   * so that no path string is formatted nor looked up at each fill.
+   */
+  Int_t HistoSlot(const char* histoname);
+  Bool_t IsSlotDisabled(Int_t slot) const { return fSlotDisabled[slot]; }
+  Int_t Combination(const char* eventSelection, const char* triggerClassName,
+                    const char* centrality, const char* cut, Bool_t mc=kFALSE);
+  TObject* HandleObject(Int_t combination, Int_t slot);
+  TH1* HandleHisto(Int_t combination, Int_t slot) { return dynamic_cast<TH1*>(HandleObject(combination,slot)); }
+  TProfile* HandleProf(Int_t combination, Int_t slot) { return dynamic_cast<TProfile*>(HandleObject(combination,slot)); }
+  void ResetHandles() const;
+
   AliCounterCollection* CounterCollection() const { return fEventCounters; }
   AliMergeableCollection* HistogramCollection() const { return fHistogramCollection; }
   const AliAnalysisMuMuBinning* Binning() const { return fBinning; }
@@ -215,7 +233,20 @@ private:
   TList* fHistogramToDisable; // list of regexp of histo name to disable
   Bool_t fHasMC; // whether or not we're dealing with MC data
 
-  ClassDef(AliAnalysisMuMuBase,1) // base class for a companion class to AliAnalysisMuMu
+  std::vector<std::string> fSlotNames; //! histogram name of each slot
+  std::vector<Bool_t> fSlotDisabled; //! disabled state of each slot
+  std::vector<std::string> fCombinationPaths; //! path of each combination
+  std::map<std::string,Int_t> fCombinationIndex; //! combination index of each path
+  std::vector<std::vector<TObject*> > fHandleObjects; //! resolved objects, per combination and slot
+  mutable std::vector<std::vector<Bool_t> > fHandleResolved; //! whether the object above has been looked up
+  TString fLastEventSelection; //! event selection of the last Combination call
+  TString fLastTriggerClassName; //! trigger class of the last Combination call
+  TString fLastCentrality; //! centrality of the last Combination call
+  std::vector<std::string> fLastCuts; //! cuts already seen for the last (eventSelection,trigger,centrality)
+  std::vector<Bool_t> fLastCutMC; //! whether the cuts above are for the MC path
+  std::vector<Int_t> fLastCutCombinations; //! combination index of the cuts above
+
+  ClassDef(AliAnalysisMuMuBase,2) // base class for a companion class to AliAnalysisMuMu
 };
 
 #endif
@@ -49,7 +49,9 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fPairSlots(),
+fMinvSlots()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -324,15 +326,19 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   /// Fill histograms for unlike-sign reconstructed  muon pairs.
   /// For the MC case, we check that only tracks with an associated MC label are selected (usefull when running on embedding).
   /// A weight is also applied for MC case at the pair or the muon track level according to SetMuonWeight() and systLevel.
+  /// The histograms are accessed through the handles of AliAnalysisMuMuBase (see RegisterHistoSlots).
 
   // Usual cuts
   if (!AliAnalysisMuonUtility::IsMuonTrack(&tracki) || !AliAnalysisMuonUtility::IsMuonTrack(&trackj) ) return;
 
+  if ( fPairSlots.empty() ) RegisterHistoSlots();
+
   // Get total charge in order to get the correct histo name
   Double_t PairCharge = tracki.Charge() + trackj.Charge();
-  TString scharge  = "";
-  if( PairCharge == +2 )      scharge = "PP";
-  else if( PairCharge == -2 ) scharge = "MM";
+  Int_t iCharge = 0;
+  if( PairCharge == +2 )      iCharge = 1;
+  else if( PairCharge == -2 ) iCharge = 2;
+  Int_t iMix = IsMixedHisto ? 1 : 0;
 
   // Pointers in case running on MC
   Int_t labeli               = 0;
@@ -342,12 +348,9 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TLorentzVector             * pair4MomentumMC(0x0);
   Double_t inputWeightMC(1.);
 
-  // Usefull string :)
-  TString smix = IsMixedHisto ? "Mix" : "";
-
-  // Create proxy in AliMergeableCollection
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,pairCutName));
-  AliMergeableCollectionProxy* mcProxy(0x0); // to be set later maybe
+  // Histogram paths in AliMergeableCollection
+  Int_t comb = Combination(eventSelection,triggerClassName,centrality,pairCutName);
+  Int_t mcComb(-1); // to be set later maybe
 
   // Construct dimuons vector
   TLorentzVector pi(tracki.Px(),tracki.Py(),tracki.Pz(),
@@ -373,47 +376,23 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     // Check if first track is a muon
     mcTracki = MCEvent()->GetTrack(labeli);
     if(!mcTracki) return;
-    if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) return;
 
     // Check if second track is a muon
     mcTrackj = MCEvent()->GetTrack(labelj);
     if(!mcTrackj) return;
-    if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) return;
 
     // Check if tracks has the same mother
     Int_t currMotheri = mcTracki->GetMother();
     Int_t currMotherj = mcTrackj->GetMother();
-    if( currMotheri!=currMotherj ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
-    if( currMotheri<0 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if( currMotheri!=currMotherj ) return;
+    if( currMotheri<0 ) return;
 
     // Check if mother is J/psi
     AliMCParticle* mother = static_cast<AliMCParticle*>(MCEvent()->GetTrack(currMotheri));
-    if(!mother){
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
-    if(mother->PdgCode() !=443) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if(!mother) return;
+    if(mother->PdgCode() !=443) return;
 
     // Weight tracks if specified
     if(!fWeightMuon)      inputWeightMC = WeightPairDistribution(mother->Pt(),mother->Y());
@@ -423,13 +402,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
     if(!mcTracki || !mcTrackj){
       AliError("Miss one or several MC track");
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
-    // Create proxy for MC
-    mcProxy = HistogramCollection()->CreateProxy(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
+    // Histogram path for MC
+    mcComb = Combination(eventSelection,triggerClassName,centrality,pairCutName,kTRUE);
     TLorentzVector mcpi(mcTracki->Px(),mcTracki->Py(),mcTracki->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTracki->P()*mcTracki->P()));
     TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
     mcpj+=mcpi;
@@ -441,25 +418,29 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   else if(fWeightMuon)  inputWeight = WeightMuonDistribution(tracki.Pt()) * WeightMuonDistribution(trackj.Pt());
 
   // Fill some distribution histos
-  if ( !IsHistogramDisabled("Pt")  ) {
+  Int_t iSparse = kSlotSparse + iMix*3 + iCharge;
+  if ( !IsSlotDisabled(fPairSlots[kSlotPt])  ) {
     Double_t x[2] = {pair4Momentum.Pt(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    THnSparse* hn = static_cast<THnSparse*>(HandleObject(comb,fPairSlots[iSparse]));
+    if(hn) hn->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Y")   ){
+  if ( !IsSlotDisabled(fPairSlots[kSlotY])   ){
     Double_t x[2] = {pair4Momentum.Rapidity(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    THnSparse* hn = static_cast<THnSparse*>(HandleObject(comb,fPairSlots[iSparse+6]));
+    if(hn) hn->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Eta") ){
+  if ( !IsSlotDisabled(fPairSlots[kSlotEta]) ){
     Double_t x[2] = {pair4Momentum.Eta(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    THnSparse* hn = static_cast<THnSparse*>(HandleObject(comb,fPairSlots[iSparse+12]));
+    if(hn) hn->Fill(x,inputWeight);
   }
 
-  if ( !IsHistogramDisabled("PtPaireVsPtTrack") && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+  if ( !IsSlotDisabled(fPairSlots[kSlotPtPaireVsPtTrack]) && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
+    TH2* h = static_cast<TH2*>(HandleHisto(comb,fPairSlots[kSlotPtPaireVsPtTrack]));
+    if ( h ) {
+      h->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
+      h->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+    }
   }
 
   // Fill histos with MC stack info (only opposite charge muons)
@@ -472,21 +453,21 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
 
     // Fill histo
-    if ( proxy->Histo("PtRecVsSim") )  proxy->Histo("PtRecVsSim")->Fill(mcpj.Pt(),pair4Momentum.Pt());
-    if ( mcProxy->Histo("Pt"))  mcProxy->Histo("Pt")->Fill(mcpj.Pt(),inputWeightMC);
-    if ( mcProxy->Histo("Y"))   mcProxy->Histo("Y")->Fill(mcpj.Rapidity(),inputWeightMC);
-    if ( mcProxy->Histo("Eta")) mcProxy->Histo("Eta")->Fill(mcpj.Eta());
+    TH1* h(0x0);
+    if ( ( h = HandleHisto(comb,fPairSlots[kSlotPtRecVsSim]) ) ) h->Fill(mcpj.Pt(),pair4Momentum.Pt());
+    if ( ( h = HandleHisto(mcComb,fPairSlots[kSlotPt]) ) )  h->Fill(mcpj.Pt(),inputWeightMC);
+    if ( ( h = HandleHisto(mcComb,fPairSlots[kSlotY]) ) )   h->Fill(mcpj.Rapidity(),inputWeightMC);
+    if ( ( h = HandleHisto(mcComb,fPairSlots[kSlotEta]) ) ) h->Fill(mcpj.Eta());
 
     // set pair4MomentumMC for the rest of the function
     pair4MomentumMC = &mcpj;
   }
 
-  TIter nextBin(fBinsToFill);
-  nextBin.Reset();
-  AliAnalysisMuMuBinning::Range* r;
-
   // Loop over all bin ranges
-  while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
+  Int_t nBins = fBinsToFill ? fBinsToFill->GetLast()+1 : 0;
+  for ( Int_t ir = 0; ir < nBins; ++ir ){
+
+    AliAnalysisMuMuBinning::Range* r = static_cast<AliAnalysisMuMuBinning::Range*>(fBinsToFill->At(ir));
 
     // --- In this loop we first check if the pairs pass some tests and we fill histo accordingly. ---
 
@@ -494,19 +475,17 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     Bool_t ok(kFALSE);
     Bool_t okMC(kFALSE);
 
-    ok = CheckBinRangeCut(r,&pair4Momentum,proxy);
-    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,proxy);
+    ok = CheckBinRangeCut(r,&pair4Momentum,comb);
+    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,comb);
+
+    // Minv histo slots associated to the bin
+    Int_t iMinv   = MinvSlotIndex(ir,kFALSE,iCharge,iMix);
+    Int_t iMinvAE = MinvSlotIndex(ir,kTRUE,iCharge,iMix);
 
     // Check if pair pass all conditions, either MC or not, and fill Minv Histogrames
     if ( ok )
     {
-      // Get Minv histo name associated to the bin
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(comb,iMinv,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() )
@@ -519,23 +498,13 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4Momentum.Pt(),pair4Momentum.Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(comb,iMinvAE,&pair4Momentum,inputWeight/AccxEff);
       }
     }
 
     if ( okMC ) {
 
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(mcComb,iMinv,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() ){
@@ -548,18 +517,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4MomentumMC->Pt(),pair4MomentumMC->Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(mcComb,iMinvAE,&pair4Momentum,inputWeight/AccxEff);
 
       }
     }
   }
-  delete proxy;
-  delete mcProxy;
 }
 
 
@@ -687,21 +649,25 @@ void AliAnalysisMuMuMinv::FillHistosForMCEvent(const char* eventSelection,const
 }
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuMinv::FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight)
+void AliAnalysisMuMuMinv::FillMinvHisto(Int_t combination, Int_t minvIndex, TLorentzVector* pair4Momentum, Double_t inputWeight)
 {
-  /// Create, fill and store Minv histo
-  if (!IsHistogramDisabled(minvName->Data())){
+  /// Fill Minv histo (and mean pT profiles) of the slots minvIndex for the given combination
+  Int_t slot = fMinvSlots[minvIndex];
+
+  if (!IsSlotDisabled(slot)){
 
     TH1* h(0x0);
 
-    h = proxy->Histo(minvName->Data());
+    h = HandleHisto(combination,slot);
     if (h) h->Fill(pair4Momentum->M(),inputWeight);
 
     // Fill Mean pT
     if ( fComputeMeanPt ){
-      if ( !hprof ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      TProfile* hprof  = HandleProf(combination,fMinvSlots[minvIndex+1]);
+      TProfile* hprof2 = HandleProf(combination,fMinvSlots[minvIndex+2]);
+      if ( !hprof ) AliError(Form("Could not get hprofile for %s",h ? h->GetName() : ""));
       else hprof->Fill(pair4Momentum->M(),pair4Momentum->Pt(),inputWeight);
-      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",h ? h->GetName() : ""));
       else hprof2->Fill(pair4Momentum->M(),pair4Momentum->Pt()*pair4Momentum->Pt(),inputWeight);
     }
   }
@@ -818,7 +784,7 @@ Bool_t AliAnalysisMuMuMinv::IsPtInRange(const AliVParticle& t1, const AliVPartic
 }
 
 //_____________________________________________________________________________
-Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy)
+Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, Int_t combination)
 {
   /// Check if our pairs match conditions from the binning range
 
@@ -835,7 +801,7 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
     // Fill NchForJpsi histo according to pair4Momentum.M()
     if ( pair4Momentum->M() >= 2.9 && pair4Momentum->M() <= 3.3 ){
 
-      h = proxy->Histo("NchForJpsi");
+      h = HandleHisto(combination,fPairSlots[kSlotNchForJpsi]);
 
       Double_t ntrcorr = (-1.);
       TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -859,7 +825,7 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
     }
     else if ( pair4Momentum->M() >= 3.6 && pair4Momentum->M() <= 3.9){
 
-      h = proxy->Histo("NchForPsiP");
+      h = HandleHisto(combination,fPairSlots[kSlotNchForPsiP]);
       Double_t ntrcorr = (-1.);
 
       TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -1110,6 +1076,66 @@ void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
+  fPairSlots.clear();
+  fMinvSlots.clear();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::RegisterHistoSlots()
+{
+  /// Register the names of all the histograms filled in FillHistosForPair,
+  /// so that no histogram name has to be formatted for each pair.
+  /// fPairSlots holds the slots indexed by the ESlot enum, followed by the
+  /// THnSparse slots Pt/Y/Eta (times mix, times charge).
+  /// fMinvSlots holds, for each MinvSlotIndex, the slots of the Minv histogram
+  /// and of its MeanPtVs and MeanPtSquareVs profiles.
+
+  const char* sparse[] = { "Pt", "Y", "Eta" };
+  const char* smix[] = { "", "Mix" };
+  const char* scharge[] = { "", "PP", "MM" };
+  const Double_t charge[] = { 0, 2, -2 };
+
+  fPairSlots.clear();
+  fPairSlots.push_back(HistoSlot("PtPaireVsPtTrack"));
+  fPairSlots.push_back(HistoSlot("PtRecVsSim"));
+  fPairSlots.push_back(HistoSlot("Pt"));
+  fPairSlots.push_back(HistoSlot("Y"));
+  fPairSlots.push_back(HistoSlot("Eta"));
+  fPairSlots.push_back(HistoSlot("NchForJpsi"));
+  fPairSlots.push_back(HistoSlot("NchForPsiP"));
+
+  for ( Int_t iVar = 0; iVar < 3; ++iVar )
+  {
+    for ( Int_t iMix = 0; iMix < 2; ++iMix )
+    {
+      for ( Int_t iCharge = 0; iCharge < 3; ++iCharge )
+      {
+        fPairSlots.push_back(HistoSlot(Form("%s%s%s",sparse[iVar],smix[iMix],scharge[iCharge])));
+      }
+    }
+  }
+
+  fMinvSlots.clear();
+  if ( !fBinsToFill ) return;
+
+  for ( Int_t ir = 0; ir <= fBinsToFill->GetLast(); ++ir )
+  {
+    const AliAnalysisMuMuBinning::Range* r = static_cast<const AliAnalysisMuMuBinning::Range*>(fBinsToFill->At(ir));
+
+    for ( Int_t iAccEff = 0; iAccEff < 2; ++iAccEff )
+    {
+      for ( Int_t iCharge = 0; iCharge < 3; ++iCharge )
+      {
+        for ( Int_t iMix = 0; iMix < 2; ++iMix )
+        {
+          TString minvName = GetMinvHistoName(*r,iAccEff,charge[iCharge],iMix);
+          fMinvSlots.push_back(HistoSlot(minvName.Data()));
+          fMinvSlots.push_back(HistoSlot(Form("MeanPtVs%s",minvName.Data())));
+          fMinvSlots.push_back(HistoSlot(Form("MeanPtSquareVs%s",minvName.Data())));
+        }
+      }
+    }
+  }
 }
 
 //________________________________________________________________________
@@ -72,10 +72,20 @@ protected:
 
   void FillHistosForMCEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
 
-  void FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight);
+  void FillMinvHisto(Int_t combination, Int_t minvIndex, TLorentzVector* pair4Momentum, Double_t inputWeight);
 
 private:
 
+  /// slots of fPairSlots
+  enum ESlot { kSlotPtPaireVsPtTrack, kSlotPtRecVsSim, kSlotPt, kSlotY, kSlotEta,
+               kSlotNchForJpsi, kSlotNchForPsiP, kSlotSparse };
+
+  void RegisterHistoSlots();
+
+  /// index in fMinvSlots of the Minv histogram of bin range ir
+  Int_t MinvSlotIndex(Int_t ir, Bool_t accEffCorrected, Int_t iCharge, Int_t iMix) const
+  { return 3*(((ir*2+(accEffCorrected ? 1 : 0))*3+iCharge)*2+iMix); }
+
   void CreateMinvHistograms(const char* eventSelection, const char* triggerClassName, const char* centrality);
 
   // normalize the function to its integral in the given range
@@ -91,7 +101,7 @@ private:
 
   Double_t TriggerLptApt(Double_t *x, Double_t *par);
 
-  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy);
+  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, Int_t combination);
 
   Bool_t CheckMCTracksMatchingStackAndMother(Int_t labeli, Int_t labelj, AliVParticle* mcTracki, AliVParticle* mcTrackj, Double_t inputWeightMC);
 
@@ -111,8 +121,10 @@ private:
   Double_t fMinvMax;
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
+  std::vector<Int_t> fPairSlots; //! histogram slots of the pair distributions (see RegisterHistoSlots)
+  std::vector<Int_t> fMinvSlots; //! histogram slots of the Minv histograms (see MinvSlotIndex)
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
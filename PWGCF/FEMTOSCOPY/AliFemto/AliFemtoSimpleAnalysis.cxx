@@ -13,6 +13,9 @@
 #include <string>
 #include <iostream>
 #include <iterator>
+#include <vector>
+#include <algorithm>
+#include <cmath>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -183,7 +186,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fPairQinvMax(0.0),
+  fNPairsPruned(0)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +210,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fPairQinvMax(a.fPairQinvMax),
+  fNPairsPruned(0)
 {
   /// Copy constructor
 
@@ -402,6 +409,7 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fPairQinvMax = aAna.fPairQinvMax;
 
   return *this;
 }
@@ -430,6 +438,10 @@ AliFemtoString AliFemtoSimpleAnalysis::Report()
   report += "Particle Cuts - First Particle:\n" + fFirstParticleCut->Report() + "\n";
   report += "Particle Cuts - Second Particle:\n" + fSecondParticleCut->Report() + "\n";
   report += "Pair Cuts:\n" + fPairCut->Report() + "\n";
+  if (fPairQinvMax > 0.0) {
+    report += TString::Format("Pairs with q_inv > %g skipped: %llu\n",
+                              fPairQinvMax, (unsigned long long)fNPairsPruned);
+  }
 
   report += "\nCorrelation Functions:\n";
 
@@ -598,6 +610,12 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
   // "Seed" this here.
   bool swpart = fNeventsProcessed % 2;
 
+  if (fPairQinvMax > 0.0) {
+    MakePairsQinvPruned(these_are_real_pairs, partCollection1, partCollection2,
+                        enablePairMonitors, swpart);
+    return;
+  }
+
   // Setup iterator ranges
   //
   // The outer loop alway starts at beginning of particle collection 1.
@@ -655,28 +673,192 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
         swpart = !swpart;
       }
 
-      // check if the pair passes the cut
-      bool tmpPassPair = fPairCut->Pass(tPair);
+      ProcessPair(tPair, these_are_real_pairs, enablePairMonitors);
+
+    }    // loop over second particle
+  }      // loop over first particle
+
+  // we are done with the pair
+  delete tPair;
+}
+
+//_________________________
+void AliFemtoSimpleAnalysis::ProcessPair(AliFemtoPair *tPair,
+                                         bool these_are_real_pairs,
+                                         Bool_t enablePairMonitors)
+{
+  // check if the pair passes the cut
+  bool tmpPassPair = fPairCut->Pass(tPair);
+
+  // This is a condition for speed reasons
+  if (enablePairMonitors) {
+    fPairCut->FillCutMonitor(tPair, tmpPassPair);
+  }
+
+  // If pair passes cut, loop over CF's and add pair to real/mixed
+  if (tmpPassPair) {
+    for (auto &tCorrFctn : *fCorrFctnCollection) {
+      if (these_are_real_pairs)
+        tCorrFctn->AddRealPair(tPair);
+      else
+        tCorrFctn->AddMixedPair(tPair);
+    } // loop over correlation functions
+  }
+}
+
+namespace {
+
+/// Particle of the inner loop of MakePairsQinvPruned, sorted in rapidity
+struct AliFemtoRapidityEntry {
+  double rapidity;
+  double mass;
+  unsigned int index;   ///< position in the original collection
+  AliFemtoParticle *particle;
+
+  bool operator<(const AliFemtoRapidityEntry &rhs) const
+    { return rapidity < rhs.rapidity; }
+};
+
+bool RapidityLess(const AliFemtoRapidityEntry &entry, double y)
+{
+  return entry.rapidity < y;
+}
+
+bool RapidityGreater(double y, const AliFemtoRapidityEntry &entry)
+{
+  return y < entry.rapidity;
+}
+
+/// Largest |y1 - y2| for which a pair of masses m1, m2 can have q_inv < qinvMax.
+///
+/// With m_T1 m_T2 >= p_T1 p_T2 + m1 m2 one gets
+///   -(p1-p2)^2 >= 4 m1 m2 sinh^2(dy/2) - (m1-m2)^2
+/// Returns a negative value if no bound can be given.
+double MaxRapidityDifference(double m1, double m2, double qinvMax)
+{
+  if (m1 <= 0.0 || m2 <= 0.0) {
+    return -1.0;
+  }
+  const double dm = m1 - m2;
+  return 2.0 * std::asinh(std::sqrt((qinvMax * qinvMax + dm * dm) / (4.0 * m1 * m2)));
+}
+
+bool Rapidity(const AliFemtoLorentzVector &p, double &y, double &mass)
+{
+  const double mass2 = p.m2();
+  if (mass2 <= 0.0 || p.e() <= std::fabs(p.pz())) {
+    return false;
+  }
+  mass = std::sqrt(mass2);
+  y = 0.5 * std::log((p.e() + p.pz()) / (p.e() - p.pz()));
+  return true;
+}
+
+}
+
+//_________________________
+void AliFemtoSimpleAnalysis::MakePairsQinvPruned(bool these_are_real_pairs,
+                                                 AliFemtoParticleCollection *partCollection1,
+                                                 AliFemtoParticleCollection *partCollection2,
+                                                 Bool_t enablePairMonitors,
+                                                 bool swpart)
+{
+  // The particles of the inner loop are sorted once in rapidity, so that for
+  // each particle of the outer loop only the partners within the rapidity
+  // window allowed by fPairQinvMax are visited. The remaining candidates are
+  // checked with the exact q_inv (as AliFemtoPair::QInv) before any pair is
+  // built. For identical particles the pair (i, j), i < j, is formed with the
+  // same particle order as in MakePairs.
+
+  const bool identical = (partCollection2 == nullptr);
+  AliFemtoParticleCollection *innerCollection = identical ? partCollection1
+                                                          : partCollection2;
+  const ULong64_t n1 = partCollection1->size(),
+                  n2 = innerCollection->size();
+  const ULong64_t nAllPairs = !identical ? n1 * n2
+                            : n1 > 0 ? n1 * (n1 - 1) / 2
+                            : 0;
+
+  std::vector<AliFemtoRapidityEntry> sorted;
+  sorted.reserve(n2);
+
+  // rapidity window only usable if all particles have a positive mass
+  bool useWindow = true;
+  double minMass = 0.0, maxMass = 0.0;
+  unsigned int index = 0;
+  for (auto particle : *innerCollection) {
+    AliFemtoRapidityEntry entry = {0.0, 0.0, index++, particle};
+    if (!Rapidity(particle->FourMomentum(), entry.rapidity, entry.mass)) {
+      useWindow = false;
+    }
+    if (sorted.empty() || entry.mass < minMass) {
+      minMass = entry.mass;
+    }
+    if (sorted.empty() || entry.mass > maxMass) {
+      maxMass = entry.mass;
+    }
+    sorted.push_back(entry);
+  }
+  if (useWindow) {
+    std::sort(sorted.begin(), sorted.end());
+  }
+
+  AliFemtoPair* tPair = new AliFemtoPair;
+  ULong64_t nPairsBuilt = 0;
+
+  unsigned int index1 = 0;
+  for (AliFemtoParticleConstIterator tPartIter1 = partCollection1->begin();
+                                     tPartIter1 != partCollection1->end();
+                                     ++tPartIter1, ++index1) {
+    AliFemtoParticle *particle1 = *tPartIter1;
+    const AliFemtoLorentzVector &p1 = particle1->FourMomentum();
+
+    std::vector<AliFemtoRapidityEntry>::const_iterator first = sorted.begin(),
+                                                       last = sorted.end();
+    double y1, m1;
+    if (useWindow && Rapidity(p1, y1, m1)) {
+      // the bound is largest at one of the mass extremes of the partners
+      const double dy = std::max(MaxRapidityDifference(m1, minMass, fPairQinvMax),
+                                 MaxRapidityDifference(m1, maxMass, fPairQinvMax));
+      if (dy >= 0.0) {
+        first = std::lower_bound(sorted.begin(), sorted.end(), y1 - dy, RapidityLess);
+        last = std::upper_bound(first, sorted.cend(), y1 + dy, RapidityGreater);
+      }
+    }
+
+    if (!identical) {
+      tPair->SetTrack1(particle1);
+    }
 
-      // This is a condition for speed reasons
-      if (enablePairMonitors) {
-        fPairCut->FillCutMonitor(tPair, tmpPassPair);
+    for (auto entry = first; entry != last; ++entry) {
+      if (identical && entry->index <= index1) {
+        continue;
       }
 
-      // If pair passes cut, loop over CF's and add pair to real/mixed
-      if (tmpPassPair) {
-        for (auto &tCorrFctn : *fCorrFctnCollection) {
-          if (these_are_real_pairs)
-            tCorrFctn->AddRealPair(tPair);
-          else
-            tCorrFctn->AddMixedPair(tPair);
-        } // loop over correlation functions
+      const AliFemtoLorentzVector tDiff = p1 - entry->particle->FourMomentum();
+      if (-tDiff.m() > fPairQinvMax) {
+        continue;
       }
 
-    }    // loop over second particle
-  }      // loop over first particle
+      if (!identical) {
+        tPair->SetTrack2(entry->particle);
+      } else {
+        // position of the pair in the loop of MakePairs, which alternates
+        // the particle order from one pair to the next
+        const ULong64_t i = index1, j = entry->index;
+        const ULong64_t k = i * n1 - i * (i + 1) / 2 + (j - i - 1);
+        const bool swap = swpart != static_cast<bool>(k % 2);
+        tPair->SetTrack1(swap ? entry->particle : particle1);
+        tPair->SetTrack2(swap ? particle1 : entry->particle);
+      }
+
+      ++nPairsBuilt;
+      ProcessPair(tPair, these_are_real_pairs, enablePairMonitors);
+    }
+  }
+
+  fNPairsPruned += nAllPairs - nPairsBuilt;
 
-  // we are done with the pair
   delete tPair;
 }
 //_________________________
@@ -99,6 +99,18 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Skip pairs with q_inv above this value before the pair cut and the
+  /// correlation functions are called. The partners are pre-sorted in
+  /// rapidity, and pairs whose rapidity difference alone implies
+  /// q_inv > aQinvMax are never looked at. Only use this if none of the
+  /// correlation functions (or pair cut monitors) need pairs at larger
+  /// q_inv. A value <= 0 (default) disables the pruning.
+  void SetPairQinvMax(double aQinvMax);
+  double PairQinvMax() const;
+
+  /// Number of pairs skipped by the q_inv pruning so far
+  ULong64_t GetNPairsPruned() const;
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -159,6 +171,20 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// MakePairs implementation used when fPairQinvMax > 0. Produces the same
+  /// pairs (and the same particle ordering within identical pairs) as
+  /// MakePairs, minus those with q_inv > fPairQinvMax.
+  void MakePairsQinvPruned(bool these_are_real_pairs,
+                           AliFemtoParticleCollection* ParticlesPassingCut1,
+                           AliFemtoParticleCollection* ParticlesPassingCut2,
+                           Bool_t enablePairMonitors,
+                           bool swpart);
+
+  /// Run the pair cut on the pair and pass it to the correlation functions
+  void ProcessPair(AliFemtoPair* aPair,
+                   bool these_are_real_pairs,
+                   Bool_t enablePairMonitors);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -178,6 +204,9 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  double fPairQinvMax;                               ///< Pairs above this q_inv are skipped, disabled if <= 0
+  ULong64_t fNPairsPruned;                           ///< Number of pairs skipped by the q_inv pruning
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
@@ -242,6 +271,16 @@ inline bool AliFemtoSimpleAnalysis::EnablePairMonitors()
   return fEnablePairMonitors;
 }
 
+inline double AliFemtoSimpleAnalysis::PairQinvMax() const
+{
+  return fPairQinvMax;
+}
+
+inline ULong64_t AliFemtoSimpleAnalysis::GetNPairsPruned() const
+{
+  return fNPairsPruned;
+}
+
 // Sets
 inline void AliFemtoSimpleAnalysis::SetPairCut(AliFemtoPairCut* x)
 {
@@ -305,4 +344,9 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetPairQinvMax(double aQinvMax)
+{
+  fPairQinvMax = aQinvMax;
+}
+
 #endif
@@ -73,6 +73,9 @@ class AliFemtoDreamCorrHists {
   bool GetDoAncestorsPlots() {
     return fAncestors;
   }
+  bool GetMinimalBooking() const {
+    return fMinimalBooking;
+  }
   void FillSameEventDist(int i, float RelK) {
     fSameEventDist[i]->Fill(RelK);
   }
@@ -154,6 +154,20 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
                   TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
 
   float RelativeK = RelativePairMomentum(PartOne, PartTwo);
+  bool common =
+      (fillHists && fHists->GetDoAncestorsPlots()) ?
+          CommonAncestors(part1, part2) : false;
+  FillSameEvent(iHC, Mult, cent, RelativeK, RelativePairkT(PartOne, PartTwo),
+                RelativePairmT(PartOne, PartTwo), Part1Momentum.Pt(),
+                Part2Momentum.Pt(), common);
+  return RelativeK;
+}
+
+void AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
+                                                float RelativeK, float kT,
+                                                float mT, float pt1, float pt2,
+                                                bool common) {
+  bool fillHists = fWhichPairs.at(iHC);
   fHists->FillSameEventDist(iHC, RelativeK);
   if (fHists->GetDoMultBinning()) {
     fHists->FillSameEventMultDist(iHC, Mult + 1, RelativeK);
@@ -162,51 +176,44 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
     fHists->FillSameEventCentDist(iHC, cent, RelativeK);
   }
   if (fillHists && fHists->GetDokTBinning()) {
-    fHists->FillSameEventkTDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                RelativeK, cent);
+    fHists->FillSameEventkTDist(iHC, kT, RelativeK, cent);
   }
   if (fillHists && fHists->GetDomTBinning()) {
-    fHists->FillSameEventmTDist(iHC, RelativePairmT(PartOne, PartTwo),
-                                RelativeK);
+    fHists->FillSameEventmTDist(iHC, mT, RelativeK);
   }
   if (fillHists && fHists->GetDokTandMultBinning()) {
-    fHists->FillSameEventkTandMultDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                       RelativeK, Mult + 1);
+    fHists->FillSameEventkTandMultDist(iHC, kT, RelativeK, Mult + 1);
   }
   if (fillHists && fHists->GetDomTMultPlots()) {
-    fHists->FillSameEventmTMultDist(iHC, RelativePairmT(PartOne, PartTwo), Mult + 1, 
-				   RelativeK); 
-  }   
+    fHists->FillSameEventmTMultDist(iHC, mT, Mult + 1, RelativeK);
+  }
   if (fillHists && fHists->GetDoPtQA()) {
-    fHists->FillPtQADist(iHC, RelativeK, Part1Momentum.Pt(),
-                         Part2Momentum.Pt());
-    fHists->FillPtSEOneQADist(iHC, Part1Momentum.Pt(), Mult + 1);
-    fHists->FillPtSETwoQADist(iHC, Part2Momentum.Pt(), Mult + 1);
-    
-    fHists->FillKstarPtSEOneQADist(iHC, RelativeK, Part1Momentum.Pt());
-    fHists->FillKstarPtSETwoQADist(iHC, RelativeK, Part2Momentum.Pt());
+    fHists->FillPtQADist(iHC, RelativeK, pt1, pt2);
+    fHists->FillPtSEOneQADist(iHC, pt1, Mult + 1);
+    fHists->FillPtSETwoQADist(iHC, pt2, Mult + 1);
+
+    fHists->FillKstarPtSEOneQADist(iHC, RelativeK, pt1);
+    fHists->FillKstarPtSETwoQADist(iHC, RelativeK, pt2);
   }
   if (fillHists && fHists->GetDoAncestorsPlots()) {
-    bool isAlabama = CommonAncestors(part1,part2);
-    if (isAlabama) {
+    if (common) {
       fHists->FillSameEventDistCommon(iHC, RelativeK);
       if (fHists->GetDoMultBinning()) {
-	fHists->FillSameEventMultDistCommon(iHC, Mult + 1, RelativeK);
+        fHists->FillSameEventMultDistCommon(iHC, Mult + 1, RelativeK);
       }
       if (fHists->GetDomTBinning()) {
-	fHists->FillSameEventmTDistCommon(iHC, RelativePairmT(PartOne, PartTwo), RelativeK);
+        fHists->FillSameEventmTDistCommon(iHC, mT, RelativeK);
       }
     } else {
       fHists->FillSameEventDistNonCommon(iHC, RelativeK);
       if (fHists->GetDoMultBinning()) {
-	fHists->FillSameEventMultDistNonCommon(iHC, Mult + 1, RelativeK);
+        fHists->FillSameEventMultDistNonCommon(iHC, Mult + 1, RelativeK);
       }
       if (fHists->GetDomTBinning()) {
-	fHists->FillSameEventmTDistNonCommon(iHC, RelativePairmT(PartOne, PartTwo), RelativeK);
+        fHists->FillSameEventmTDistNonCommon(iHC, mT, RelativeK);
       }
     }
   }
-  return RelativeK;
 }
 
 void AliFemtoDreamHigherPairMath::MassQA(int iHC, float RelK,
@@ -243,7 +250,6 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
   if (PDGPart1 == 0 || PDGPart2 == 0) {
     AliError("Invalid PDG Code");
   }
-  bool fillHists = fWhichPairs.at(iHC);
   TLorentzVector PartOne, PartTwo;
   TVector3 Part1Momentum = part1.GetMomentum();
   TVector3 Part2Momentum = part2.GetMomentum();
@@ -266,6 +272,17 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
     PartTwo.SetPhi(PartTwo.Phi() + fRandom.Uniform(2 * fPi));
   }
   float RelativeK = RelativePairMomentum(PartOne, PartTwo);
+  FillMixedEvent(iHC, Mult, cent, RelativeK, RelativePairkT(PartOne, PartTwo),
+                 RelativePairmT(PartOne, PartTwo), Part1Momentum.Pt(),
+                 Part2Momentum.Pt());
+  return RelativeK;
+}
+
+void AliFemtoDreamHigherPairMath::FillMixedEvent(int iHC, int Mult, float cent,
+                                                 float RelativeK, float kT,
+                                                 float mT, float pt1,
+                                                 float pt2) {
+  bool fillHists = fWhichPairs.at(iHC);
   fHists->FillMixedEventDist(iHC, RelativeK);
   if (fHists->GetDoMultBinning()) {
     fHists->FillMixedEventMultDist(iHC, Mult + 1, RelativeK);
@@ -274,29 +291,47 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
     fHists->FillMixedEventCentDist(iHC, cent, RelativeK);
   }
   if (fillHists && fHists->GetDokTBinning()) {
-    fHists->FillMixedEventkTDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                 RelativeK, cent);
+    fHists->FillMixedEventkTDist(iHC, kT, RelativeK, cent);
   }
   if (fillHists && fHists->GetDomTBinning()) {
-    fHists->FillMixedEventmTDist(iHC, RelativePairmT(PartOne, PartTwo),
-                                 RelativeK);
+    fHists->FillMixedEventmTDist(iHC, mT, RelativeK);
   }
   if (fillHists && fHists->GetDokTandMultBinning()) {
-    fHists->FillMixedEventkTandMultDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                        RelativeK, Mult + 1);
+    fHists->FillMixedEventkTandMultDist(iHC, kT, RelativeK, Mult + 1);
   }
   if (fillHists && fHists->GetDomTMultPlots()) {
-    fHists->FillMixedEventmTMultDist(iHC, RelativePairmT(PartOne, PartTwo), Mult + 1, 
-				   RelativeK); 
-  }   
+    fHists->FillMixedEventmTMultDist(iHC, mT, Mult + 1, RelativeK);
+  }
   if (fillHists && fHists->GetDoPtQA()) {
-    fHists->FillPtMEOneQADist(iHC, Part1Momentum.Pt(), Mult + 1);
-    fHists->FillPtMETwoQADist(iHC, Part2Momentum.Pt(), Mult + 1);
-    
-    fHists->FillKstarPtMEOneQADist(iHC, RelativeK, Part1Momentum.Pt());
-    fHists->FillKstarPtMETwoQADist(iHC, RelativeK, Part2Momentum.Pt());
+    fHists->FillPtMEOneQADist(iHC, pt1, Mult + 1);
+    fHists->FillPtMETwoQADist(iHC, pt2, Mult + 1);
+
+    fHists->FillKstarPtMEOneQADist(iHC, RelativeK, pt1);
+    fHists->FillKstarPtMETwoQADist(iHC, RelativeK, pt2);
   }
-  return RelativeK;
+}
+
+bool AliFemtoDreamHigherPairMath::UseRecordKernel() {
+  //The record kernel does not keep the information needed for the mass QA,
+  //the momentum resolution and the dPhi-dEta plots. The eta-phi plots at
+  //the radii are only filled without minimal booking.
+  return !fHists->GetDoMassQA() && !fHists->GetObtainMomentumResolution()
+      && !fHists->GetDodPhidEtaPlots()
+      && (!fHists->GetEtaPhiPlots() || fHists->GetMinimalBooking());
+}
+
+bool AliFemtoDreamHigherPairMath::PassesPairSelection(
+    int iHC, const AliFemtoDreamPartRecord &part1,
+    const AliFemtoDreamPartRecord &part2) {
+  //Same decision as PassesPairSelection for AliFemtoDreamBasePart
+  if (!fRejPairs.at(iHC)
+      || !(fDoDeltaEtaDeltaPhiCut || fHists->GetEtaPhiPlots())) {
+    return true;
+  }
+  unsigned int DoThisPair = fWhichPairs.at(iHC);
+  return AliFemtoDreamPairKernel::PassesCloseTrackRejection(
+      part1, part2, DoThisPair / 10, DoThisPair % 10, fDeltaPhiSqMax,
+      fDeltaEtaSqMax);
 }
 
 void AliFemtoDreamHigherPairMath::SEDetaDPhiPlots(int iHC,
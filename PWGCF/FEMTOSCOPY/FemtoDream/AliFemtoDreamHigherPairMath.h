@@ -13,6 +13,7 @@
 #include "AliFemtoDreamBasePart.h"
 #include "AliFemtoDreamCollConfig.h"
 #include "AliFemtoDreamCorrHists.h"
+#include "AliFemtoDreamPairKernel.h"
 #include <vector>
 class AliFemtoDreamHigherPairMath {
  public:
@@ -38,6 +39,8 @@ class AliFemtoDreamHigherPairMath {
   void RecalculatePhiStar(AliFemtoDreamBasePart &part);
   float FillSameEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
                       int PDGPart1, AliFemtoDreamBasePart& part2, int PDGPart2);
+  void FillSameEvent(int iHC, int Mult, float cent, float RelativeK, float kT,
+                     float mT, float pt1, float pt2, bool common);
   void MassQA(int iHC, float RelK, AliFemtoDreamBasePart &part1, int PDGPart1,
               AliFemtoDreamBasePart &part2, int PDGPart2);
   void MEMassQA(int iHC, float RelK, AliFemtoDreamBasePart &part1, int PDGPart1,
@@ -55,6 +58,12 @@ class AliFemtoDreamHigherPairMath {
   float FillMixedEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
                        int PDGPart1, AliFemtoDreamBasePart& part2, int PDGPart2,
                        AliFemtoDreamCollConfig::UncorrelatedMode mode);
+  void FillMixedEvent(int iHC, int Mult, float cent, float RelativeK, float kT,
+                      float mT, float pt1, float pt2);
+  // pairing of AliFemtoDreamPartRecord, see AliFemtoDreamPairKernel
+  bool UseRecordKernel();
+  bool PassesPairSelection(int iHC, const AliFemtoDreamPartRecord &part1,
+                           const AliFemtoDreamPartRecord &part2);
   void MEMomentumResolution(int iHC, AliFemtoDreamBasePart* part1, int PDGPart1,
                             AliFemtoDreamBasePart* part2, int PDGPart2,
                             float RelativeK);
@@ -0,0 +1,111 @@
+/*
+ * AliFemtoDreamPairKernel.cxx
+ *
+ *  Pair quantities computed on AliFemtoDreamPartRecord arrays.
+ */
+#include <cmath>
+#include "AliFemtoDreamPairKernel.h"
+#include "TMath.h"
+#include "TVector2.h"
+
+static const float piKernel = TMath::Pi();
+
+AliFemtoDreamPairKernel::AliFemtoDreamPairKernel()
+    : fRelativeK(),
+      fkT(),
+      fmT() {
+}
+
+AliFemtoDreamPairKernel::~AliFemtoDreamPairKernel() {
+}
+
+void AliFemtoDreamPairKernel::Kinematics(const AliFemtoDreamPartRecord &part1,
+                                         const AliFemtoDreamPartRecord *part2,
+                                         unsigned int nPart2) {
+  if (fRelativeK.size() < nPart2) {
+    fRelativeK.resize(nPart2);
+    fkT.resize(nPart2);
+    fmT.resize(nPart2);
+  }
+  const double px1 = part1.fPx;
+  const double py1 = part1.fPy;
+  const double pz1 = part1.fPz;
+  const double e1 = part1.fE;
+  const double m1 = part1.fMass;
+  float *relK = fRelativeK.data();
+  float *kT = fkT.data();
+  float *mT = fmT.data();
+  for (unsigned int i = 0; i < nPart2; ++i) {
+    const double m2 = part2[i].fMass;
+    const double sumX = px1 + part2[i].fPx;
+    const double sumY = py1 + part2[i].fPy;
+    const double sumZ = pz1 + part2[i].fPz;
+    const double sumE = e1 + part2[i].fE;
+    const double difX = px1 - part2[i].fPx;
+    const double difY = py1 - part2[i].fPy;
+    const double difZ = pz1 - part2[i].fPz;
+    const double difE = e1 - part2[i].fE;
+    // In the pair rest frame q0* = (m1^2-m2^2)/M and |q*| = 2k*
+    const double invMass2 = sumE * sumE - sumX * sumX - sumY * sumY
+        - sumZ * sumZ;
+    const double massDiff = (m1 - m2) * (m1 + m2);
+    const double q2 = difX * difX + difY * difY + difZ * difZ - difE * difE
+        + massDiff * massDiff / invMass2;
+    relK[i] = 0.5 * std::sqrt(q2 > 0. ? q2 : 0.);
+    kT[i] = 0.5 * std::sqrt(sumX * sumX + sumY * sumY);
+    const double avgMass = 0.5 * (m1 + m2);
+    mT[i] = std::sqrt(kT[i] * kT[i] + avgMass * avgMass);
+  }
+}
+
+float AliFemtoDreamPairKernel::RelativePairMomentum(
+    const AliFemtoDreamPartRecord &part1, const AliFemtoDreamPartRecord &part2) {
+  AliFemtoDreamPairKernel kernel;
+  kernel.Kinematics(part1, &part2, 1);
+  return kernel.GetRelativeK()[0];
+}
+
+bool AliFemtoDreamPairKernel::PassesCloseTrackRejection(
+    const AliFemtoDreamPartRecord &part1, const AliFemtoDreamPartRecord &part2,
+    unsigned int nDaug1, unsigned int nDaug2, float DeltaPhiSqMax,
+    float DeltaEtaSqMax) {
+  if (nDaug1 > part1.fNPhiAtRadius) {
+    nDaug1 = part1.fNPhiAtRadius;
+  }
+  if (nDaug2 > part2.fNPhiAtRadius) {
+    nDaug2 = part2.fNPhiAtRadius;
+  }
+  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
+    const unsigned int iEta1 = (nDaug1 == 1) ? 0 : iDaug1 + 1;
+    if (iEta1 >= part1.fNEta) {
+      continue;
+    }
+    const float etaPar1 = part1.fEta[iEta1];
+    for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
+      const unsigned int iEta2 = (nDaug2 == 1) ? 0 : iDaug2 + 1;
+      if (iEta2 >= part2.fNEta) {
+        continue;
+      }
+      const float deta = etaPar1 - part2.fEta[iEta2];
+      const int size =
+          (part1.fNRadii[iDaug1] > part2.fNRadii[iDaug2]) ?
+              part2.fNRadii[iDaug2] : part1.fNRadii[iDaug1];
+      float dphiAvg = 0;
+      for (int iRad = 0; iRad < size; ++iRad) {
+        float dphi = part1.fPhiAtRadius[iDaug1][iRad]
+            - part2.fPhiAtRadius[iDaug2][iRad];
+        if (dphi > piKernel) {
+          dphi += -piKernel * 2;
+        } else if (dphi < -piKernel) {
+          dphi += piKernel * 2;
+        }
+        dphiAvg += TVector2::Phi_mpi_pi(dphi);
+      }
+      if ((dphiAvg / (float) size) * (dphiAvg / (float) size) / DeltaPhiSqMax
+          + deta * deta / DeltaEtaSqMax < 1.) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
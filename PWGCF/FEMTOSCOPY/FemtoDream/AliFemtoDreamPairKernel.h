@@ -0,0 +1,49 @@
+/*
+ * AliFemtoDreamPairKernel.h
+ *
+ *  Pair quantities computed on AliFemtoDreamPartRecord arrays: one particle
+ *  is paired with a whole contiguous range of partners at once (same event
+ *  or one event of a mixing pool). k*, kT and mT are obtained from the
+ *  invariants of the pair instead of boosting TLorentzVectors, the close
+ *  pair rejection in Delta eta - Delta phi* follows
+ *  AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi.
+ */
+
+#ifndef ALIFEMTODREAMPAIRKERNEL_H_
+#define ALIFEMTODREAMPAIRKERNEL_H_
+#include <vector>
+#include "Rtypes.h"
+#include "AliFemtoDreamParticleArena.h"
+
+class AliFemtoDreamPairKernel {
+ public:
+  AliFemtoDreamPairKernel();
+  virtual ~AliFemtoDreamPairKernel();
+  //Fills k*, kT and mT of part1 with each of the nPart2 partners
+  void Kinematics(const AliFemtoDreamPartRecord &part1,
+                  const AliFemtoDreamPartRecord *part2, unsigned int nPart2);
+  const float *GetRelativeK() const {
+    return fRelativeK.data();
+  }
+  const float *GetkT() const {
+    return fkT.data();
+  }
+  const float *GetmT() const {
+    return fmT.data();
+  }
+  static float RelativePairMomentum(const AliFemtoDreamPartRecord &part1,
+                                    const AliFemtoDreamPartRecord &part2);
+  //nDaug1/nDaug2 as encoded in AliFemtoDreamCollConfig::GetWhichPairs
+  static bool PassesCloseTrackRejection(const AliFemtoDreamPartRecord &part1,
+                                        const AliFemtoDreamPartRecord &part2,
+                                        unsigned int nDaug1,
+                                        unsigned int nDaug2,
+                                        float DeltaPhiSqMax,
+                                        float DeltaEtaSqMax);
+ private:
+  std::vector<float> fRelativeK;
+  std::vector<float> fkT;
+  std::vector<float> fmT;
+};
+
+#endif /* ALIFEMTODREAMPAIRKERNEL_H_ */
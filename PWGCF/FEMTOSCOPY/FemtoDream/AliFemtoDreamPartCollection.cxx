@@ -14,7 +14,8 @@ AliFemtoDreamPartCollection::AliFemtoDreamPartCollection()
       fNSpecies(0),
       fZVtxMultBuffer(),
       fValuesZVtxBins(),
-      fValuesMultBins() {
+      fValuesMultBins(),
+      fArena() {
 
 }
 
@@ -24,7 +25,8 @@ AliFemtoDreamPartCollection::AliFemtoDreamPartCollection(
       fNSpecies(coll.fNSpecies),
       fZVtxMultBuffer(coll.fZVtxMultBuffer),
       fValuesZVtxBins(coll.fValuesZVtxBins),
-      fValuesMultBins(coll.fValuesMultBins) {
+      fValuesMultBins(coll.fValuesMultBins),
+      fArena() {
 
 }
 AliFemtoDreamPartCollection::AliFemtoDreamPartCollection(
@@ -36,7 +38,8 @@ AliFemtoDreamPartCollection::AliFemtoDreamPartCollection(
           std::vector<AliFemtoDreamZVtxMultContainer>(
               conf->GetNMultBins(), AliFemtoDreamZVtxMultContainer(conf))),
       fValuesZVtxBins(conf->GetZVtxBins()),
-      fValuesMultBins(conf->GetMultBins()) {
+      fValuesMultBins(conf->GetMultBins()),
+      fArena() {
 }
 
 AliFemtoDreamPartCollection& AliFemtoDreamPartCollection::operator=(
@@ -70,9 +73,7 @@ void AliFemtoDreamPartCollection::SetEvent(
     itZVtx += bins[0];
     auto itMult = itZVtx->begin();
     itMult += bins[1];
-    itMult->PairParticlesSE(Particles, fHigherMath, bins[1], cent);
-    itMult->PairParticlesME(Particles, fHigherMath, bins[1], cent);
-    itMult->SetEvent(Particles);
+    PairAndSetEvent(Particles, *itMult, bins[1], cent);
   }
   return;
 }
@@ -96,9 +97,26 @@ void AliFemtoDreamPartCollection::SetEvent(
     itZVtx += bins[0];
     auto itMult = itZVtx->begin();
     itMult += bins[1];
-    itMult->PairParticlesSE(Particles, fHigherMath, bins[1], cent);
-    itMult->PairParticlesME(Particles, fHigherMath, bins[1], cent);
-    itMult->SetEvent(Particles);
+    PairAndSetEvent(Particles, *itMult, bins[1], cent);
+  }
+  return;
+}
+
+void AliFemtoDreamPartCollection::PairAndSetEvent(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
+    AliFemtoDreamZVtxMultContainer &container, int iMult, float cent) {
+  //If no QA needs the full particle objects, the particles are converted
+  //once into flat records and the pairing runs on those, also for the
+  //mixing pools.
+  if (fHigherMath->UseRecordKernel()) {
+    fArena.SetEvent(Particles, container.GetMasses());
+    container.PairRecordsSE(fArena, fHigherMath, iMult, cent);
+    container.PairRecordsME(fArena, fHigherMath, iMult, cent);
+    container.SetEvent(fArena);
+  } else {
+    container.PairParticlesSE(Particles, fHigherMath, iMult, cent);
+    container.PairParticlesME(Particles, fHigherMath, iMult, cent);
+    container.SetEvent(Particles);
   }
   return;
 }
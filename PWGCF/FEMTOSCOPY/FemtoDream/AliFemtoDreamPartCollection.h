@@ -16,6 +16,7 @@
 #include "AliFemtoDreamCorrHists.h"
 #include "AliFemtoDreamHigherPairMath.h"
 #include "AliFemtoDreamZVtxMultContainer.h"
+#include "AliFemtoDreamParticleArena.h"
 //Class containing all the different multiplicity containers for all the
 //particles
 class AliFemtoDreamPartCollection {
@@ -46,12 +47,16 @@ class AliFemtoDreamPartCollection {
   ;
   void FindBin(float ZVtxPos, float Multiplicity, int *returnBins);
  private:
+  void PairAndSetEvent(
+      std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
+      AliFemtoDreamZVtxMultContainer &container, int iMult, float cent);
   AliFemtoDreamHigherPairMath* fHigherMath;
   unsigned int fNSpecies;
   std::vector<std::vector<AliFemtoDreamZVtxMultContainer>> fZVtxMultBuffer;
   std::vector<float> fValuesZVtxBins;
   std::vector<int> fValuesMultBins;
-  ClassDef(AliFemtoDreamPartCollection,2);
+  AliFemtoDreamParticleArena fArena;  //!
+  ClassDef(AliFemtoDreamPartCollection,3);
 };
 
 #endif /* ALIFEMTODREAMPARTCOLLECTION_H_ */
@@ -0,0 +1,99 @@
+/*
+ * AliFemtoDreamParticleArena.cxx
+ *
+ *  Flat per-event storage of the particles used in the pair loops.
+ */
+#include <cmath>
+#include "AliFemtoDreamParticleArena.h"
+#include "AliFemtoDreamBasePart.h"
+
+void AliFemtoDreamPartRecord::Set(const AliFemtoDreamBasePart &part,
+                                  float mass) {
+  TVector3 mom = part.GetMomentum();
+  fPx = mom.X();
+  fPy = mom.Y();
+  fPz = mom.Z();
+  fMass = mass;
+  fE = std::sqrt(fPx * fPx + fPy * fPy + fPz * fPz + mass * mass);
+  fPt = std::sqrt(fPx * fPx + fPy * fPy);
+  fMotherID = part.GetMotherID();
+
+  std::vector<float> eta = part.GetEta();
+  fNEta = (eta.size() > kMaxDaughters + 1) ? kMaxDaughters + 1 : eta.size();
+  for (unsigned int i = 0; i < fNEta; ++i) {
+    fEta[i] = eta[i];
+  }
+  std::vector<std::vector<float>> phiAtRad = part.GetPhiAtRaidius();
+  fNPhiAtRadius =
+      (phiAtRad.size() > kMaxDaughters) ? kMaxDaughters : phiAtRad.size();
+  for (unsigned int iDaug = 0; iDaug < fNPhiAtRadius; ++iDaug) {
+    unsigned int nRad =
+        (phiAtRad[iDaug].size() > kNRadii) ? kNRadii : phiAtRad[iDaug].size();
+    fNRadii[iDaug] = nRad;
+    for (unsigned int iRad = 0; iRad < nRad; ++iRad) {
+      fPhiAtRadius[iDaug][iRad] = phiAtRad[iDaug][iRad];
+    }
+  }
+}
+
+AliFemtoDreamParticleArena::AliFemtoDreamParticleArena()
+    : fRecords(),
+      fOffset() {
+}
+
+AliFemtoDreamParticleArena::~AliFemtoDreamParticleArena() {
+}
+
+void AliFemtoDreamParticleArena::SetEvent(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
+    const std::vector<float> &masses) {
+  //The storage is reused from one event to the next, so that no allocation
+  //takes place once the largest event has been seen
+  unsigned int nTot = 0;
+  for (auto itSpec = Particles.begin(); itSpec != Particles.end(); ++itSpec) {
+    nTot += itSpec->size();
+  }
+  fRecords.resize(nTot);
+  fOffset.resize(Particles.size() + 1);
+  unsigned int iRec = 0;
+  for (unsigned int iSpec = 0; iSpec < Particles.size(); ++iSpec) {
+    fOffset[iSpec] = iRec;
+    for (auto itPart = Particles[iSpec].begin();
+        itPart != Particles[iSpec].end(); ++itPart) {
+      fRecords[iRec++].Set(*itPart, masses[iSpec]);
+    }
+  }
+  fOffset[Particles.size()] = iRec;
+}
+
+AliFemtoDreamRecordPool::AliFemtoDreamRecordPool()
+    : fSlots(),
+      fFirst(0),
+      fNEvents(0) {
+}
+
+AliFemtoDreamRecordPool::AliFemtoDreamRecordPool(unsigned int MixingDepth)
+    : fSlots(MixingDepth),
+      fFirst(0),
+      fNEvents(0) {
+}
+
+AliFemtoDreamRecordPool::~AliFemtoDreamRecordPool() {
+}
+
+void AliFemtoDreamRecordPool::SetEvent(const AliFemtoDreamPartRecord *records,
+                                       unsigned int nRecords) {
+  if (fSlots.empty()) {
+    return;
+  }
+  unsigned int slot;
+  if (fNEvents < fSlots.size()) {
+    slot = (fFirst + fNEvents) % fSlots.size();
+    ++fNEvents;
+  } else {
+    //overwrite the oldest event
+    slot = fFirst;
+    fFirst = (fFirst + 1) % fSlots.size();
+  }
+  fSlots[slot].assign(records, records + nRecords);
+}
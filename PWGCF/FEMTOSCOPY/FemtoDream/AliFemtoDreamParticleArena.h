@@ -0,0 +1,80 @@
+/*
+ * AliFemtoDreamParticleArena.h
+ *
+ *  Flat per-event storage of the particles used in the pair loops.
+ *  The AliFemtoDreamBasePart objects are converted once per event into
+ *  plain records holding only what the pair kernel needs (four-momentum,
+ *  eta and phi* at the TPC radii of the daughters, mother ID), stored
+ *  contiguously species by species. The mixing pools keep these records
+ *  in a ring buffer of fixed depth instead of copying the full objects.
+ */
+
+#ifndef ALIFEMTODREAMPARTICLEARENA_H_
+#define ALIFEMTODREAMPARTICLEARENA_H_
+#include <vector>
+#include "Rtypes.h"
+
+class AliFemtoDreamBasePart;
+
+struct AliFemtoDreamPartRecord {
+  enum {
+    kMaxDaughters = 4,
+    kNRadii = 9
+  };
+  float fPx;
+  float fPy;
+  float fPz;
+  float fE;
+  float fPt;
+  float fMass;
+  float fEta[kMaxDaughters + 1];  // same layout as AliFemtoDreamBasePart::GetEta()
+  float fPhiAtRadius[kMaxDaughters][kNRadii];
+  unsigned char fNEta;
+  unsigned char fNPhiAtRadius;
+  unsigned char fNRadii[kMaxDaughters];
+  int fMotherID;
+  void Set(const AliFemtoDreamBasePart &part, float mass);
+};
+
+class AliFemtoDreamParticleArena {
+ public:
+  AliFemtoDreamParticleArena();
+  virtual ~AliFemtoDreamParticleArena();
+  void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
+                const std::vector<float> &masses);
+  unsigned int GetNSpecies() const {
+    return fOffset.empty() ? 0 : fOffset.size() - 1;
+  }
+  unsigned int GetSize(unsigned int iSpecies) const {
+    return fOffset[iSpecies + 1] - fOffset[iSpecies];
+  }
+  const AliFemtoDreamPartRecord *GetSpecies(unsigned int iSpecies) const {
+    return fRecords.data() + fOffset[iSpecies];
+  }
+ private:
+  std::vector<AliFemtoDreamPartRecord> fRecords;
+  std::vector<unsigned int> fOffset;
+};
+
+//Ring buffer of the records of the previous events, for one particle
+//species in one zVtx/Mult bin
+class AliFemtoDreamRecordPool {
+ public:
+  AliFemtoDreamRecordPool();
+  AliFemtoDreamRecordPool(unsigned int MixingDepth);
+  virtual ~AliFemtoDreamRecordPool();
+  void SetEvent(const AliFemtoDreamPartRecord *records, unsigned int nRecords);
+  unsigned int GetMixingDepth() const {
+    return fNEvents;
+  }
+  //iDepth = 0 is the oldest event, as in AliFemtoDreamPartContainer
+  const std::vector<AliFemtoDreamPartRecord> &GetEvent(unsigned int iDepth) const {
+    return fSlots[(fFirst + iDepth) % fSlots.size()];
+  }
+ private:
+  std::vector<std::vector<AliFemtoDreamPartRecord>> fSlots;
+  unsigned int fFirst;
+  unsigned int fNEvents;
+};
+
+#endif /* ALIFEMTODREAMPARTICLEARENA_H_ */
@@ -15,7 +15,11 @@ ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
     : fPartContainer(0),
       fPDGParticleSpecies(0),
-      fWhichPairs(){
+      fWhichPairs(),
+      fMixingDepth(0),
+      fRecordPools(),
+      fMasses(),
+      fKernel() {
 }
 
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
@@ -23,7 +27,11 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
     : fPartContainer(conf->GetNParticles(),
                      AliFemtoDreamPartContainer(conf->GetMixingDepth())),
       fPDGParticleSpecies(conf->GetPDGCodes()),
-      fWhichPairs(conf->GetWhichPairs()){
+      fWhichPairs(conf->GetWhichPairs()),
+      fMixingDepth(conf->GetMixingDepth()),
+      fRecordPools(),
+      fMasses(),
+      fKernel() {
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
@@ -180,3 +188,118 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     ++itPDGPar1;
   }
 }
+
+const std::vector<float> &AliFemtoDreamZVtxMultContainer::GetMasses() {
+  //The masses are looked up once, instead of for every pair
+  if (fMasses.size() != fPDGParticleSpecies.size()) {
+    fMasses.clear();
+    for (auto itPDG = fPDGParticleSpecies.begin();
+        itPDG != fPDGParticleSpecies.end(); ++itPDG) {
+      fMasses.push_back(TDatabasePDG::Instance()->GetParticle(*itPDG)->Mass());
+    }
+  }
+  return fMasses;
+}
+
+void AliFemtoDreamZVtxMultContainer::SetEvent(
+    const AliFemtoDreamParticleArena &Arena) {
+  //As for the AliFemtoDreamPartContainer, empty events are not added
+  if (fRecordPools.size() != Arena.GetNSpecies()) {
+    fRecordPools.assign(Arena.GetNSpecies(),
+                        AliFemtoDreamRecordPool(fMixingDepth));
+  }
+  for (unsigned int iSpec = 0; iSpec < Arena.GetNSpecies(); ++iSpec) {
+    if (Arena.GetSize(iSpec) > 0) {
+      fRecordPools[iSpec].SetEvent(Arena.GetSpecies(iSpec),
+                                   Arena.GetSize(iSpec));
+    }
+  }
+}
+
+void AliFemtoDreamZVtxMultContainer::PairRecordsSE(
+    const AliFemtoDreamParticleArena &Arena,
+    AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
+  int HistCounter = 0;
+  const unsigned int nSpecies = Arena.GetNSpecies();
+  for (unsigned int iSpec1 = 0; iSpec1 < nSpecies; ++iSpec1) {
+    const AliFemtoDreamPartRecord *Spec1 = Arena.GetSpecies(iSpec1);
+    const unsigned int nPart1 = Arena.GetSize(iSpec1);
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < nSpecies; ++iSpec2) {
+      const AliFemtoDreamPartRecord *Spec2 = Arena.GetSpecies(iSpec2);
+      const unsigned int nPart2 = Arena.GetSize(iSpec2);
+      HigherMath->FillPairCounterSE(HistCounter, nPart1, nPart2);
+      for (unsigned int iPart1 = 0; iPart1 < nPart1; ++iPart1) {
+        const unsigned int iFirst = (iSpec1 == iSpec2) ? iPart1 + 1 : 0;
+        if (iFirst >= nPart2) {
+          continue;
+        }
+        const AliFemtoDreamPartRecord *Partners = Spec2 + iFirst;
+        const unsigned int nPartners = nPart2 - iFirst;
+        fKernel.Kinematics(Spec1[iPart1], Partners, nPartners);
+        const float *RelativeK = fKernel.GetRelativeK();
+        const float *kT = fKernel.GetkT();
+        const float *mT = fKernel.GetmT();
+        for (unsigned int iPart2 = 0; iPart2 < nPartners; ++iPart2) {
+          if (!HigherMath->PassesPairSelection(HistCounter, Spec1[iPart1],
+                                               Partners[iPart2])) {
+            continue;
+          }
+          bool common = Spec1[iPart1].fMotherID == Partners[iPart2].fMotherID;
+          HigherMath->FillSameEvent(HistCounter, iMult, cent,
+                                    RelativeK[iPart2], kT[iPart2], mT[iPart2],
+                                    Spec1[iPart1].fPt, Partners[iPart2].fPt,
+                                    common);
+        }
+      }
+      ++HistCounter;
+    }
+  }
+}
+
+void AliFemtoDreamZVtxMultContainer::PairRecordsME(
+    const AliFemtoDreamParticleArena &Arena,
+    AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
+  int HistCounter = 0;
+  const unsigned int nSpecies = Arena.GetNSpecies();
+  if (fRecordPools.size() != nSpecies) {
+    fRecordPools.assign(nSpecies, AliFemtoDreamRecordPool(fMixingDepth));
+  }
+  for (unsigned int iSpec1 = 0; iSpec1 < nSpecies; ++iSpec1) {
+    const AliFemtoDreamPartRecord *Spec1 = Arena.GetSpecies(iSpec1);
+    const unsigned int nPart1 = Arena.GetSize(iSpec1);
+    //Particle1 + Particle2 == Particle2 + Particle 1 in the mixed event
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < nSpecies; ++iSpec2) {
+      const AliFemtoDreamRecordPool &Pool = fRecordPools[iSpec2];
+      if (nPart1 > 0) {
+        HigherMath->FillEffectiveMixingDepth(HistCounter,
+                                             (int) Pool.GetMixingDepth());
+      }
+      for (unsigned int iDepth = 0; iDepth < Pool.GetMixingDepth(); ++iDepth) {
+        //The records of the pool are used in place, no copy of the event
+        const std::vector<AliFemtoDreamPartRecord> &Event = Pool.GetEvent(
+            iDepth);
+        HigherMath->FillPairCounterME(HistCounter, nPart1, Event.size());
+        if (Event.empty()) {
+          continue;
+        }
+        for (unsigned int iPart1 = 0; iPart1 < nPart1; ++iPart1) {
+          fKernel.Kinematics(Spec1[iPart1], Event.data(), Event.size());
+          const float *RelativeK = fKernel.GetRelativeK();
+          const float *kT = fKernel.GetkT();
+          const float *mT = fKernel.GetmT();
+          for (unsigned int iPart2 = 0; iPart2 < Event.size(); ++iPart2) {
+            if (!HigherMath->PassesPairSelection(HistCounter, Spec1[iPart1],
+                                                 Event[iPart2])) {
+              continue;
+            }
+            HigherMath->FillMixedEvent(HistCounter, iMult, cent,
+                                       RelativeK[iPart2], kT[iPart2],
+                                       mT[iPart2], Spec1[iPart1].fPt,
+                                       Event[iPart2].fPt);
+          }
+        }
+      }
+      ++HistCounter;
+    }
+  }
+}
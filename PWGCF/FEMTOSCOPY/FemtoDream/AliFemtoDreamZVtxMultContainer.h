@@ -14,6 +14,8 @@
 #include "AliFemtoDreamCorrHists.h"
 #include "AliFemtoDreamPartContainer.h"
 #include "AliFemtoDreamHigherPairMath.h"
+#include "AliFemtoDreamParticleArena.h"
+#include "AliFemtoDreamPairKernel.h"
 
 //Class containing the array buffer of the different particle species for one
 //Multiplicity bin
@@ -36,6 +38,15 @@ class AliFemtoDreamZVtxMultContainer {
   float ComputeDeltaPhi(AliFemtoDreamBasePart &part1,
                         AliFemtoDreamBasePart &part2);
   void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
+  //Same as above, operating on the flat records of the arena
+  void PairRecordsSE(const AliFemtoDreamParticleArena &Arena,
+                     AliFemtoDreamHigherPairMath *HigherMath, int iMult,
+                     float cent);
+  void PairRecordsME(const AliFemtoDreamParticleArena &Arena,
+                     AliFemtoDreamHigherPairMath *HigherMath, int iMult,
+                     float cent);
+  void SetEvent(const AliFemtoDreamParticleArena &Arena);
+  const std::vector<float> &GetMasses();
   TString ClassName() {
     return "zVtxMult Container";
   }
@@ -44,13 +55,17 @@ class AliFemtoDreamZVtxMultContainer {
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
   std::vector<unsigned int> fWhichPairs;
+  unsigned int fMixingDepth;
+  std::vector<AliFemtoDreamRecordPool> fRecordPools;  //!
+  std::vector<float> fMasses;  //!
+  AliFemtoDreamPairKernel fKernel;  //!
 //  std::vector<bool> fRejPairs;
 //  bool fDoDeltaEtaDeltaPhiCut;
 //  float fDeltaEtaMax;
 //  float fDeltaPhiMax;
 //  float fDeltaPhiEtaMax;
 
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+ClassDef(AliFemtoDreamZVtxMultContainer, 5)
   ;
 };
 
@@ -73,6 +73,8 @@ The names are available via the function PairClassName(Int_t i)
 #include "AliDielectronPairLegCuts.h"
 #include "AliDielectronV0Cuts.h"
 #include "AliDielectronPID.h"
+#include "AliDielectronVarCuts.h"
+#include "AliDielectronCutGroup.h"
 #include "AliDielectronHistos.h"
 
 #include "AliDielectron.h"
@@ -180,7 +182,11 @@ AliDielectron::AliDielectron() :
   fVZERORecenteringFilename(""),
   fZDCRecenteringFilename(""),
   fUseAccMap(kTRUE),
-  fIterations(1)
+  fIterations(1),
+  fTrackCutVars(0x0),
+  fPairCutVars(0x0),
+  fCandidateValues(0x0),
+  fPairPreCuts(0x0)
 
 
 {
@@ -275,7 +281,11 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fVZERORecenteringFilename(""),
   fZDCRecenteringFilename(""),
   fUseAccMap(kTRUE),
-  fIterations(1)
+  fIterations(1),
+  fTrackCutVars(0x0),
+  fPairCutVars(0x0),
+  fCandidateValues(0x0),
+  fPairPreCuts(0x0)
 {
   //
   // Named constructor
@@ -309,6 +319,10 @@ AliDielectron::~AliDielectron()
   if (fPairEffMap) delete fPairEffMap;
   if (fHistos) delete fHistos;
   if (fUsedVars) delete fUsedVars;
+  if (fTrackCutVars) delete fTrackCutVars;
+  if (fPairCutVars) delete fPairCutVars;
+  if (fCandidateValues) delete [] fCandidateValues;
+  if (fPairPreCuts) delete fPairPreCuts;
   if (fPairCandidates && fEventProcess) delete fPairCandidates;
   if (fDebugTree) delete fDebugTree;
   if (fMixing) delete fMixing;
@@ -381,6 +395,17 @@ void AliDielectron::Init()
     fPairFilter.AddCuts(trk2leg);
   }
 
+  // variables shared by several cuts, filled once per candidate
+  if (fTrackCutVars) delete fTrackCutVars;
+  if (fPairCutVars) delete fPairCutVars;
+  fTrackCutVars=InitCutVars(fTrackFilter);
+  fPairCutVars=InitCutVars(fPairFilter);
+  if ((fTrackCutVars || fPairCutVars) && !fCandidateValues) fCandidateValues=new Double_t[AliDielectronVarManager::kNMaxValues];
+
+  // pair cuts which can be applied before building the KF pair
+  if (fPairPreCuts) delete fPairPreCuts;
+  fPairPreCuts=InitPairPreCuts();
+
   if (fCutQA) {
     fQAmonitor = new AliDielectronCutQA(Form("QAcuts_%s",GetName()),"QAcuts");
     fQAmonitor->AddTrackFilter(&fTrackFilter);
@@ -958,7 +983,9 @@ void AliDielectron::FillTrackArrays(AliVEvent * const ev, Int_t eventNr)
     AliVParticle *particle=ev->GetTrack(itrack);
 
     //apply track cuts
+    if (fTrackCutVars) FillCandidateValues(particle,fTrackCutVars);
     UInt_t cutmask=fTrackFilter.IsSelected(particle);
+    AliDielectronVarManager::ClearValueCache();
     //fill cut QA
     if(fCutQA) fQAmonitor->FillAll(particle);
     if(fCutQA) fQAmonitor->Fill(cutmask,particle);
@@ -974,6 +1001,89 @@ void AliDielectron::FillTrackArrays(AliVEvent * const ev, Int_t eventNr)
   }
 }
 
+//________________________________________________________________
+TBits* AliDielectron::InitCutVars(const AliAnalysisFilter &filter) const
+{
+  //
+  // Union of the variables of the var cuts of the filter. Returns 0x0 if less
+  // than two var cuts would share the values
+  //
+  TBits *vars=new TBits(AliDielectronVarManager::kNMaxValues);
+  Int_t ncuts=0;
+  TIter next(filter.GetCuts());
+  while (AliAnalysisCuts *cut=static_cast<AliAnalysisCuts*>(next())) ncuts+=AddCutVars(cut,vars);
+
+  if (ncuts<2) {
+    delete vars;
+    return 0x0;
+  }
+  return vars;
+}
+
+//________________________________________________________________
+Int_t AliDielectron::AddCutVars(const AliAnalysisCuts *cut, TBits *vars) const
+{
+  //
+  // Add the variables of the var cuts, also inside cut groups.
+  // Returns the number of var cuts found. Cuts on the MC truth are
+  // evaluated on another object and do not use the shared values
+  //
+  const AliDielectronVarCuts *varCuts=dynamic_cast<const AliDielectronVarCuts*>(cut);
+  if (varCuts) {
+    if (varCuts->GetCutOnMCtruth()) return 0;
+    (*vars)|=(*varCuts->GetUsedVars());
+    return 1;
+  }
+
+  Int_t ncuts=0;
+  const AliDielectronCutGroup *group=dynamic_cast<const AliDielectronCutGroup*>(cut);
+  if (group) {
+    for (Int_t icut=0; icut<group->GetNCuts(); ++icut) ncuts+=AddCutVars(group->GetCut(icut),vars);
+  }
+  return ncuts;
+}
+
+//________________________________________________________________
+void AliDielectron::FillCandidateValues(const TObject *candidate, TBits *vars)
+{
+  //
+  // Fill the variables of all the var cuts once for the candidate. Until the
+  // cache is cleared, the var cuts read them instead of filling their own
+  // (see AliDielectronVarManager::GetCachedValues)
+  //
+  AliDielectronVarManager::SetFillMap(vars);
+  AliDielectronVarManager::Fill(candidate,fCandidateValues);
+  AliDielectronVarManager::SetValueCache(candidate,fCandidateValues,vars);
+}
+
+//________________________________________________________________
+TObjArray* AliDielectron::InitPairPreCuts() const
+{
+  //
+  // Var cuts of the pair filter using only pair variables computed from the
+  // daughters. Only without KF pairing, otherwise the pair kinematics come
+  // from the KF pair. Returns 0x0 if there are none
+  //
+  if (fUseKF) return 0x0;
+
+  TObjArray *cuts=0x0;
+  TIter next(fPairFilter.GetCuts());
+  while (TObject *cut=next()) {
+    AliDielectronVarCuts *varCuts=dynamic_cast<AliDielectronVarCuts*>(cut);
+    if (!varCuts || varCuts->GetCutOnMCtruth()) continue;
+
+    const TBits *vars=varCuts->GetUsedVars();
+    Bool_t fromLegs=kTRUE;
+    for (UInt_t ivar=vars->FirstSetBit(); ivar<vars->GetNbits() && fromLegs; ivar=vars->FirstSetBit(ivar+1))
+      fromLegs=AliDielectronVarManager::IsPairVarFromLegs(ivar);
+    if (!fromLegs) continue;
+
+    if (!cuts) cuts=new TObjArray;
+    cuts->Add(varCuts);
+  }
+  return cuts;
+}
+
 //________________________________________________________________
 void AliDielectron::EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev)
 {
@@ -1509,13 +1619,21 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  // build the KF pair only for the candidates passing the pair cuts on daughter quantities,
+  // unless all candidates are needed (CF manager, cut QA) or the pair is replaced (gamma tracks)
+  const Bool_t deferKF=fPairPreCuts && !fCfManagerPair && !(pairIndex==kEv1PM && fCutQA) && !fUseGammaTracks;
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
-      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
-                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+      if (deferKF)
+        candidate->SetDaughterTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
+                                     &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+      else
+        candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
+                             &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
       candidate->SetType(pairIndex);
 
       Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
@@ -1531,8 +1649,19 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       // should we set the pdgmothercode and the label
       }
 
+      //pair cuts on daughter quantities, then the KF pair
+      if (deferKF) {
+        Bool_t preSelected=kTRUE;
+        for (Int_t icut=0; icut<fPairPreCuts->GetEntriesFast() && preSelected; ++icut)
+          preSelected=static_cast<AliDielectronVarCuts*>(fPairPreCuts->UncheckedAt(icut))->IsSelected(candidate);
+        if (!preSelected) continue;
+        candidate->BuildPair();
+      }
+
       //pair cuts
+      if (fPairCutVars) FillCandidateValues(candidate,fPairCutVars);
       UInt_t cutMask=fPairFilter.IsSelected(candidate);
+      AliDielectronVarManager::ClearValueCache();
 
       //CF manager for the pair
       if (fCfManagerPair) fCfManagerPair->Fill(cutMask,candidate);
@@ -1585,7 +1714,9 @@ void AliDielectron::FillPairArrayTR()
         continue;
 
     //pair cuts
+    if (fPairCutVars) FillCandidateValues(&candidate,fPairCutVars);
     UInt_t cutMask=fPairFilter.IsSelected(&candidate);
+    AliDielectronVarManager::ClearValueCache();
 
     //CF manager for the pair
     if (fCfManagerPair) fCfManagerPair->Fill(cutMask,&candidate);
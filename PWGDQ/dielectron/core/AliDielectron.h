@@ -39,6 +39,7 @@ class AliDielectronTrackRotator;
 class AliDielectronPair;
 class AliDielectronSignalMC;
 class AliDielectronMixingHandler;
+class AliAnalysisCuts;
 
 //________________________________________________________________
 class AliDielectron : public TNamed {
@@ -334,6 +335,16 @@ private:
   TString fVZERORecenteringFilename;         // file containing VZERO Q-vector recentering averages
   TString fZDCRecenteringFilename;         // file containing ZDCQ-vector recentering averages
 
+  TBits *fTrackCutVars;           //! variables of the track cuts, filled once per track
+  TBits *fPairCutVars;            //! variables of the pair cuts, filled once per pair
+  Double_t *fCandidateValues;     //! values of the current track or pair candidate
+  TObjArray *fPairPreCuts;        //! pair var cuts on daughter quantities, applied before building the KF pair (not owned)
+
+  TBits* InitCutVars(const AliAnalysisFilter &filter) const;
+  Int_t  AddCutVars(const AliAnalysisCuts *cut, TBits *vars) const;
+  void   FillCandidateValues(const TObject *candidate, TBits *vars);
+  TObjArray* InitPairPreCuts() const;
+
   void ProcessMC(AliVEvent *ev1);
 
   void  FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly=kFALSE);
@@ -44,7 +44,11 @@ AliDielectronPair::AliDielectronPair() :
   fD2(),
   fRefD1(),
   fRefD2(),
-  fKFUsage(kTRUE)
+  fKFUsage(kTRUE),
+  fTrack1(0x0),
+  fTrack2(0x0),
+  fPid1(0),
+  fPid2(0)
 {
   //
   // Default Constructor
@@ -63,7 +67,11 @@ AliDielectronPair::AliDielectronPair(AliVTrack * const particle1, Int_t pid1,
   fD2(),
   fRefD1(),
   fRefD2(),
-  fKFUsage(kTRUE)
+  fKFUsage(kTRUE),
+  fTrack1(0x0),
+  fTrack2(0x0),
+  fPid1(0),
+  fPid2(0)
 {
   //
   // Constructor with tracks
@@ -84,7 +92,11 @@ AliDielectronPair::AliDielectronPair(const AliKFParticle * const particle1,
   fD2(),
   fRefD1(),
   fRefD2(),
-  fKFUsage(kTRUE)
+  fKFUsage(kTRUE),
+  fTrack1(0x0),
+  fTrack2(0x0),
+  fPid1(0),
+  fPid2(0)
 {
   //
   // Constructor with tracks
@@ -121,6 +133,62 @@ void AliDielectronPair::SetTracks(AliVTrack * const particle1, Int_t pid1,
   fPair.AddDaughter(kf1);
   fPair.AddDaughter(kf2);
 
+  SetDaughters(kf1,kf2,particle1,particle2);
+
+  fTrack1=0x0;
+  fTrack2=0x0;
+}
+
+//______________________________________________
+void AliDielectronPair::SetDaughterTracks(AliVTrack * const particle1, Int_t pid1,
+                                          AliVTrack * const particle2, Int_t pid2)
+{
+  //
+  // Same as SetTracks, but without building the KF pair. The quantities
+  // computed from the daughters only are available, the other ones once
+  // BuildPair() has been called
+  //
+  fPair.Initialize();
+  fD1.Initialize();
+  fD2.Initialize();
+
+  AliKFParticle kf1(*particle1,pid1);
+  AliKFParticle kf2(*particle2,pid2);
+
+  SetDaughters(kf1,kf2,particle1,particle2);
+
+  fTrack1=particle1;
+  fTrack2=particle2;
+  fPid1=pid1;
+  fPid2=pid2;
+}
+
+//______________________________________________
+void AliDielectronPair::BuildPair()
+{
+  //
+  // Build the KF pair of the tracks given in SetDaughterTracks,
+  // in the same way as SetTracks
+  //
+  if (!fTrack1 || !fTrack2) return;
+
+  AliKFParticle kf1(*fTrack1,fPid1);
+  AliKFParticle kf2(*fTrack2,fPid2);
+
+  fPair.AddDaughter(kf1);
+  fPair.AddDaughter(kf2);
+
+  fTrack1=0x0;
+  fTrack2=0x0;
+}
+
+//______________________________________________
+void AliDielectronPair::SetDaughters(const AliKFParticle &kf1, const AliKFParticle &kf2,
+                                     AliVTrack * const particle1, AliVTrack * const particle2)
+{
+  //
+  // Sort the daughters by pt, first particle larger Pt (if fRandomizeDaughters=kFALSE)
+  //
   if (fRandomizeDaughters) {
     if (fRandom3.Rndm()>0.5){
       fRefD1 = particle1;
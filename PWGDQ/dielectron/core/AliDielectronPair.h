@@ -57,6 +57,11 @@ public:
   void SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
 		      AliVTrack * const particle2, Int_t pid2);
 
+  // set only the daughters, the KF pair is built later by BuildPair()
+  void SetDaughterTracks(AliVTrack * const particle1, Int_t pid1,
+                         AliVTrack * const particle2, Int_t pid2);
+  void BuildPair();
+
   void SetTracks(const AliKFParticle * const particle1,
                  const AliKFParticle * const particle2,
                  AliVTrack * const refParticle1,
@@ -185,6 +190,14 @@ private:
 
   Bool_t fKFUsage;       // Use KF for vertexing
 
+  AliVTrack *fTrack1;    //! first track of SetDaughterTracks, until the pair is built
+  AliVTrack *fTrack2;    //! second track of SetDaughterTracks, until the pair is built
+  Int_t      fPid1;      //! pid of the first track
+  Int_t      fPid2;      //! pid of the second track
+
+  void SetDaughters(const AliKFParticle &kf1, const AliKFParticle &kf2,
+                    AliVTrack * const particle1, AliVTrack * const particle2);
+
   static Bool_t   fRandomizeDaughters;
   static TRandom3 fRandom3;
 
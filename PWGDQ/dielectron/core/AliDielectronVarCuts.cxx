@@ -113,6 +113,10 @@ Bool_t AliDielectronVarCuts::IsSelected(TObject* track)
     if (!track) return kFALSE;
   }
 
+  //Use the values already filled for this candidate, if any
+  const Double_t *cachedValues=AliDielectronVarManager::GetCachedValues(track,fUsedVars);
+  if (cachedValues) return IsSelected(const_cast<Double_t*>(cachedValues));
+
   //Fill values
   Double_t values[AliDielectronVarManager::kNMaxValues];
   AliDielectronVarManager::SetFillMap(fUsedVars);
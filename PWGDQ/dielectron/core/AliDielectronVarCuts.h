@@ -59,6 +59,7 @@ public:
   CutType GetCutType()      const { return fCutType;      }
 
   Int_t GetNCuts() { return fNActiveCuts; }
+  const TBits* GetUsedVars() const { return fUsedVars; }
 
   //
   //Analysis cuts interface
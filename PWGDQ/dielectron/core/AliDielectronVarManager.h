@@ -803,6 +803,10 @@ public:
   static void SetLegEffMap( TObject *map) { fgLegEffMap=map; }
   static void SetPairEffMap(TObject *map) { fgPairEffMap=map; }
   static void SetFillMap(   TBits   *map) { fgFillMap=map; }
+  static void SetValueCache(const TObject *object, const Double_t *values, const TBits *vars) { fgCacheObject=object; fgCacheValues=values; fgCacheVars=vars; }
+  static void ClearValueCache() { SetValueCache(0x0,0x0,0x0); }
+  static const Double_t* GetCachedValues(const TObject *object, const TBits *vars);
+  static Bool_t IsPairVarFromLegs(Int_t var);
   static void SetQnCalibrationFilePath(const Char_t* filename, const Bool_t doV0GainEq, const Bool_t doV0recenter, const Bool_t doTPCrecenter) {
     fgQnCalibrationFilePath = filename;
     fgDoQnV0GainEqualization = doV0GainEq;
@@ -881,6 +885,9 @@ private:
   static TObject         *fgLegEffMap;             // single electron efficiencies
   static TObject         *fgPairEffMap;             // pair efficiencies
   static TBits           *fgFillMap;             // map for requested variable filling
+  static const TObject   *fgCacheObject;         // candidate the cached values belong to
+  static const Double_t  *fgCacheValues;         // values of the current candidate, filled once for all cuts
+  static const TBits     *fgCacheVars;           // variables filled in the cached values
   static TString          fgQnCalibrationFilePath;  // file path to VZERO/TPC Qn calibrations
   static Bool_t           fgDoQnV0GainEqualization;  // flag for gain equalization of V0 for Qn vector
   static Bool_t           fgDoQnV0Recentering;  // flag for recentering of V0 for Qn vector
@@ -936,6 +943,38 @@ inline void AliDielectronVarManager::Fill(const TObject* object, Double_t * cons
 //   else printf(Form("AliDielectronVarManager::Fill: Type %s is not supported by AliDielectronVarManager!", object->ClassName())); //TODO: implement without object needed
 }
 
+inline const Double_t* AliDielectronVarManager::GetCachedValues(const TObject *object, const TBits *vars)
+{
+  //
+  // Values of the candidate filled once by the owner of the cache (see AliDielectron::FillTrackArrays),
+  // if the object is the current candidate and all the requested variables have been filled
+  //
+  if (!object || object!=fgCacheObject || !vars) return 0x0;
+  for (UInt_t ivar=vars->FirstSetBit(); ivar<vars->GetNbits(); ivar=vars->FirstSetBit(ivar+1)) {
+    if (!fgCacheVars->TestBitNumber(ivar)) return 0x0;
+  }
+  return fgCacheValues;
+}
+
+inline Bool_t AliDielectronVarManager::IsPairVarFromLegs(Int_t var)
+{
+  //
+  // Pair variables computed only from the two KF daughters when the KF pair is not
+  // used (see the end of FillVarDielectronPair). They do not need the KF pair,
+  // see AliDielectronPair::SetDaughterTracks
+  //
+  switch (var) {
+    case kPx: case kPy: case kPz: case kPt: case kPtSq: case kP: case kE: case kM:
+    case kOneOverPt: case kPhi: case kEta: case kY:
+    case kOpeningAngle: case kOpeningAngleXY: case kOpeningAngleRZ:
+    case kDeltaEta: case kDeltaPhi: case kPhivPair: case kPairType:
+    case kLeg1Eta: case kLeg2Eta: case kLeg1Pt: case kLeg2Pt: case kLeg1Phi: case kLeg2Phi:
+      return kTRUE;
+    default:
+      return kFALSE;
+  }
+}
+
 inline void AliDielectronVarManager::FillVarVParticle(const AliVParticle *particle, Double_t * const values)
 {
   ///
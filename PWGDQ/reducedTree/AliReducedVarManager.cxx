@@ -194,6 +194,12 @@ Bool_t                          AliReducedVarManager::fgOptionRecenterVZEROqVec
 Bool_t                          AliReducedVarManager::fgOptionRecenterTPCqVec = kFALSE;
 Bool_t                          AliReducedVarManager::fgOptionEventRes = kFALSE;
 TH1F*                           AliReducedVarManager::fgReweightMCpt=0x0;
+std::vector<Int_t>              AliReducedVarManager::fgCosSinNPhiKernels;
+std::vector<Int_t>              AliReducedVarManager::fgVZEROFlowKernels;
+std::vector<Int_t>              AliReducedVarManager::fgTPCFlowKernels;
+Bool_t                          AliReducedVarManager::fgPairEffKernel = kFALSE;
+Bool_t                          AliReducedVarManager::fgPolarizationKernel = kFALSE;
+Bool_t                          AliReducedVarManager::fgPairDcaKernel = kFALSE;
 //__________________________________________________________________
 AliReducedVarManager::AliReducedVarManager() :
   TObject()
@@ -386,6 +392,44 @@ void AliReducedVarManager::SetVariableDependencies() {
     fgUsedVars[kNTracksTPCoutBeforeClean] = kTRUE;
     fgUsedVars[kVZEROTotalMultFromChannels] = kTRUE;
   }
+  
+  CompileVariablePlan();
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::CompileVariablePlan() {
+  //
+  // Build, from the used variables (including the dependencies toggled above), the list of
+  //   track and pair kernels to be run in FillTrackInfo() and FillPairInfo().
+  // The Fill functions then loop only over the needed harmonics / detector sides instead of
+  //   testing every flag of the variable blocks for each track and each pair
+  //
+  fgCosSinNPhiKernels.clear();
+  for(Int_t ih=1; ih<=6; ++ih) {
+    if(fgUsedVars[kCosNPhi+ih-1] || fgUsedVars[kSinNPhi+ih-1]) fgCosSinNPhiKernels.push_back(ih);
+  }
+  
+  fgVZEROFlowKernels.clear();
+  for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
+    for(Int_t ih=0; ih<6; ++ih) {
+      Int_t idx = iVZEROside*6+ih;
+      Bool_t used = fgUsedVars[kVZEROFlowVn+idx] || fgUsedVars[kVZEROFlowSine+idx] || fgUsedVars[kVZERODeltaPhiPsiN+idx];
+      if(iVZEROside<2) used = used || fgUsedVars[kVZEROuQ+idx] || fgUsedVars[kVZEROuQsine+idx];
+      if(used) fgVZEROFlowKernels.push_back(idx);
+    }
+  }
+  
+  fgTPCFlowKernels.clear();
+  for(Int_t ih=0; ih<6; ++ih) {
+    if(fgUsedVars[kTPCFlowVn+ih] || fgUsedVars[kTPCFlowSine+ih] || fgUsedVars[kTPCuQ+ih] || 
+       fgUsedVars[kTPCuQsine+ih] || fgUsedVars[kTPCDeltaPhiPsiN+ih]) fgTPCFlowKernels.push_back(ih);
+  }
+  
+  fgPairEffKernel = (fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]);
+  fgPolarizationKernel = (fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE]);
+  fgPairDcaKernel = (fgUsedVars[kPairDca] || fgUsedVars[kPairDcaXY] || fgUsedVars[kPairDcaZ] || 
+                     fgUsedVars[kPairDcaSqrt] || fgUsedVars[kPairDcaXYSqrt] || fgUsedVars[kPairDcaZSqrt] ||
+                     fgUsedVars[kOpAngDcaPtCorr] || fgUsedVars[kMassDcaPtCorr]);
 }
 
 //__________________________________________________________________
@@ -1572,14 +1616,15 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   if(fgUsedVars[kTheta])     values[kTheta]     = p->Theta();
   if(fgUsedVars[kPhi])       values[kPhi]       = p->Phi();
   if(fgUsedVars[kEta])       values[kEta]       = p->Eta();
-  for(Int_t ih=1; ih<=6; ++ih) {
+  for(UInt_t ik=0; ik<fgCosSinNPhiKernels.size(); ++ik) {
+     Int_t ih = fgCosSinNPhiKernels[ik];
      if(fgUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
      if(fgUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
   }
   values[kCharge] = p->Charge();
   
   //pair efficiency variables
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
+  if(fgPairEffKernel && fgPairEffMap) {
     Int_t binX = 0;
     if (fgEffMapVarDependencyX!=kNothing) {
       binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]);
@@ -1613,47 +1658,40 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   }
 
   // Fill VZERO flow variables
-  for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
-     for(Int_t ih=0; ih<6; ++ih) {
-        if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
-           values[kVZEROFlowVn+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-        if(fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
-           values[kVZEROFlowSine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-        if(fgUsedVars[kVZERODeltaPhiPsiN+iVZEROside*6+ih]) {
-           // compute delta phi = phi - Psi
-           values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] = values[kPhi] - values[kVZERORP+iVZEROside*6+ih];
-           // transform to the interval [0; 2*pi/n]
-           values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] -= 
-                 2.0*TMath::Pi()/Double_t(ih+1) * TMath::Floor(Double_t(ih+1)/2.0/TMath::Pi()*values[kVZERODeltaPhiPsiN+iVZEROside*6+ih]);
-           // transform to [0; pi/n]
-           if(values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] > TMath::Pi()/Double_t(ih+1))
-             values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] = 2.0*TMath::Pi()/Double_t(ih+1) - values[kVZERODeltaPhiPsiN+iVZEROside*6+ih];
-        }
-        if(iVZEROside<2) {
-           if(fgUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
-              values[kVZEROuQ+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-              values[kVZEROuQ+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
-              values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
-           }
-           if(fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
-              values[kVZEROuQsine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-              values[kVZEROuQsine+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
-              values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
-           }	    
+  for(UInt_t ik=0; ik<fgVZEROFlowKernels.size(); ++ik) {
+     const Int_t iVZEROside = fgVZEROFlowKernels[ik]/6;
+     const Int_t ih = fgVZEROFlowKernels[ik]%6;
+     if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
+        values[kVZEROFlowVn+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
+     if(fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
+        values[kVZEROFlowSine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
+     if(fgUsedVars[kVZERODeltaPhiPsiN+iVZEROside*6+ih]) {
+        // compute delta phi = phi - Psi
+        values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] = values[kPhi] - values[kVZERORP+iVZEROside*6+ih];
+        // transform to the interval [0; 2*pi/n]
+        values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] -= 
+              2.0*TMath::Pi()/Double_t(ih+1) * TMath::Floor(Double_t(ih+1)/2.0/TMath::Pi()*values[kVZERODeltaPhiPsiN+iVZEROside*6+ih]);
+        // transform to [0; pi/n]
+        if(values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] > TMath::Pi()/Double_t(ih+1))
+          values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] = 2.0*TMath::Pi()/Double_t(ih+1) - values[kVZERODeltaPhiPsiN+iVZEROside*6+ih];
+     }
+     if(iVZEROside<2) {
+        if(fgUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
+           values[kVZEROuQ+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
+           values[kVZEROuQ+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
+           values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
         }
-     }  // end loop over harmonics
-  }  // end loop over VZERO sides
+        if(fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
+           values[kVZEROuQsine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
+           values[kVZEROuQsine+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
+           values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
+        }	    
+     }
+  }  // end loop over VZERO sides and harmonics
   
   // Fill TPC flow variables
   // Subtract the q vector of the track or of the pair legs from the event q-vector 
-  Bool_t tpcEPUsed = kFALSE;
-  for(Int_t ih=0; ih<6; ++ih) {
-     if(fgUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCDeltaPhiPsiN+ih]) {tpcEPUsed = kTRUE; break;}
-  }
+  Bool_t tpcEPUsed = !fgTPCFlowKernels.empty();
 
   if(tpcEPUsed) {
 //      Float_t tpcEPsubtracted[6] = {0.0};
@@ -1694,7 +1732,8 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 //         }
 //      }
 
-        for(Int_t ih=0; ih<6; ++ih) {
+        for(UInt_t ik=0; ik<fgTPCFlowKernels.size(); ++ik) {
+        const Int_t ih = fgTPCFlowKernels[ik];
         // vn using Psi_n
         if(fgUsedVars[kTPCFlowVn+ih])
            values[kTPCFlowVn+ih] = TMath::Cos(DeltaPhi(values[kPhi],values[kTPCRPtree+ih])*(ih+1));
@@ -2077,10 +2116,7 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
                           values[kPairPointingAngle]= p->PointingAngle();
 
   // polarization variables
-  Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
-    usePolarization = kTRUE;
-  if(usePolarization)
+  if(fgPolarizationKernel)
     GetThetaPhiCM(fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
 		  fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
 		  values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS], m1, m2);
@@ -2146,10 +2182,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   FillTrackInfo(&p, values);
   
   // polarization variables
-  Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
-    usePolarization = kTRUE;
-  if(usePolarization)
+  if(fgPolarizationKernel)
     GetThetaPhiCM(t1, t2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
   
   if(fgUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
@@ -2359,7 +2392,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     values[kPairOpeningAngle] = v1.Angle(v2);
   }
   
-  if(  t1->IsA()==TRACK::Class() && t2->IsA()==TRACK::Class()     ) {
+  if(  fgPairDcaKernel && t1->IsA()==TRACK::Class() && t2->IsA()==TRACK::Class()     ) {
     TRACK* ti1=(TRACK*)t1;
     TRACK* ti2=(TRACK*)t2;
 
@@ -2460,7 +2493,7 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
     values[kPairLegEMCALmatchedEnergy+1]  = ti2->MatchedEMCalClusterEnergy();
   }
 
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
+  if(fgPairEffKernel && fgPairEffMap) {
     Int_t binX = 0;
     if (fgEffMapVarDependencyX!=kNothing) {
       binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]); //make sure the values[XVar] are filled for EM
@@ -8,6 +8,8 @@
 #ifndef ALIREDUCEDVARMANAGER_H
 #define ALIREDUCEDVARMANAGER_H
 
+#include <vector>
+
 #include <TObject.h>
 #include <TString.h>
 #include <TChain.h>
@@ -858,6 +860,13 @@ class AliReducedVarManager : public TObject {
   static Bool_t fgUsedVars[kNVars];              // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
                                                  //   when a variable is used
   static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
+  static void CompileVariablePlan();           // build the lists of track/pair kernels needed by the used variables
+  static std::vector<Int_t> fgCosSinNPhiKernels;    // harmonics n for which cos(n*phi) or sin(n*phi) is used
+  static std::vector<Int_t> fgVZEROFlowKernels;     // VZERO side*6+harmonic for which a track flow variable is used
+  static std::vector<Int_t> fgTPCFlowKernels;       // TPC harmonics for which a track flow variable is used
+  static Bool_t fgPairEffKernel;                    // pair efficiency variables are used
+  static Bool_t fgPolarizationKernel;               // pair polarization angles are used
+  static Bool_t fgPairDcaKernel;                    // pair DCA variables are used
   
 
   static Double_t DeltaPhi(Double_t phi1, Double_t phi2);  
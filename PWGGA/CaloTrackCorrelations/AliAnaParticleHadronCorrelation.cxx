@@ -13,6 +13,8 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <algorithm>
+
 // --- ROOT system ---
 #include <TClass.h>
 #include <TMath.h>
@@ -27,6 +29,7 @@
 #include "AliNeutralMesonSelection.h"
 #include "AliAnaParticleHadronCorrelation.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
 #include "AliCaloTrackParticleCorrelation.h"
 #include "AliFiducialCut.h"
 #include "AliVTrack.h"
@@ -85,7 +88,7 @@ fFillUePartHistograms(0),       fFillXEHistograms(1),
 fFillZTHistograms(1),           fFillHBPHistograms(1),
 fMCGenTypeMin(0),               fMCGenTypeMax(0),
 fTrackVector(),                 fMomentum(),           fMomentumIM(),
-fDecayMom1(),                   fDecayMom2(),
+fDecayMom1(),                   fDecayMom2(),           fTrackRecords(),
 //Histograms
 fhPtTriggerInput(0),            fhPtTriggerSSCut(0),
 fhPtTriggerIsoCut(0),           fhPtTriggerFidCut(0),
@@ -4847,7 +4850,6 @@ void  AliAnaParticleHadronCorrelation::MakeChargedCorrelation(AliCaloTrackPartic
   Float_t etaTrig = aodParticle->Eta();
   Float_t ptTrig  = aodParticle->Pt();
   Int_t    mcTag  = aodParticle->GetTag();
-  Double_t bz     = GetReader()->GetInputEvent()->GetMagneticField();
   Int_t    sm     = aodParticle->GetSModNumber();
   
   Int_t   decayTag = 0;
@@ -4907,25 +4909,30 @@ void  AliAnaParticleHadronCorrelation::MakeChargedCorrelation(AliCaloTrackPartic
   //-----------------------------------------------------------------------
   // Track loop, select tracks with good pt, phi and fill AODs or histograms
   //-----------------------------------------------------------------------
-  for(Int_t ipr = 0;ipr < GetCTSTracks()->GetEntriesFast() ; ipr ++ )
+  
+  // Kinematics, ID, charge and TOF bits of the tracks computed once per event by the reader.
+  // Select only hadrons in pt range, visited in the order of the track list
+  const AliCaloTrackEtaPhiGrid * tracksView = GetReader()->GetCTSTracksEtaPhiGrid();
+  fTrackRecords.clear();
+  if ( tracksView ) tracksView->SelectPtRange(fMinAssocPt, fMaxAssocPt, fTrackRecords);
+  std::sort(fTrackRecords.begin(), fTrackRecords.end());
+  
+  for(UInt_t irecord = 0; irecord < fTrackRecords.size() ; irecord ++ )
   {
-    AliVTrack * track = (AliVTrack *) (GetCTSTracks()->At(ipr)) ;
+    Int_t irec = fTrackRecords[irecord];
     
-    fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-    pt   = fTrackVector.Pt();
-    eta  = fTrackVector.Eta();
-    phi  = fTrackVector.Phi() ;
-    if ( phi < 0 ) phi+=TMath::TwoPi();
+    AliVTrack * track = (AliVTrack *) (GetCTSTracks()->At(tracksView->GetEntry(irec))) ;
     
-    //Select only hadrons in pt range
-    if ( pt < fMinAssocPt || pt > fMaxAssocPt ) continue ;
+    pt   = tracksView->GetPt (irec);
+    eta  = tracksView->GetEta(irec);
+    phi  = tracksView->GetPhi(irec);
     
     // In case of isolation of single tracks or conversion photon (2 tracks) or pi0 (4 tracks),
     // do not count the candidate or the daughters of the candidate
     // in the isolation conte
     if ( aodParticle->GetDetectorTag() == kCTS ) // make sure conversions are tagged as kCTS!!!
     {
-      Int_t  trackID   = GetReader()->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
+      Int_t  trackID   = tracksView->GetID(irec) ; // GetReader()->GetTrackID(track), needed instead of track->GetID() since AOD needs some manipulations
       Bool_t contained = kFALSE;
       
       for(Int_t i = 0; i < 4; i++) 
@@ -4940,7 +4947,7 @@ void  AliAnaParticleHadronCorrelation::MakeChargedCorrelation(AliCaloTrackPartic
     Int_t evtIndex2 = 0 ;
     if (GetMixedEvent())
     {
-      evtIndex2 = GetMixedEvent()->EventIndex(GetReader()->GetTrackID(track)) ;
+      evtIndex2 = GetMixedEvent()->EventIndex(tracksView->GetID(irec)) ;
       if (evtIndex11 == evtIndex2 || evtIndex12 == evtIndex2 || evtIndex13 == evtIndex2 ) // photon and track from different events
         continue ;
       //vertex cut
@@ -4983,14 +4990,12 @@ void  AliAnaParticleHadronCorrelation::MakeChargedCorrelation(AliCaloTrackPartic
     //
     // * Get the status of the TOF bit *
     //
-    ULong_t status = track->GetStatus();
-    Bool_t okTOF = ( (status & AliVTrack::kTOFout) == AliVTrack::kTOFout ) ;
-    //Double32_t tof = track->GetTOFsignal()*1e-3;
-    Int_t trackBC = track->GetTOFBunchCrossing(bz);
+    Bool_t okTOF = tracksView->TestBits(irec, AliCaloTrackEtaPhiGrid::kTOFOut);
+    Bool_t bc0   = tracksView->TestBits(irec, AliCaloTrackEtaPhiGrid::kTOFBC0);
     
     Int_t outTOF = -1;
-    if      ( okTOF && trackBC!=0 ) outTOF = 1;
-    else if ( okTOF && trackBC==0 ) outTOF = 0;
+    if      ( okTOF && !bc0 ) outTOF = 1;
+    else if ( okTOF &&  bc0 ) outTOF = 0;
     
     //----------------
     // Fill Histograms
@@ -5034,7 +5039,7 @@ void  AliAnaParticleHadronCorrelation::MakeChargedCorrelation(AliCaloTrackPartic
                                 GetEventWeight());
       }
 
-      FillChargedMomentumImbalanceHistograms(ptTrig, pt, deltaPhi, sm, cenbin, track->Charge(),
+      FillChargedMomentumImbalanceHistograms(ptTrig, pt, deltaPhi, sm, cenbin, tracksView->GetCharge(irec),
                                              assocBin, decayTag, outTOF, mcTag);
     }
     
@@ -21,6 +21,8 @@
 /// \author Xiangrong Zhu <Xiangrong.Zhu@cern.ch>, CCNU, mixing implementation.
 //_________________________________________________________________________
 
+#include <vector>
+
 #include "AliAnaCaloTrackCorrBaseClass.h"
 class AliCaloTrackParticleCorrelation ;
 
@@ -374,6 +376,7 @@ private:
   TLorentzVector fMomentumIM;                            //!<! Cluster momentum from Invariant mass.
   TLorentzVector fDecayMom1;                             //!<! Decay particle momentum.
   TLorentzVector fDecayMom2;                             //!<! Decay particle momentum.
+  std::vector<Int_t> fTrackRecords;                      //!<! Records of the reader tracks view in the associated pT range, temporal.
   
   // Histograms
   
@@ -51,7 +51,9 @@ ClassImp(AliAnaPi0) ;
 /// Default Constructor. Initialized parameters with default values.
 //______________________________________________________
 AliAnaPi0::AliAnaPi0() : AliAnaCaloTrackCorrBaseClass(),
-fEventsList(0x0),
+fMixingPool(0x0),
+fMixPhotons1(),              fMixPhotons2(),
+fMixMass(),                  fMixPt(),                     fMixAsym(),                   fMixAngle(),        fMixEPair(),
 fUseAngleCut(kFALSE),        fUseAngleEDepCut(kFALSE),     fAngleCut(0),                 fAngleMaxCut(0.),   fUseOneCellSeparation(kFALSE),
 fMultiCutAna(kFALSE),        fMultiCutAnaSim(kFALSE),      fMultiCutAnaAcc(kFALSE),
 fNPtCuts(0),                 fNAsymCuts(0),                fNCellNCuts(0),               fNPIDBits(0), fNAngleCutBins(0),
@@ -246,22 +248,7 @@ AliAnaPi0::~AliAnaPi0()
 {
   // Remove event containers
   
-  if(DoOwnMix() && fEventsList)
-  {
-    for(Int_t ic=0; ic<GetNCentrBin(); ic++)
-    {
-      for(Int_t iz=0; iz<GetNZvertBin(); iz++)
-      {
-        for(Int_t irp=0; irp<GetNRPBin(); irp++)
-        {
-          Int_t bin = GetEventMixBin(ic,iz,irp);
-          fEventsList[bin]->Delete() ;
-          delete fEventsList[bin] ;
-        }
-      }
-    }
-    delete[] fEventsList;
-  }
+  delete fMixingPool;
 }
 
 //______________________________
@@ -864,20 +851,10 @@ TList * AliAnaPi0::GetCreateOutputObjects()
   //
   // Create mixed event containers
   //
-  fEventsList = new TList*[GetNCentrBin()*GetNZvertBin()*GetNRPBin()] ;
-  
-  for(Int_t ic=0; ic<GetNCentrBin(); ic++)
-  {
-    for(Int_t iz=0; iz<GetNZvertBin(); iz++)
-    {
-      for(Int_t irp=0; irp<GetNRPBin(); irp++)
-      {
-        Int_t bin = GetEventMixBin(ic,iz,irp);
-        fEventsList[bin] = new TList() ;
-        fEventsList[bin]->SetOwner(kFALSE);
-      }
-    }
-  }
+  // The event lists used before kept at most GetNMaxEvMix()-1 events, keep the same depth
+  delete fMixingPool;
+  fMixingPool = new AliAnaPi0MixingPool() ;
+  fMixingPool->Init(GetNCentrBin()*GetNZvertBin()*GetNRPBin(), GetNMaxEvMix()-1) ;
       
   fhRe1 = new TH2F*[GetNCentrBin()*fNPIDBits*fNAsymCuts] ;
   fhMi1 = new TH2F*[GetNCentrBin()*fNPIDBits*fNAsymCuts] ;
@@ -4781,62 +4758,69 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
     // Check that the bin exists, if not (bad determination of RP, centrality or vz bin) do nothing
     if(eventbin < 0) return ;
     
-    TList * evMixList=fEventsList[eventbin] ;
-    
-    if(!evMixList)
+    if(!fMixingPool)
     {
-      AliWarning(Form("Mix event list not available, bin %d",eventbin));
+      AliWarning(Form("Mix event pool not available, bin %d",eventbin));
       return;
     }
     
-    Int_t nMixed = evMixList->GetSize() ;
+    // Photons of the current event within the pT range, converted once for all the stored events
+    fMixPhotons1.Clear();
+    for(Int_t i1 = 0; i1 < nPhot; i1++)
+    {
+      AliCaloTrackParticle * p1 = (AliCaloTrackParticle*) (GetInputAODBranch()->At(i1)) ;
+      
+      if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
+      
+      fMixPhotons1.Add(p1, GetModuleNumber(p1), fNPIDBits);
+    }
+    
+    Int_t nMixed = fMixingPool->GetNEvents(eventbin) ;
     for(Int_t ii=0; ii<nMixed; ii++)
     {
-      TClonesArray* ev2= (TClonesArray*) (evMixList->At(ii));
-      Int_t nPhot2=ev2->GetEntriesFast() ;
+      // Stored photons are already within the pT range
+      const AliAnaPi0MixingPool::Event & ev2 = fMixingPool->GetEvent(eventbin, ii);
+      Int_t nPhot2 = ev2.GetN() ;
       Double_t m = -999;
       AliDebug(1,Form("Mixed event %d photon entries %d, centrality bin %d",ii, nPhot2, GetEventCentralityBin()));
       
       fhEventMixBin->Fill(eventbin, GetEventWeight()) ;
       
+      if ( nPhot2 > (Int_t) fMixMass.size() )
+      {
+        fMixMass .resize(nPhot2);
+        fMixPt   .resize(nPhot2);
+        fMixAsym .resize(nPhot2);
+        fMixAngle.resize(nPhot2);
+        fMixEPair.resize(nPhot2);
+      }
+      
       //---------------------------------
       // First loop on photons/clusters
       //---------------------------------
-      for(Int_t i1 = 0; i1 < nPhot; i1++)
+      for(Int_t i1 = 0; i1 < fMixPhotons1.GetN(); i1++)
       {
-        AliCaloTrackParticle * p1 = (AliCaloTrackParticle*) (GetInputAODBranch()->At(i1)) ;
-        
-        // Select photons within a pT range
-        if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
+        Double_t pt1 = fMixPhotons1.fPt[i1];
+        module1 = fMixPhotons1.fModule[i1];
         
-        // Not sure why this line is here
-        //if(fSameSM && GetModuleNumber(p1)!=module1) continue;
-        
-        //Get kinematics of cluster and (super) module of this cluster
-        fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
-        module1 = GetModuleNumber(p1);
+        // Kinematics of the pairs with all the photons of the mixed event
+        AliAnaPi0MixingPool::PairKernel(fMixPhotons1.fPx[i1], fMixPhotons1.fPy[i1], fMixPhotons1.fPz[i1], fMixPhotons1.fE[i1], ev2,
+                                        fMixMass.data(), fMixPt.data(), fMixAsym.data(), fMixAngle.data(), fMixEPair.data());
         
         //---------------------------------
         // Second loop on other mixed event photons/clusters
         //---------------------------------
         for(Int_t i2 = 0; i2 < nPhot2; i2++)
         {
-          AliCaloTrackParticle * p2 = (AliCaloTrackParticle*) (ev2->At(i2)) ;
-          
-          // Select photons within a pT range
-          if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
-          
-          // Get kinematics of second cluster and calculate those of the pair
-          fPhotonMom2.SetPxPyPzE(p2->Px(),p2->Py(),p2->Pz(),p2->E());
-          m           = (fPhotonMom1+fPhotonMom2).M() ;
-          Double_t pt = (fPhotonMom1 + fPhotonMom2).Pt();
-          Double_t a  = TMath::Abs(p1->E()-p2->E())/(p1->E()+p2->E()) ;
+          m           = fMixMass [i2];
+          Double_t pt = fMixPt   [i2];
+          Double_t a  = fMixAsym [i2];
+          Double_t angle = fMixAngle[i2];
           
           // Check if opening angle is too large or too small compared to what is expected
-          Double_t angle   = fPhotonMom1.Angle(fPhotonMom2.Vect());
-          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow((fPhotonMom1+fPhotonMom2).E(),angle+0.05))
+          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow(fMixEPair[i2],angle+0.05))
           {
-            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), (fPhotonMom1+fPhotonMom2).E()));
+            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), fMixEPair[i2]));
             continue;
           }
           
@@ -4848,7 +4832,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
 
 	  if(fUseOneCellSeparation)
 	  {
-	    Bool_t separation = CheckSeparation(p1->GetCellAbsIdMax() ,p2->GetCellAbsIdMax());
+	    Bool_t separation = CheckSeparation(fMixPhotons1.fCellAbsIdMax[i1], ev2.fCellAbsIdMax[i2]);
 	    if(!separation)
 	    {
 	      AliDebug(2,Form("Mix pair one cell separation required and Yes/No %d", separation));
@@ -4856,10 +4840,10 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
 	    }
 	  }
           
-          AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), p2->Pt(), pt,m,a));
+          AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",pt1, ev2.fPt[i2], pt,m,a));
           
           // In case we want only pairs in same (super) module, check their origin.
-          module2 = GetModuleNumber(p2);
+          module2 = ev2.fModule[i2];
                     
           //-------------------------------------------------------------------------------------------------
           // Fill module dependent histograms, put a cut on assymmetry on the first available cut in the array
@@ -4915,11 +4899,11 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
             }
             else
             {
-              Float_t phi1 = GetPhi(fPhotonMom1.Phi());
-              Float_t phi2 = GetPhi(fPhotonMom2.Phi());
+              Float_t phi1 = GetPhi(fMixPhotons1.fPhi[i1]);
+              Float_t phi2 = GetPhi(ev2.fPhi[i2]);
               Bool_t etaside = 0;
-              if(   (p1->GetDetectorTag()==kEMCAL && fPhotonMom1.Eta() < 0) 
-                 || (p2->GetDetectorTag()==kEMCAL && fPhotonMom2.Eta() < 0)) etaside = 1;
+              if(   (fMixPhotons1.fDetectorTag[i1]==kEMCAL && fMixPhotons1.fEta[i1] < 0) 
+                 || (ev2.fDetectorTag[i2]==kEMCAL && ev2.fEta[i2] < 0)) etaside = 1;
               
               if      (    phi1 > DegToRad(260) && phi2 > DegToRad(260) && phi1 < DegToRad(280) && phi2 < DegToRad(280))  fhMiSameSectorDCALPHOSMod[0+etaside]->Fill(pt, m, GetEventWeight());
               else if (    phi1 > DegToRad(280) && phi2 > DegToRad(280) && phi1 < DegToRad(300) && phi2 < DegToRad(300))  fhMiSameSectorDCALPHOSMod[2+etaside]->Fill(pt, m, GetEventWeight());
@@ -4943,8 +4927,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
             } 
             else // PHOS and DCal in same sector
             {
-              Float_t phi1 = GetPhi(fPhotonMom1.Phi());
-              Float_t phi2 = GetPhi(fPhotonMom2.Phi());
+              Float_t phi1 = GetPhi(fMixPhotons1.fPhi[i1]);
+              Float_t phi2 = GetPhi(ev2.fPhi[i2]);
               ok=kFALSE;
               if      ( phi1 > DegToRad(260) && phi2 > DegToRad(260) && phi1 < DegToRad(280) && phi2 < DegToRad(280)) ok = kTRUE;
               else if ( phi1 > DegToRad(280) && phi2 > DegToRad(280) && phi1 < DegToRad(300) && phi2 < DegToRad(300)) ok = kTRUE;
@@ -4961,8 +4945,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           // Check if one of the clusters comes from a conversion
           if ( fCheckConversion )
           {
-            if     (p1->IsTagged() && p2->IsTagged()) fhMiConv2->Fill(pt, m, GetEventWeight());
-            else if(p1->IsTagged() || p2->IsTagged()) fhMiConv ->Fill(pt, m, GetEventWeight());
+            if     (fMixPhotons1.fTagged[i1] && ev2.fTagged[i2]) fhMiConv2->Fill(pt, m, GetEventWeight());
+            else if(fMixPhotons1.fTagged[i1] || ev2.fTagged[i2]) fhMiConv ->Fill(pt, m, GetEventWeight());
           }
           
           //
@@ -4971,7 +4955,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           //
           for(Int_t ipid=0; ipid<fNPIDBits; ipid++)
           {
-            if((p1->IsPIDOK(ipid,AliCaloPID::kPhoton)) && (p2->IsPIDOK(ipid,AliCaloPID::kPhoton)))
+            if(fMixPhotons1.fPIDBits[i1] & ev2.fPIDBits[i2] & (1 << ipid))
             {
               for(Int_t iasym=0; iasym < fNAsymCuts; iasym++)
               {
@@ -4988,12 +4972,12 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                   
                   if(fFillBadDistHisto)
                   {
-                    if(p1->DistToBad()>0 && p2->DistToBad()>0)
+                    if(fMixPhotons1.fDistToBad[i1]>0 && ev2.fDistToBad[i2]>0)
                     {
                       fhMi2[index]->Fill(pt, m, GetEventWeight()) ;
                       if(fMakeInvPtPlots)fhMiInvPt2[index]->Fill(pt, m, 1./pt * GetEventWeight()) ;
                       
-                      if(p1->DistToBad()>1 && p2->DistToBad()>1)
+                      if(fMixPhotons1.fDistToBad[i1]>1 && ev2.fDistToBad[i2]>1)
                       {
                         fhMi3[index]->Fill(pt, m, GetEventWeight()) ;
                         if(fMakeInvPtPlots)fhMiInvPt3[index]->Fill(pt, m, 1./pt * GetEventWeight()) ;
@@ -5009,8 +4993,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           //-----------------------
           // Multi cuts analysis
           //-----------------------
-          Int_t  ncell1 = p1->GetNCells();
-          Int_t  ncell2 = p1->GetNCells();
+          Int_t  ncell1 = fMixPhotons1.fNCells[i1];
+          Int_t  ncell2 = fMixPhotons1.fNCells[i1];
           
           if(fMultiCutAna)
           {
@@ -5023,8 +5007,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                 {
                   Int_t index = ((ipt*fNCellNCuts)+icell)*fNAsymCuts + iasym;
                   
-                  if(p1->Pt() >   fPtCuts[ipt]      && p2->Pt() > fPtCuts[ipt]      &&
-                     p1->Pt() <   fPtCutsMax[ipt]   && p2->Pt() < fPtCutsMax[ipt]   &&
+                  if(pt1 >   fPtCuts[ipt]      && ev2.fPt[i2] > fPtCuts[ipt]      &&
+                     pt1 <   fPtCutsMax[ipt]   && ev2.fPt[i2] < fPtCutsMax[ipt]   &&
                      a        <   fAsymCuts[iasym]                                  &&
                      ncell1   >=  fCellNCuts[icell] && ncell2   >= fCellNCuts[icell] 
                      )
@@ -5063,20 +5047,20 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
             
             if( angleBin >= 0 && angleBin < fNAngleCutBins)
             {
-              Float_t e1   = fPhotonMom1.E();
-              Float_t e2   = fPhotonMom2.E();
+              Float_t e1   = fMixPhotons1.fE[i1];
+              Float_t e2   = ev2.fE[i2];
               
-              Float_t t1   = p1->GetTime();
-              Float_t t2   = p2->GetTime();
+              Float_t t1   = fMixPhotons1.fTime[i1];
+              Float_t t2   = ev2.fTime[i2];
               
               Int_t nc1    = ncell1;
               Int_t nc2    = ncell2;
               
-              Float_t eta1 = fPhotonMom1.Eta(); 
-              Float_t eta2 = fPhotonMom2.Eta(); 
+              Float_t eta1 = fMixPhotons1.fEta[i1]; 
+              Float_t eta2 = ev2.fEta[i2]; 
               
-              Float_t phi1 = GetPhi(fPhotonMom1.Phi());
-              Float_t phi2 = GetPhi(fPhotonMom2.Phi());
+              Float_t phi1 = GetPhi(fMixPhotons1.fPhi[i1]);
+              Float_t phi2 = GetPhi(ev2.fPhi[i2]);
               
               Int_t   mod1 = module1;
               Int_t   mod2 = module2;
@@ -5092,20 +5076,20 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               
               if(e2 > e1)
               {
-                e1   = fPhotonMom2.E();
-                e2   = fPhotonMom1.E();
+                e1   = ev2.fE[i2];
+                e2   = fMixPhotons1.fE[i1];
                 
-                t1   = p2->GetTime();
-                t2   = p1->GetTime();
+                t1   = ev2.fTime[i2];
+                t2   = fMixPhotons1.fTime[i1];
                 
                 nc1  = ncell2;
                 nc2  = ncell1;
                 
-                eta1 = fPhotonMom2.Eta(); 
-                eta2 = fPhotonMom1.Eta(); 
+                eta1 = ev2.fEta[i2]; 
+                eta2 = fMixPhotons1.fEta[i1]; 
                 
-                phi1 = GetPhi(fPhotonMom2.Phi());
-                phi2 = GetPhi(fPhotonMom1.Phi());
+                phi1 = GetPhi(ev2.fPhi[i2]);
+                phi2 = GetPhi(fMixPhotons1.fPhi[i1]);
                 
                 mod1 = module2;
                 mod2 = module1;
@@ -5156,10 +5140,10 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           // Check cell time content in cluster
           if ( fFillSecondaryCellTiming )
           {
-            if      ( p1->GetFiducialArea() == 0 && p2->GetFiducialArea() == 0 )
+            if      ( fMixPhotons1.fFiducialArea[i1] == 0 && ev2.fFiducialArea[i2] == 0 )
               fhMiSecondaryCellInTimeWindow ->Fill(pt, m, GetEventWeight());
             
-            else if ( p1->GetFiducialArea() != 0 && p2->GetFiducialArea() != 0 )
+            else if ( fMixPhotons1.fFiducialArea[i1] != 0 && ev2.fFiducialArea[i2] != 0 )
               fhMiSecondaryCellOutTimeWindow->Fill(pt, m, GetEventWeight());
           }
                   
@@ -5168,28 +5152,29 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
     }//loop on mixed events
     
     //--------------------------------------------------------
-    // Add the current event to the list of events for mixing
+    // Add the current event to the buffer for mixing
     //--------------------------------------------------------
     
-    //TClonesArray *currentEvent = new TClonesArray(*GetInputAODBranch());
-    TClonesArray *currentEvent = new TClonesArray(*secondLoopInputData);
-    
-    // Add current event to buffer and Remove redundant events
-    if( currentEvent->GetEntriesFast() > 0 )
+    // As before, events without clusters are not stored, those without clusters in the pT range are
+    if ( secondLoopInputData->GetEntriesFast() > 0 )
     {
-      evMixList->AddFirst(currentEvent) ;
-      currentEvent=0 ; //Now list of particles belongs to buffer and it will be deleted with buffer
-      if( evMixList->GetSize() >= GetNMaxEvMix() )
+      if ( secondLoopInputData == GetInputAODBranch() )
       {
-        TClonesArray * tmp = (TClonesArray*) (evMixList->Last()) ;
-        evMixList->RemoveLast() ;
-        delete tmp ;
+        fMixingPool->AddEvent(eventbin, fMixPhotons1);
+      }
+      else
+      {
+        fMixPhotons2.Clear();
+        for(Int_t i2 = 0; i2 < secondLoopInputData->GetEntriesFast(); i2++)
+        {
+          AliCaloTrackParticle * p2 = (AliCaloTrackParticle*) (secondLoopInputData->At(i2)) ;
+          
+          if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+          
+          fMixPhotons2.Add(p2, GetModuleNumber(p2), fNPIDBits);
+        }
+        fMixingPool->AddEvent(eventbin, fMixPhotons2);
       }
-    }
-    else
-    { // empty event
-      delete currentEvent ;
-      currentEvent=0 ;
     }
   }// DoOwnMix
   
@@ -32,6 +32,7 @@ class TObjString;
 
 // Analysis
 #include "AliAnaCaloTrackCorrBaseClass.h"
+#include "AliAnaPi0MixingPool.h"
 class AliAODEvent ;
 class AliESDEvent ;
 class AliCaloTrackParticle ;
@@ -189,8 +190,15 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
 
   private:
 
-  /// Containers for photons in stored events
-  TList ** fEventsList ;               //![GetNCentrBin()*GetNZvertBin()*GetNRPBin()]
+  AliAnaPi0MixingPool * fMixingPool ;  //!<! Containers for photons in stored events, per (centrality, z vertex, RP) bin
+  
+  AliAnaPi0MixingPool::Event fMixPhotons1 ; //!<! Photons of the current event to be mixed with the stored ones
+  AliAnaPi0MixingPool::Event fMixPhotons2 ; //!<! Photons of the other detector in the current event, to be stored
+  std::vector<Double_t> fMixMass  ;    //!<! Mixed pair mass, one photon against a stored event
+  std::vector<Double_t> fMixPt    ;    //!<! Mixed pair pT
+  std::vector<Double_t> fMixAsym  ;    //!<! Mixed pair energy asymmetry
+  std::vector<Double_t> fMixAngle ;    //!<! Mixed pair opening angle
+  std::vector<Double_t> fMixEPair ;    //!<! Mixed pair energy
   
   Bool_t   fUseAngleCut ;              ///<  Select pairs depending on their opening angle
   Bool_t   fUseAngleEDepCut ;          ///<  Select pairs depending on their opening angle
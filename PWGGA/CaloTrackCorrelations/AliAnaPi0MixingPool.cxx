@@ -0,0 +1,147 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+// --- ANALYSIS system ---
+#include "AliAnaPi0MixingPool.h"
+#include "AliCaloTrackParticle.h"
+#include "AliCaloPID.h"
+
+//____________________________________________
+/// Remove the photons, keeping the storage.
+//____________________________________________
+void AliAnaPi0MixingPool::Event::Clear()
+{
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fE.clear();
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fTime.clear();
+  fModule.clear();
+  fNCells.clear();
+  fCellAbsIdMax.clear();
+  fDistToBad.clear();
+  fFiducialArea.clear();
+  fDetectorTag.clear();
+  fPIDBits.clear();
+  fTagged.clear();
+}
+
+//____________________________________________________________________________________________
+/// Add a photon, with its (super) module number, and the PID bits up to nPIDBits.
+//____________________________________________________________________________________________
+void AliAnaPi0MixingPool::Event::Add(const AliCaloTrackParticle * p, Int_t module, Int_t nPIDBits)
+{
+  TLorentzVector mom(p->Px(), p->Py(), p->Pz(), p->E());
+
+  fPx.push_back(mom.Px());
+  fPy.push_back(mom.Py());
+  fPz.push_back(mom.Pz());
+  fE .push_back(mom.E ());
+  fPt.push_back(p->Pt());
+  fEta.push_back(mom.Eta());
+  fPhi.push_back(mom.Phi());
+  fTime.push_back(p->GetTime());
+  fModule.push_back(module);
+  fNCells.push_back(p->GetNCells());
+  fCellAbsIdMax.push_back(p->GetCellAbsIdMax());
+  fDistToBad.push_back(p->DistToBad());
+  fFiducialArea.push_back(p->GetFiducialArea());
+  fDetectorTag.push_back(p->GetDetectorTag());
+
+  UShort_t bits = 0;
+  for(Int_t ipid = 0; ipid < nPIDBits; ipid++)
+  {
+    if ( p->IsPIDOK(ipid, AliCaloPID::kPhoton) ) bits |= (1 << ipid);
+  }
+  fPIDBits.push_back(bits);
+  fTagged.push_back(p->IsTagged());
+}
+
+//____________________________________________________________
+/// Book nBins ring buffers of depth events.
+//____________________________________________________________
+void AliAnaPi0MixingPool::Init(Int_t nBins, Int_t depth)
+{
+  fDepth = depth > 0 ? depth : 0;
+  fSlots.assign(nBins*fDepth, Event());
+  fFirst.assign(nBins, 0);
+  fNEvents.assign(nBins, 0);
+}
+
+//_____________________________________________________________________
+/// Copy the event in the free slot of the bin or in its oldest one.
+//_____________________________________________________________________
+void AliAnaPi0MixingPool::AddEvent(Int_t bin, const Event & event)
+{
+  if ( fDepth == 0 ) return;
+
+  Int_t slot = 0;
+  if ( fNEvents[bin] < fDepth )
+  {
+    slot = (fFirst[bin] + fNEvents[bin]) % fDepth;
+    fNEvents[bin]++;
+  }
+  else
+  {
+    slot = fFirst[bin];
+    fFirst[bin] = (fFirst[bin] + 1) % fDepth;
+  }
+
+  // vector assignment reuses the capacity of the slot
+  fSlots[bin*fDepth + slot] = event;
+}
+
+//_______________________________________________________________________________________________________
+/// Pair of the photon (px,py,pz,e) with each photon i of the event: invariant mass, pT, energy asymmetry,
+/// opening angle and energy of the pair, same definitions as TLorentzVector::M(), Pt() and
+/// TVector3::Angle(). The output arrays must hold event.GetN() values.
+//_______________________________________________________________________________________________________
+void AliAnaPi0MixingPool::PairKernel(Double_t px, Double_t py, Double_t pz, Double_t e, const Event & event,
+                                     Double_t * mass, Double_t * pt, Double_t * asym, Double_t * angle, Double_t * epair)
+{
+  const Int_t n = event.GetN();
+  const Double_t * px2 = event.fPx.data();
+  const Double_t * py2 = event.fPy.data();
+  const Double_t * pz2 = event.fPz.data();
+  const Double_t * e2  = event.fE .data();
+  const Double_t p2    = px*px + py*py + pz*pz;
+
+  for(Int_t i = 0; i < n; i++)
+  {
+    const Double_t sx = px + px2[i];
+    const Double_t sy = py + py2[i];
+    const Double_t sz = pz + pz2[i];
+    const Double_t se = e  + e2 [i];
+    const Double_t m2 = se*se - (sx*sx + sy*sy + sz*sz);
+
+    mass [i] = m2 < 0 ? -TMath::Sqrt(-m2) : TMath::Sqrt(m2);
+    pt   [i] = TMath::Sqrt(sx*sx + sy*sy);
+    asym [i] = TMath::Abs(e - e2[i]) / se;
+    epair[i] = se;
+
+    const Double_t ptot2 = p2 * (px2[i]*px2[i] + py2[i]*py2[i] + pz2[i]*pz2[i]);
+    Double_t arg = ptot2 > 0 ? (px*px2[i] + py*py2[i] + pz*pz2[i]) / TMath::Sqrt(ptot2) : 1.;
+    if ( arg >  1. ) arg =  1.;
+    if ( arg < -1. ) arg = -1.;
+    angle[i] = TMath::ACos(arg);
+  }
+}
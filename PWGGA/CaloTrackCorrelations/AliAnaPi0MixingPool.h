@@ -0,0 +1,83 @@
+#ifndef ALIANAPI0MIXINGPOOL_H
+#define ALIANAPI0MIXINGPOOL_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliAnaPi0MixingPool
+/// \ingroup CaloTrackCorrelationsAnalysis
+/// \brief Event buffers of photons for the own mixing of AliAnaPi0.
+///
+/// For each (centrality, z vertex, reaction plane) bin a ring buffer of fixed
+/// depth keeps the photons of the previous events. Only what the mixed pair
+/// loop needs is kept (kinematics, module number, PID bits and the few cluster
+/// parameters used for the selections), in structure of arrays layout, and only
+/// for the photons inside the pT window of the analysis. The storage of the
+/// slots is reused, so no allocation happens once the buffers are full.
+///
+/// PairKernel computes the invariant mass, pT, asymmetry and opening angle
+/// of one photon with all the photons of a stored event in one pass.
+//_________________________________________________________________________
+
+#include <vector>
+#include <Rtypes.h>
+
+class AliCaloTrackParticle;
+
+class AliAnaPi0MixingPool {
+
+ public:
+
+  /// Photons of one event
+  struct Event {
+    std::vector<Double_t> fPx;
+    std::vector<Double_t> fPy;
+    std::vector<Double_t> fPz;
+    std::vector<Double_t> fE;
+    std::vector<Double_t> fPt;
+    std::vector<Float_t>  fEta;
+    std::vector<Float_t>  fPhi;
+    std::vector<Float_t>  fTime;
+    std::vector<Int_t>    fModule;
+    std::vector<Int_t>    fNCells;
+    std::vector<Int_t>    fCellAbsIdMax;
+    std::vector<Int_t>    fDistToBad;
+    std::vector<Int_t>    fFiducialArea;
+    std::vector<UInt_t>   fDetectorTag;
+    std::vector<UShort_t> fPIDBits;   ///< bit ipid set if IsPIDOK(ipid, photon)
+    std::vector<Bool_t>   fTagged;
+
+    Int_t GetN() const { return fE.size(); }
+    void  Clear();
+    void  Add(const AliCaloTrackParticle * p, Int_t module, Int_t nPIDBits);
+  };
+
+  AliAnaPi0MixingPool() : fDepth(0), fSlots(), fFirst(), fNEvents() { }
+  virtual ~AliAnaPi0MixingPool() { }
+
+  void          Init(Int_t nBins, Int_t depth);
+
+  /// Add the event to the buffer of the bin, replacing the oldest one if full
+  void          AddEvent(Int_t bin, const Event & event);
+
+  Int_t         GetNEvents(Int_t bin) const { return fNEvents[bin]; }
+
+  /// Stored event iev of the bin, 0 being the most recent
+  const Event & GetEvent(Int_t bin, Int_t iev) const
+  { return fSlots[bin*fDepth + (fFirst[bin] + fNEvents[bin] - 1 - iev) % fDepth]; }
+
+  static void   PairKernel(Double_t px, Double_t py, Double_t pz, Double_t e, const Event & event,
+                           Double_t * mass, Double_t * pt, Double_t * asym, Double_t * angle, Double_t * epair);
+
+ private:
+
+  AliAnaPi0MixingPool(const AliAnaPi0MixingPool & pool) ;
+  AliAnaPi0MixingPool & operator = (const AliAnaPi0MixingPool & pool) ;
+
+  Int_t              fDepth;   ///< Number of events kept per bin
+  std::vector<Event> fSlots;   ///< [nBins*fDepth] ring buffers of all bins
+  std::vector<Int_t> fFirst;   ///< Slot of the oldest event of each bin
+  std::vector<Int_t> fNEvents; ///< Number of stored events of each bin
+};
+
+#endif //ALIANAPI0MIXINGPOOL_H
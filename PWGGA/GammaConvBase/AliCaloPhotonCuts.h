@@ -284,6 +284,9 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     virtual Bool_t  IsSelected(TObject* /*obj*/)               {return kTRUE;}
     virtual Bool_t  IsSelected(TList* /*list*/)                {return kTRUE;}
 
+    // No compiled selection plan as for AliConversionPhotonCuts: the cut digits are already resolved
+    // into thresholds by the setters, and the cost per cluster is in the local maxima, track matching
+    // and MC efficiency evaluations, which a plan would not remove.
     Bool_t      ClusterIsSelected(AliVCluster* cluster, AliVEvent *event, AliMCEvent *mcEvent,Int_t isMC, Double_t weight=1., Long_t clusterID = -1);
     Bool_t      ClusterIsSelectedBeforeTrackMatch(){return fIsCurrentClusterAcceptedBeforeTM;}
     Bool_t      ClusterIsSelectedMC(TParticle *particle,AliMCEvent *mcEvent);
@@ -180,7 +180,9 @@ AliConversionMesonCuts::AliConversionMesonCuts(const char *name,const char *titl
   fEnableOmegaAPlikeCut(kFALSE),
   fDoGammaMinEnergyCut(kFALSE),
   fNDaughterEnergyCut(0),
-  fSingleDaughterMinE(0.)
+  fSingleDaughterMinE(0.),
+  fSelectionPlan(),
+  fSelectionPlanCompiled(kFALSE)
 {
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
   fCutString=new TObjString((GetCutNumber()).Data());
@@ -299,7 +301,9 @@ AliConversionMesonCuts::AliConversionMesonCuts(const AliConversionMesonCuts &ref
   fEnableOmegaAPlikeCut(ref.fEnableOmegaAPlikeCut),
   fDoGammaMinEnergyCut(kFALSE),
   fNDaughterEnergyCut(0),
-  fSingleDaughterMinE(0.)
+  fSingleDaughterMinE(0.),
+  fSelectionPlan(),
+  fSelectionPlanCompiled(kFALSE)
 
 {
   // Copy Constructor
@@ -1518,8 +1522,12 @@ Bool_t AliConversionMesonCuts::MesonIsSelected(AliAODConversionMother *pi0,Bool_
   // Mass cut
   if (fIsMergedClusterCut == 1 ){
     if (fEnableMassCut){
-      Double_t massMin = FunctionMinMassCut(pi0->E());
-      Double_t massMax = FunctionMaxMassCut(pi0->E());
+      Float_t massMin = -1;
+      Float_t massMax = -1;
+      if (!MergedMassWindow(pi0->E(), massMin, massMax)){
+        massMin = FunctionMinMassCut(pi0->E());
+        massMax = FunctionMaxMassCut(pi0->E());
+      }
   //     cout << "Min mass: " << massMin << "\t max Mass: " << massMax << "\t mass current: " <<  pi0->M()<< "\t E current: " << pi0->E() << endl;
       if (pi0->M() > massMax || pi0->M() < massMin ){
         if(hist)hist->Fill(cutIndex, pi0->Pt());
@@ -1689,12 +1697,15 @@ Bool_t AliConversionMesonCuts::InitializeCutsFromCutString(const TString analysi
   }
 
   PrintCutsWithValues();
+  CompileSelectionPlan();
   return kTRUE;
 }
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetCut(cutIds cutID, const Int_t value) {
   ///Set individual cut ID
 
+  InvalidateSelectionPlan();
+
   //cout << "Updating cut  " << fgkCutNames[cutID] << " (" << cutID << ") to " << value << endl;
   switch (cutID) {
   case kMesonKind:
@@ -1898,6 +1909,7 @@ void AliConversionMesonCuts::PrintCutsWithValues() {
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetMesonKind(Int_t mesonKind){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(mesonKind){
   case 0:
@@ -1931,6 +1943,7 @@ Bool_t AliConversionMesonCuts::SetMesonKind(Int_t mesonKind){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetMinPtCut(Int_t PtCut){
+  InvalidateSelectionPlan();
   // Set Cut on min pT of meson
   switch(PtCut){
   case 0: // no cut on pT
@@ -2065,6 +2078,7 @@ Bool_t AliConversionMesonCuts::SetMinPtCut(Int_t PtCut){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetSelectionWindowCut(Int_t selectionCut){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(selectionCut){
     case 0:
@@ -2238,6 +2252,7 @@ Bool_t AliConversionMesonCuts::SetSelectionWindowCut(Int_t selectionCut){
 }
 
 Bool_t AliConversionMesonCuts::SetSelectionWindowMergedCut(Int_t selectionCut){
+  InvalidateSelectionPlan();
   // Set Cut
   fSelectionWindowCut = selectionCut;
   switch(fSelectionWindowCut){
@@ -2281,6 +2296,7 @@ Bool_t AliConversionMesonCuts::SetSelectionWindowMergedCut(Int_t selectionCut){
 }
 
 Bool_t AliConversionMesonCuts::SetSelectionWindowCutPtDep(Int_t selectionCut){
+  InvalidateSelectionPlan();
   // Set Cut
   fSelectionWindowCut = selectionCut;
   switch(fSelectionWindowCut){
@@ -2519,372 +2535,144 @@ Bool_t AliConversionMesonCuts::SetSelectionWindowCutPtDep(Int_t selectionCut){
 
 }
 
-Float_t AliConversionMesonCuts::FunctionMaxMassCut(Float_t e){
-
-  Float_t switchMass    = 0;
-  Float_t aMassLow      = 0;
-  Float_t bMassLow      = 0;
-  Float_t aMassHigh     = 0;
-  Float_t bMassHigh     = 0;
-  Float_t aMass         = 0;
-  Float_t bMass         = 0;
-  Float_t switchSigma   = 0.;
-  Float_t nSigma        = 0;
-  Float_t aSigmaLow     = 0.;
-  Float_t bSigmaLow     = 0;
-  Float_t aSigmaHigh    = 0.;
-  Float_t bSigmaHigh    = 0;
-  Float_t mass          = 0;
-  Float_t sigma         = 0;
+//________________________________________________________________________
+void AliConversionMesonCuts::CompileSelectionPlan(){
+  // Resolve the merged cluster mass window of fSelectionWindowCut into the
+  // parameters evaluated by MergedMassWindow
+  // NLM 1 uses a single mass parametrisation, stored as identical low and high branches
+
+  SelectionPlan &plan     = fSelectionPlan;
+  plan.fMassWindowMode    = 0;
+  plan.fSwitchMass        = 0;
+  plan.fAMassLow          = 0;
+  plan.fBMassLow          = 0;
+  plan.fAMassHigh         = 0;
+  plan.fBMassHigh         = 0;
+  plan.fSwitchSigma       = 0;
+  plan.fASigmaLow         = 0;
+  plan.fBSigmaLow         = 0;
+  plan.fASigmaHigh        = 0;
+  plan.fBSigmaHigh        = 0;
+  plan.fNSigma            = 0;
+  plan.fMinMassOffset     = 0;
+  plan.fMinMassSlope      = 0;
 
   switch(fSelectionWindowCut){
-    case 0:
-      fEnableMassCut = kFALSE;
-      break;
     case 1:   //NLM 1
-      aMass         = 0.044;
-      bMass         = 0.0049;
-      switchSigma   = 19.;
-      nSigma        = 3;
-      aSigmaLow     = 0.012;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0012;
-      bSigmaHigh    = 6e-4;
-
-      mass          = aMass + bMass*e;
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-      return mass + nSigma*sigma;
-      break;
-    case 2:  //NLM 2
-      switchMass    = 21;
-      aMassLow      = 0.115;
-      bMassLow      = 9.6e-4;
-      aMassHigh     = 0.1;
-      bMassHigh     = 0.0017;
-      switchSigma   = 10.;
-      nSigma        = 3;
-      aSigmaLow     = 0.009;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0023;
-      bSigmaHigh    = 6.7e-4;
-
-      mass          = 0;
-      if (e < switchMass){
-        mass        = aMassLow + bMassLow*e;
-      } else {
-        mass        = aMassHigh + bMassHigh*e;
-      }
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-      return mass + nSigma*sigma;
-      break;
     case 3:   //NLM 1
-      aMass         = 0.044;
-      bMass         = 0.0049;
-      switchSigma   = 19.;
-      nSigma        = 2;
-      aSigmaLow     = 0.012;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0012;
-      bSigmaHigh    = 6e-4;
-
-      mass          = aMass + bMass*e;
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-      return mass + nSigma*sigma;
-      break;
-    case 4:  //NLM 2
-      switchMass    = 21;
-      aMassLow      = 0.115;
-      bMassLow      = 9.6e-4;
-      aMassHigh     = 0.1;
-      bMassHigh     = 0.0017;
-      switchSigma   = 10.;
-      nSigma        = 2;
-      aSigmaLow     = 0.009;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0023;
-      bSigmaHigh    = 6.7e-4;
-
-      mass          = 0;
-      if (e < switchMass){
-        mass        = aMassLow + bMassLow*e;
-      } else {
-        mass        = aMassHigh + bMassHigh*e;
-      }
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-      return mass + nSigma*sigma;
-      break;
     case 5:   //NLM 1
-      aMass         = 0.044;
-      bMass         = 0.0049;
-      switchSigma   = 19.;
-      nSigma        = 4;
-      aSigmaLow     = 0.012;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0012;
-      bSigmaHigh    = 6e-4;
-
-      mass          = aMass + bMass*e;
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-      return mass + nSigma*sigma;
-      break;
-    case 6:  //NLM 2
-      switchMass    = 21;
-      aMassLow      = 0.115;
-      bMassLow      = 9.6e-4;
-      aMassHigh     = 0.1;
-      bMassHigh     = 0.0017;
-      switchSigma   = 10.;
-      nSigma        = 4;
-      aSigmaLow     = 0.009;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0023;
-      bSigmaHigh    = 6.7e-4;
-
-      mass          = 0;
-      if (e < switchMass){
-        mass        = aMassLow + bMassLow*e;
-      } else {
-        mass        = aMassHigh + bMassHigh*e;
-      }
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-      return mass + nSigma*sigma;
+      plan.fMassWindowMode  = 1;
+      plan.fAMassLow        = 0.044;
+      plan.fBMassLow        = 0.0049;
+      plan.fAMassHigh       = 0.044;
+      plan.fBMassHigh       = 0.0049;
+      plan.fSwitchSigma     = 19.;
+      plan.fASigmaLow       = 0.012;
+      plan.fBSigmaLow       = 0;
+      plan.fASigmaHigh      = 0.0012;
+      plan.fBSigmaHigh      = 6e-4;
       break;
-    case 7: // maximum mass
-      return 10000.;
+    case 2:   //NLM 2
+    case 4:   //NLM 2
+    case 6:   //NLM 2
+      plan.fMassWindowMode  = 1;
+      plan.fSwitchMass      = 21;
+      plan.fAMassLow        = 0.115;
+      plan.fBMassLow        = 9.6e-4;
+      plan.fAMassHigh       = 0.1;
+      plan.fBMassHigh       = 0.0017;
+      plan.fSwitchSigma     = 10.;
+      plan.fASigmaLow       = 0.009;
+      plan.fBSigmaLow       = 0;
+      plan.fASigmaHigh      = 0.0023;
+      plan.fBSigmaHigh      = 6.7e-4;
+      break;
+    case 7: // just exclude band at 0
+      plan.fMassWindowMode  = 2;
+      plan.fMinMassOffset   = 0.005;
+      plan.fMinMassSlope    = 0.004;
       break;
-    case 8: // maximum mass
-      return 10000.;
+    case 8: // just exclude band at 0 looser
+      plan.fMassWindowMode  = 2;
+      plan.fMinMassOffset   = 0.004;
+      plan.fMinMassSlope    = 0.004;
       break;
-    case 9: // maximum mass
-      return 10000.;
+    case 9: // just exclude band at 0 tighter
+      plan.fMassWindowMode  = 2;
+      plan.fMinMassOffset   = 0.006;
+      plan.fMinMassSlope    = 0.004;
       break;
     default:
-      cout<<"Warning: SelectionCut merged not defined "<<fSelectionWindowCut<<endl;
-      return -1;
+      break;
   }
-  return -1;
+  if (fSelectionWindowCut == 1 || fSelectionWindowCut == 2)      plan.fNSigma = 3;
+  else if (fSelectionWindowCut == 3 || fSelectionWindowCut == 4) plan.fNSigma = 2;
+  else if (fSelectionWindowCut == 5 || fSelectionWindowCut == 6) plan.fNSigma = 4;
 
+  fSelectionPlanCompiled  = kTRUE;
 }
 
-Float_t AliConversionMesonCuts::FunctionMinMassCut(Float_t e){
-
-  Float_t switchMass      = 0;
-  Float_t aMassLow        = 0;
-  Float_t bMassLow        = 0;
-  Float_t aMassHigh       = 0;
-  Float_t bMassHigh       = 0;
-  Float_t aMass           = 0;
-  Float_t bMass           = 0;
-  Float_t switchSigma     = 0.;
-  Float_t nSigma          = 0;
-  Float_t aSigmaLow       = 0.;
-  Float_t bSigmaLow       = 0;
-  Float_t aSigmaHigh      = 0.;
-  Float_t bSigmaHigh      = 0;
-  Float_t mass            = 0;
-  Float_t sigma           = 0;
-
-  switch(fSelectionWindowCut){
-    case 0:
-      fEnableMassCut      = kFALSE;
-      break;
-    case 1:   //NLM 1
-      aMass         = 0.044;
-      bMass         = 0.0049;
-      switchSigma   = 19.;
-      nSigma        = 3;
-      aSigmaLow     = 0.012;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0012;
-      bSigmaHigh    = 6e-4;
-
-      mass          = aMass + bMass*e;
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-  //     cout << "E: "<< e << "\t mass: " << mass << "\t sigma: " << sigma<<  endl;
-      return mass - nSigma*sigma;
-      break;
-    case 2:  //NLM 2
-      switchMass    = 21;
-      aMassLow      = 0.115;
-      bMassLow      = 9.6e-4;
-      aMassHigh     = 0.1;
-      bMassHigh     = 0.0017;
-      switchSigma   = 10.;
-      nSigma        = 3;
-      aSigmaLow     = 0.009;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0023;
-      bSigmaHigh    = 6.7e-4;
-
-      mass          = 0;
-      if (e < switchMass){
-        mass        = aMassLow + bMassLow*e;
+//________________________________________________________________________
+Bool_t AliConversionMesonCuts::MergedMassWindow(Float_t e, Float_t &massMin, Float_t &massMax) const {
+  // Lower and upper edge of the merged cluster mass window at energy e
+  // returns kFALSE if no window is defined for fSelectionWindowCut
+
+  const SelectionPlan &plan = GetSelectionPlan();
+  switch(plan.fMassWindowMode){
+    case 1: {
+      Float_t mass          = 0;
+      if (e < plan.fSwitchMass){
+        mass                = plan.fAMassLow + plan.fBMassLow*e;
       } else {
-        mass        = aMassHigh + bMassHigh*e;
+        mass                = plan.fAMassHigh + plan.fBMassHigh*e;
       }
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
+      Float_t sigma         = 0;
+      if (e < plan.fSwitchSigma){
+        sigma               = plan.fASigmaLow + plan.fBSigmaLow*e;
       } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
+        sigma               = plan.fASigmaHigh + plan.fBSigmaHigh*e;
       }
-  //     cout << "E: "<< e << "\t mass: " << mass << "\t sigma: "<< sigma << endl;
+      massMin               = mass - plan.fNSigma*sigma;
+      massMax               = mass + plan.fNSigma*sigma;
+      return kTRUE;
+    }
+    case 2:
+      massMin               = plan.fMinMassOffset + plan.fMinMassSlope*e;
+      massMax               = 10000.;
+      return kTRUE;
+    default:
+      massMin               = -1;
+      massMax               = -1;
+      return kFALSE;
+  }
+}
 
-      return mass - nSigma*sigma;
-      break;
-    case 3:   //NLM 1
-      aMass         = 0.044;
-      bMass         = 0.0049;
-      switchSigma   = 19.;
-      nSigma        = 2;
-      aSigmaLow     = 0.012;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0012;
-      bSigmaHigh    = 6e-4;
-
-      mass          = aMass + bMass*e;
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-  //     cout << "E: "<< e << "\t mass: " << mass << "\t sigma: " << sigma<<  endl;
-      return mass - nSigma*sigma;
-      break;
-    case 4:  //NLM 2
-      switchMass    = 21;
-      aMassLow      = 0.115;
-      bMassLow      = 9.6e-4;
-      aMassHigh     = 0.1;
-      bMassHigh     = 0.0017;
-      switchSigma   = 10.;
-      nSigma        = 2;
-      aSigmaLow     = 0.009;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0023;
-      bSigmaHigh    = 6.7e-4;
-
-      mass          = 0;
-      if (e < switchMass){
-        mass        = aMassLow + bMassLow*e;
-      } else {
-        mass        = aMassHigh + bMassHigh*e;
-      }
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-  //     cout << "E: "<< e << "\t mass: " << mass << "\t sigma: "<< sigma << endl;
+//________________________________________________________________________
+Float_t AliConversionMesonCuts::FunctionMaxMassCut(Float_t e){
 
-      return mass - nSigma*sigma;
-      break;
-    case 5:   //NLM 1
-      aMass         = 0.044;
-      bMass         = 0.0049;
-      switchSigma   = 19.;
-      nSigma        = 4;
-      aSigmaLow     = 0.012;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0012;
-      bSigmaHigh    = 6e-4;
-
-      mass          = aMass + bMass*e;
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-  //     cout << "E: "<< e << "\t mass: " << mass << "\t sigma: " << sigma<<  endl;
-      return mass - nSigma*sigma;
-      break;
-    case 6:  //NLM 2
-      switchMass    = 21;
-      aMassLow      = 0.115;
-      bMassLow      = 9.6e-4;
-      aMassHigh     = 0.1;
-      bMassHigh     = 0.0017;
-      switchSigma   = 10.;
-      nSigma        = 4;
-      aSigmaLow     = 0.009;
-      bSigmaLow     = 0;
-      aSigmaHigh    = 0.0023;
-      bSigmaHigh    = 6.7e-4;
-
-      mass          = 0;
-      if (e < switchMass){
-        mass        = aMassLow + bMassLow*e;
-      } else {
-        mass        = aMassHigh + bMassHigh*e;
-      }
-      sigma         = 0;
-      if (e < switchSigma){
-        sigma       = aSigmaLow + bSigmaLow*e;
-      } else {
-        sigma       = aSigmaHigh + bSigmaHigh*e;
-      }
-  //     cout << "E: "<< e << "\t mass: " << mass << "\t sigma: "<< sigma << endl;
-      return mass - nSigma*sigma;
-      break;
+  Float_t massMin = -1;
+  Float_t massMax = -1;
+  if (MergedMassWindow(e, massMin, massMax)) return massMax;
+  if (fSelectionWindowCut == 0) fEnableMassCut = kFALSE;
+  else cout<<"Warning: SelectionCut merged not defined "<<fSelectionWindowCut<<endl;
+  return -1;
+}
 
-    case 7: // just exclude band at 0
-      return 0.005+0.004*e;
-      break;
-    case 8: // just exclude band at 0 looser
-      return 0.004+0.004*e;
-      break;
-    case 9: // just exclude band at 0 tighter
-      return 0.006+0.004*e;
-      break;
+//________________________________________________________________________
+Float_t AliConversionMesonCuts::FunctionMinMassCut(Float_t e){
 
-    default:
-      cout<<"Warning: SelectionCut merged not defined "<<fSelectionWindowCut<<endl;
-      return -1;
-  }
+  Float_t massMin = -1;
+  Float_t massMax = -1;
+  if (MergedMassWindow(e, massMin, massMax)) return massMin;
+  if (fSelectionWindowCut == 0) fEnableMassCut = kFALSE;
+  else cout<<"Warning: SelectionCut merged not defined "<<fSelectionWindowCut<<endl;
   return -1;
 }
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetAlphaMesonCut(Int_t alphaMesonCut)
 { // Set Cut
+  InvalidateSelectionPlan();
   switch(alphaMesonCut){
   case 0:  // 0- 0.7
     fAlphaMinCutMeson   = 0.0;
@@ -3032,6 +2820,7 @@ Bool_t AliConversionMesonCuts::SetAlphaMesonCut(Int_t alphaMesonCut)
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetAlphaMesonMergedCut(Int_t alphaMesonCut)
 { // Set Cut
+  InvalidateSelectionPlan();
   switch(alphaMesonCut){
   case 0:  // 0- 1
     fAlphaMinCutMeson = 0.0;
@@ -3108,6 +2897,7 @@ Bool_t AliConversionMesonCuts::SetAlphaMesonMergedCut(Int_t alphaMesonCut)
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetRapidityMesonCut(Int_t RapidityMesonCut){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(RapidityMesonCut){
   case 0:  // changed from 0.9 to 1.35
@@ -3184,6 +2974,7 @@ Bool_t AliConversionMesonCuts::SetRapidityMesonCut(Int_t RapidityMesonCut){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetBackgroundScheme(Int_t BackgroundScheme){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(BackgroundScheme){
   case 0: //Rotation
@@ -3445,6 +3236,7 @@ Bool_t AliConversionMesonCuts::SetBackgroundScheme(Int_t BackgroundScheme){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetNDegreesForRotationMethod(Int_t DegreesForRotationMethod){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(DegreesForRotationMethod){
   case 0:
@@ -3469,6 +3261,7 @@ Bool_t AliConversionMesonCuts::SetNDegreesForRotationMethod(Int_t DegreesForRota
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetNumberOfBGEvents(Int_t NumberOfBGEvents){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(NumberOfBGEvents){
   case 0:
@@ -3503,6 +3296,7 @@ Bool_t AliConversionMesonCuts::SetNumberOfBGEvents(Int_t NumberOfBGEvents){
 }
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetSharedElectronCut(Int_t sharedElec) {
+  InvalidateSelectionPlan();
 
   switch(sharedElec){
   case 0:
@@ -3531,6 +3325,7 @@ Bool_t AliConversionMesonCuts::SetSharedElectronCut(Int_t sharedElec) {
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetToCloseV0sCut(Int_t toClose) {
+  InvalidateSelectionPlan();
 
   if(!fEnableOmegaAPlikeCut){                                                   // this cut is overloaded for the omega to pizero gamma analysis
     switch(toClose){
@@ -3581,6 +3376,7 @@ Bool_t AliConversionMesonCuts::SetToCloseV0sCut(Int_t toClose) {
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetMCPSmearing(Int_t useMCPSmearing)
 {// Set Cut
+  InvalidateSelectionPlan();
   if(fMode == 2){ //PCM-EMCal running
     switch(useMCPSmearing){
     case 0:
@@ -3847,6 +3643,7 @@ Bool_t AliConversionMesonCuts::SetMCPSmearing(Int_t useMCPSmearing)
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetDCAGammaGammaCut(Int_t DCAGammaGamma){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(DCAGammaGamma){
   case 0:  //
@@ -3898,6 +3695,7 @@ Bool_t AliConversionMesonCuts::SetDCAGammaGammaCut(Int_t DCAGammaGamma){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetDCAZMesonPrimVtxCut(Int_t DCAZMesonPrimVtx){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(DCAZMesonPrimVtx){
   case 0:  //
@@ -3949,6 +3747,7 @@ Bool_t AliConversionMesonCuts::SetDCAZMesonPrimVtxCut(Int_t DCAZMesonPrimVtx){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetDCARMesonPrimVtxCut(Int_t DCARMesonPrimVtx){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(DCARMesonPrimVtx){
   case 0:  //
@@ -4000,6 +3799,7 @@ Bool_t AliConversionMesonCuts::SetDCARMesonPrimVtxCut(Int_t DCARMesonPrimVtx){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetMinOpanMesonCut(Int_t minOpanMesonCut){
+  InvalidateSelectionPlan();
   // Set Cut
 
     switch(minOpanMesonCut){
@@ -4140,6 +3940,7 @@ Bool_t AliConversionMesonCuts::SetMinOpanMesonCut(Int_t minOpanMesonCut){
 
 //________________________________________________________________________
 Bool_t AliConversionMesonCuts::SetMaxOpanMesonCut(Int_t maxOpanMesonCut){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(maxOpanMesonCut){
   case 0:      //
@@ -4241,7 +4042,6 @@ Bool_t AliConversionMesonCuts::RejectToCloseV0s(AliAODConversionPhoton* photon,
 //________________________________________________________________________
 void AliConversionMesonCuts::SmearParticle(AliAODConversionPhoton* photon)
 {
-
   if (photon==NULL) return;
   Double_t facPBrem = 1.;
   Double_t facPSig = 0.;
@@ -86,7 +86,35 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
       kNCuts
     };
 
+    /// Flat form of the merged cluster mass window selected with the SelectionWindow
+    /// cut (see CompileSelectionPlan). The window parameters are resolved once from
+    /// the cut value, instead of at each call of FunctionMinMassCut/FunctionMaxMassCut.
+    struct SelectionPlan {
+      Int_t       fMassWindowMode;        ///< 0: no window, 1: mass -/+ nSigma*sigma, 2: lower bound only
+      Float_t     fSwitchMass;            ///< energy at which the mass parametrisation changes
+      Float_t     fAMassLow;              ///< mass = a + b*E below fSwitchMass
+      Float_t     fBMassLow;              ///< mass = a + b*E below fSwitchMass
+      Float_t     fAMassHigh;             ///< mass = a + b*E above fSwitchMass
+      Float_t     fBMassHigh;             ///< mass = a + b*E above fSwitchMass
+      Float_t     fSwitchSigma;           ///< energy at which the width parametrisation changes
+      Float_t     fASigmaLow;             ///< sigma = a + b*E below fSwitchSigma
+      Float_t     fBSigmaLow;             ///< sigma = a + b*E below fSwitchSigma
+      Float_t     fASigmaHigh;            ///< sigma = a + b*E above fSwitchSigma
+      Float_t     fBSigmaHigh;            ///< sigma = a + b*E above fSwitchSigma
+      Float_t     fNSigma;                ///< half width of the window in sigma
+      Double_t    fMinMassOffset;         ///< lower bound = offset + slope*E (mode 2)
+      Double_t    fMinMassSlope;          ///< lower bound = offset + slope*E (mode 2)
+    };
+
     Bool_t  SetCutIds(TString cutString);
+    void    CompileSelectionPlan();
+    // the plan is compiled on first use after the cuts have been changed
+    const SelectionPlan& GetSelectionPlan() const {
+      if(!fSelectionPlanCompiled) const_cast<AliConversionMesonCuts*>(this)->CompileSelectionPlan();
+      return fSelectionPlan;
+    }
+    // every setter of a quantity read by the plan must call this
+    void    InvalidateSelectionPlan() {fSelectionPlanCompiled=kFALSE;}
     Int_t   fCuts[kNCuts];
     Bool_t  SetCut(cutIds cutID, Int_t cut);
     Bool_t  UpdateCutString();
@@ -183,6 +211,7 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
 
     Float_t FunctionMinMassCut(Float_t e);
     Float_t FunctionMaxMassCut(Float_t e);
+    Bool_t  MergedMassWindow(Float_t e, Float_t &massMin, Float_t &massMax) const;
 
     // Request Flags
     Bool_t   UseRotationMethod(){return fUseRotationMethodInBG;}
@@ -342,11 +371,13 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
     Bool_t      fDoGammaMinEnergyCut;           ///< if enabled, at least fNDaughterEnergyCut daughter contributing to neutral meson need to fulfill fMinSingleDaughterE
     Int_t       fNDaughterEnergyCut;            ///< if above is enabled, at least fNDaughterEnergyCut daughter contributing to neutral meson needs to fulfill fMinSingleDaughterE
     Float_t     fSingleDaughterMinE;            ///< if above is enabled, at least fNDaughterEnergyCut daughter contributing to neutral meson needs to fulfill fMinSingleDaughterE
+    SelectionPlan fSelectionPlan;               //!<! mass window compiled from fSelectionWindowCut
+    Bool_t      fSelectionPlanCompiled;         //!<! whether fSelectionPlan is up to date
 
   private:
 
     /// \cond CLASSIMP
-    ClassDef(AliConversionMesonCuts,45)
+    ClassDef(AliConversionMesonCuts,46)
     /// \endcond
 };
 
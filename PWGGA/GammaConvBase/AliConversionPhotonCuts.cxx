@@ -58,6 +58,7 @@
 #include "AliTRDTriggerAnalysis.h"
 #include "AliDalitzAODESDMC.h"
 #include "AliDalitzEventMC.h"
+#include <algorithm>
 
 class iostream;
 using std::cout;
@@ -267,7 +268,9 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   fBadRegionCMax(0),
   fBadRegionAMax(0),
   fExcludeMinR(180.),
-  fExcludeMaxR(250.)
+  fExcludeMaxR(250.),
+  fSelectionPlan(),
+  fSelectionPlanCompiled(kFALSE)
 {
   InitPIDResponse();
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
@@ -455,7 +458,9 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   fBadRegionCMax(ref.fBadRegionCMax),
   fBadRegionAMax(ref.fBadRegionAMax),
   fExcludeMinR(ref.fExcludeMinR),
-  fExcludeMaxR(ref.fExcludeMaxR)
+  fExcludeMaxR(ref.fExcludeMaxR),
+  fSelectionPlan(),
+  fSelectionPlanCompiled(kFALSE)
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -1218,8 +1223,10 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
   if(fHistoAsymmetrybefore){
     if(photon->GetPhotonP()!=0 && electronCandidate->P()!=0)fHistoAsymmetrybefore->Fill(photon->GetPhotonP(),electronCandidate->P()/photon->GetPhotonP());
   }
+  const SelectionPlan& plan = GetSelectionPlan();
+
   // Gamma selection based on QT from Armenteros
-  if(fDoQtGammaSelection == 1 || fDoQtGammaSelection == 2){
+  if(plan.fChecks & kPlanQt){
     if(!ArmenterosQtCut(photon)){
       if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //1
       return kFALSE;
@@ -1228,7 +1235,7 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
   cutIndex++; //2
 
   // Chi Cut
-  if(photon->GetChi2perNDF() > fChi2CutConversion || photon->GetChi2perNDF() <=0){
+  if(photon->GetChi2perNDF() > plan.fChi2Max || photon->GetChi2perNDF() <=0){
     {
       if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //2
       return kFALSE;
@@ -1244,7 +1251,7 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
 
   cutIndex++; //4
   // Asymmetry Cut
-  if(fDoPhotonAsymmetryCut == kTRUE){
+  if(plan.fChecks & kPlanAsymmetry){
     if(!AsymmetryCut(photon,event)){
       if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //4
       return kFALSE;
@@ -1290,13 +1297,13 @@ Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVE
     photonAOD->CalculateDistanceOfClossetApproachToPrimVtx(event->GetPrimaryVertex());
 
     cutIndex++; //9
-    if(photonAOD->GetDCArToPrimVtx() > fDCARPrimVtxCut) { //DCA R cut of photon to primary vertex
+    if(photonAOD->GetDCArToPrimVtx() > plan.fDCARMax) { //DCA R cut of photon to primary vertex
       if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //9
       return kFALSE;
     }
 
     cutIndex++; //10
-    if(TMath::Abs(photonAOD->GetDCAzToPrimVtx()) > fDCAZPrimVtxCut) { //DCA Z cut of photon to primary vertex
+    if(TMath::Abs(photonAOD->GetDCAzToPrimVtx()) > plan.fDCAZMax) { //DCA Z cut of photon to primary vertex
       if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //10
       return kFALSE;
     }
@@ -1518,31 +1525,26 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::ArmenterosQtCut(AliConversionPhotonBase *photon){   // Armenteros Qt Cut
-  if(fDo2DQt){
-    if(fDoQtGammaSelection==1){
-      if ( !(TMath::Power(photon->GetArmenterosAlpha()/fMaxPhotonAsymmetry,2)+TMath::Power(photon->GetArmenterosQt()/fQtMax,2) < 1) ){
-        return kFALSE;
-      }
-    } else if(fDoQtGammaSelection==2){
-      Float_t qtMaxPtDep = fQtPtMax*photon->GetPhotonPt();
-      if (qtMaxPtDep > fQtMax)
-        qtMaxPtDep      = fQtMax;
-      if ( !(TMath::Power(photon->GetArmenterosAlpha()/fMaxPhotonAsymmetry,2)+TMath::Power(photon->GetArmenterosQt()/qtMaxPtDep,2) < 1) ){
-        return kFALSE;
-      }
+  const SelectionPlan& plan = GetSelectionPlan();
+  if(!(plan.fChecks & kPlanQt)) return kTRUE;
+
+  Double_t qtMax = plan.fQtMax;
+  if(plan.fChecks & kPlanQtPtDep){
+    Float_t qtMaxPtDep = plan.fQtPtMax*photon->GetPhotonPt();
+    if (qtMaxPtDep > plan.fQtMax)
+      qtMaxPtDep      = plan.fQtMax;
+    qtMax = qtMaxPtDep;
+  }
+
+  if(plan.fChecks & kPlanQt2D){
+    Double_t alphaNorm = photon->GetArmenterosAlpha()/plan.fMaxPhotonAsymmetry;
+    Double_t qtNorm    = photon->GetArmenterosQt()/qtMax;
+    if ( !(alphaNorm*alphaNorm+qtNorm*qtNorm < 1) ){
+      return kFALSE;
     }
   } else {
-    if(fDoQtGammaSelection==1){
-      if(photon->GetArmenterosQt()>fQtMax){
-        return kFALSE;
-      }
-    } else if(fDoQtGammaSelection==2){
-      Float_t qtMaxPtDep = fQtPtMax*photon->GetPhotonPt();
-      if (qtMaxPtDep > fQtMax)
-        qtMaxPtDep      = fQtMax;
-      if(photon->GetArmenterosQt()>qtMaxPtDep){
-        return kFALSE;
-      }
+    if(photon->GetArmenterosQt()>qtMax){
+      return kFALSE;
     }
   }
   return kTRUE;
@@ -1553,151 +1555,125 @@ Bool_t AliConversionPhotonCuts::ArmenterosQtCut(AliConversionPhotonBase *photon)
 Bool_t AliConversionPhotonCuts::AcceptanceCuts(AliConversionPhotonBase *photon) {
   // Exclude certain areas for photon reconstruction
 
+  const SelectionPlan& plan = GetSelectionPlan();
+  Double_t photonPt  = photon->GetPhotonPt();
+  Double_t photonEta = photon->GetPhotonEta();
+  Double_t convR     = photon->GetConversionRadius();
+  Double_t absConvZ  = TMath::Abs(photon->GetConversionZ());
+
   Int_t cutIndex=0;
-  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
   cutIndex++;
 
-  if(photon->GetConversionRadius()>fMaxR){ // cuts on distance from collision point
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(convR>plan.fMaxR){ // cuts on distance from collision point
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
   cutIndex++;
 
-  if(photon->GetConversionRadius()<fMinR){ // cuts on distance from collision point
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(convR<plan.fMinR){ // cuts on distance from collision point
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
   cutIndex++;
 
-  if(photon->GetConversionRadius()>fExcludeMinR && photon->GetConversionRadius()<fExcludeMaxR ){ // cuts on distance from collision point
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(convR>plan.fExcludeMinR && convR<plan.fExcludeMaxR ){ // cuts on distance from collision point
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
   cutIndex++;
 
 
-  if(photon->GetConversionRadius() <= ((TMath::Abs(photon->GetConversionZ())*fLineCutZRSlope)-fLineCutZValue)){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(convR <= ((absConvZ*plan.fLineSlope)-plan.fLineZ)){
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
-  else if (fUseEtaMinCut &&  photon->GetConversionRadius() >= ((TMath::Abs(photon->GetConversionZ())*fLineCutZRSlopeMin)-fLineCutZValueMin )){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  else if ((plan.fChecks & kPlanLineCutMin) &&  convR >= ((absConvZ*plan.fLineSlopeMin)-plan.fLineZMin )){
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
   cutIndex++;
 
-  if(TMath::Abs(photon->GetConversionZ()) > fMaxZ ){ // cuts out regions where we do not reconstruct
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(absConvZ > plan.fMaxZ ){ // cuts out regions where we do not reconstruct
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
   cutIndex++;
 
 
-  if( photon->GetPhotonEta() > (fEtaCut)    || photon->GetPhotonEta() < (-fEtaCut) ){
-    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if( photonEta > (plan.fEtaMax)    || photonEta < (-plan.fEtaMax) ){
+    if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
     return kFALSE;
   }
-  if(fEtaCutMin>-0.1){
-    if( photon->GetPhotonEta() < (fEtaCutMin) && photon->GetPhotonEta() > (-fEtaCutMin) ){
-      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(plan.fChecks & kPlanEtaMin){
+    if( photonEta < (plan.fEtaMin) && photonEta > (-plan.fEtaMin) ){
+      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
       return kFALSE;
     }
   }
   cutIndex++;
 
-  if (fDoShrinkTPCAcceptance == 1){
-    if(photon->GetPhotonEta() > fEtaForPhiCutMin && photon->GetPhotonEta() < fEtaForPhiCutMax ){
-      if (fMinPhiCut < fMaxPhiCut){
-        if( photon->GetPhotonPhi() > fMinPhiCut && photon->GetPhotonPhi() < fMaxPhiCut ) {
-          if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if (plan.fShrinkTPCAcceptance == 1){
+    if(photonEta > plan.fEtaForPhiMin && photonEta < plan.fEtaForPhiMax ){
+      Double_t photonPhi = photon->GetPhotonPhi();
+      if (plan.fPhiMin < plan.fPhiMax){
+        if( photonPhi > plan.fPhiMin && photonPhi < plan.fPhiMax ) {
+          if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
           return kFALSE;
         }
       } else {
-        Double_t photonPhi = photon->GetPhotonPhi();
-        if (photon->GetPhotonPhi() < TMath::Pi()) photonPhi = photon->GetPhotonPhi() + 2*TMath::Pi();
-        if( photonPhi > fMinPhiCut && photonPhi < fMaxPhiCut+2*TMath::Pi() ) {
-          if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+        if (photonPhi < TMath::Pi()) photonPhi = photonPhi + 2*TMath::Pi();
+        if( photonPhi > plan.fPhiMin && photonPhi < plan.fPhiMax+2*TMath::Pi() ) {
+          if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
           return kFALSE;
         }
       }
     }
-  } else if (fDoShrinkTPCAcceptance == 2){  // accept only photons in 'good region'
-      Double_t photonPhi = photon->GetPhotonPhi();
-      GetPhiRegions();
-      if( photon->GetPhotonEta()>0 && photon->GetPhotonEta()<fEtaCut ){        // A side
-          //cout << "A side, eta=" << photon->GetPhotonEta() <<  endl;
-          if(!(photonPhi>fGoodRegionAMin && photonPhi<fGoodRegionAMax)){
-              //cout  << "photonPhi=" << photonPhi << " excluded" << endl;
-              if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
-              return kFALSE;
-          } //else  cout  << "photonPhi=" << photonPhi << " accepted" << endl;
-      } else if(photon->GetPhotonEta()<0 && photon->GetPhotonEta()>-fEtaCut){  // C side
-          //cout << "C side, eta=" << photon->GetPhotonEta() <<  endl;
-          if (!(photonPhi>fGoodRegionCMin && photonPhi<fGoodRegionCMax)){
-              //cout  << "photonPhi=" << photonPhi << " excluded" << endl;
-              if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
-              return kFALSE;
-          } //else  cout  << "photonPhi=" << photonPhi << " accepted" << endl;
+  } else if (plan.fShrinkTPCAcceptance == 2 || plan.fShrinkTPCAcceptance == 3){
+    // accept only photons in the 'good' (2) or 'bad' (3) region, see GetPhiRegions
+    Double_t photonPhi = photon->GetPhotonPhi();
+    if( photonEta>0 && photonEta<plan.fEtaMax ){        // A side
+      if(!(photonPhi>plan.fPhiRegionAMin && photonPhi<plan.fPhiRegionAMax)){
+        if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
+        return kFALSE;
       }
-  } else if (fDoShrinkTPCAcceptance == 3){   // accept only photons in 'bad region'
-      Double_t photonPhi = photon->GetPhotonPhi();
-      GetPhiRegions();
-      if( photon->GetPhotonEta()>0 && photon->GetPhotonEta()<fEtaCut ){        // A side
-          //cout << "A side, eta=" << photon->GetPhotonEta() <<  endl;
-          if(!(photonPhi>fBadRegionAMin && photonPhi<fBadRegionAMax)){
-              //cout  << "photonPhi=" << photonPhi << " excluded" << endl;
-              if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
-              return kFALSE;
-          } // else cout  << "photonPhi=" << photonPhi << " accepted" << endl;
-      } else if(photon->GetPhotonEta()<0 && photon->GetPhotonEta()>-fEtaCut){  // C side
-          //cout << "C side, eta=" << photon->GetPhotonEta() <<  endl;
-          if (!(photonPhi>fBadRegionCMin && photonPhi<fBadRegionCMax)){
-              //cout  << "photonPhi=" << photonPhi << " excluded" << endl;
-              if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
-              return kFALSE;
-          } // else cout  << "photonPhi=" << photonPhi << " accepted" << endl;
+    } else if(photonEta<0 && photonEta>-plan.fEtaMax){  // C side
+      if (!(photonPhi>plan.fPhiRegionCMin && photonPhi<plan.fPhiRegionCMax)){
+        if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
+        return kFALSE;
       }
-
-  } else if (fDoShrinkTPCAcceptance == 4){   // accept only photons in eta-phi region from PHOS-PCM (pi0 and eta meson analysis)
+    }
+  } else if (plan.fShrinkTPCAcceptance == 4){   // accept only photons in eta-phi region from PHOS-PCM (pi0 and eta meson analysis)
     Double_t photonPhi = photon->GetPhotonPhi();
 
-    if(photon->GetPhotonEta() > fEtaForPhiCutMin && photon->GetPhotonEta() < fEtaForPhiCutMax ){
-      //cout << "A and C side, eta=" << photon->GetPhotonEta() <<  endl;
-      if(!(photonPhi>fMinPhiCut  && photonPhi<fMaxPhiCut )){
+    if(photonEta > plan.fEtaForPhiMin && photonEta < plan.fEtaForPhiMax ){
+      if(!(photonPhi>plan.fPhiMin  && photonPhi<plan.fPhiMax )){
 	cout  << "photonPhi=" << photonPhi << " excluded" << endl;
-	if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+	if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
 	return kFALSE;
-      } // else cout  << "photonPhi=" << photonPhi << " accepted" << endl;
+      }
     }
   }
   cutIndex++;
 
 
-  if(!fDoRDepPtCut) {
-    if(photon->GetPhotonPt()<fPtCut){
-      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(!(plan.fChecks & kPlanRDepPt)) {
+    if(photonPt<plan.fPtMin){
+      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
       return kFALSE;
     }
   }else{
-    for(Int_t ii=0;ii<fRArraySize-1;ii++){
-      if (photon->GetConversionRadius() >= fRArray[ii] && photon->GetConversionRadius() < fRArray[ii+1] ){
-	if(photon->GetPhotonPt()<fRDepPtCutArray[ii]){
-	  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
-	  return kFALSE;
-	}
-      }
-    }
-    if (photon->GetConversionRadius() >= fRArray[fRArraySize-1] ){
-      if(photon->GetPhotonPt()<fPtCut){
-	if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
-	return kFALSE;
-      }
+    // index of the radius bin : number of edges below or at the conversion radius
+    Int_t iR = std::upper_bound(plan.fRDepEdges.begin(),plan.fRDepEdges.end(),convR) - plan.fRDepEdges.begin();
+    if(iR > 0 && photonPt<plan.fRDepPtMin[iR]){
+      if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
+      return kFALSE;
     }
   }
 
   cutIndex++;
 
-  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photon->GetPhotonPt());
+  if(fHistoAcceptanceCuts)fHistoAcceptanceCuts->Fill(cutIndex, photonPt);
 
   return kTRUE;
 }
@@ -1979,95 +1955,78 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
   if(!fPIDResponse){InitPIDResponse();}// Try to reinitialize PID Response
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
 
+  const SelectionPlan& plan = GetSelectionPlan();
+
   Short_t Charge    = fCurrentTrack->Charge();
+  Double_t trackP   = fCurrentTrack->P();
+  Double_t trackPt  = fCurrentTrack->Pt();
   Double_t electronNSigmaTPC = fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron);
   Double_t electronNSigmaTPCCor=0.;
-  Double_t P=0.;
   Double_t Eta=0.;
 
-  if(fDoElecDeDxPostCalibration){
-    P = fCurrentTrack->P();
+  if(plan.fChecks & kPlandEdxPostCalib){
     Eta = fCurrentTrack->Eta();
-    electronNSigmaTPCCor = GetCorrectedElectronTPCResponse(Charge,electronNSigmaTPC,P,Eta,fCurrentTrack->GetTPCNcls(),photon->GetConversionRadius());
+    electronNSigmaTPCCor = GetCorrectedElectronTPCResponse(Charge,electronNSigmaTPC,trackP,Eta,fCurrentTrack->GetTPCNcls(),photon->GetConversionRadius());
   }
+  // electron nsigma the lines are applied to
+  Double_t electronNSigma = (plan.fChecks & kPlandEdxPostCalib) ? electronNSigmaTPCCor : electronNSigmaTPC;
 
   Int_t cutIndex=0;
-  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-  if(fHistoTPCdEdxSigbefore)fHistoTPCdEdxSigbefore->Fill(fCurrentTrack->P(), electronNSigmaTPC);
-  if(fHistoTPCdEdxbefore)fHistoTPCdEdxbefore->Fill(fCurrentTrack->P(),fCurrentTrack->GetTPCsignal());
+  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
+  if(fHistoTPCdEdxSigbefore)fHistoTPCdEdxSigbefore->Fill(trackP, electronNSigmaTPC);
+  if(fHistoTPCdEdxbefore)fHistoTPCdEdxbefore->Fill(trackP,fCurrentTrack->GetTPCsignal());
   cutIndex++; //1
-  if(fDodEdxSigmaCut == kTRUE && !fSwitchToKappa){
+  if(plan.fChecks & kPlanTPCdEdx){
     // TPC Electron Line
-    if(fDoElecDeDxPostCalibration){
-      if( electronNSigmaTPCCor < fPIDnSigmaBelowElectronLine ||  electronNSigmaTPCCor >fPIDnSigmaAboveElectronLine ){
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-        return kFALSE;
-      }
-    } else{
-      if( electronNSigmaTPC < fPIDnSigmaBelowElectronLine || electronNSigmaTPC > fPIDnSigmaAboveElectronLine){
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-        return kFALSE;
-      }
+    if( electronNSigma < plan.fElecLineBelow || electronNSigma > plan.fElecLineAbove){
+      if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
+      return kFALSE;
     }
     cutIndex++; //2
     // TPC Pion Line
-    if( fCurrentTrack->P()>fPIDMinPnSigmaAbovePionLine && fCurrentTrack->P()<fPIDMaxPnSigmaAbovePionLine ){
-      if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
-          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-          return kFALSE;
-        }
-      } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
-          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-          return kFALSE;
-        }
+    if( trackP>plan.fPionLinePMin && trackP<plan.fPionLinePMax ){
+      if( electronNSigma > plan.fElecLineBelow && electronNSigma < plan.fElecLineAbove && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<plan.fPionLineAbove){
+        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
+        return kFALSE;
       }
     }
     cutIndex++; //3
 
     // High Pt Pion rej
-    if( fCurrentTrack->P()>fPIDMaxPnSigmaAbovePionLine ){
-      if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
-          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-          return kFALSE;
-        }
-      } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
-          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-          return kFALSE;
-        }
+    if( trackP>plan.fPionLinePMax ){
+      if( electronNSigma > plan.fElecLineBelow && electronNSigma < plan.fElecLineAbove && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<plan.fPionLineAboveHighPt){
+        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
+        return kFALSE;
       }
     }
     cutIndex++; //4
   }
   else{cutIndex+=3;} //4
 
-  if(fDoKaonRejectionLowP == kTRUE && !fSwitchToKappa){
-    if(fCurrentTrack->P()<fPIDMinPKaonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  if(plan.fChecks & kPlanKaonRejLowP){
+    if(trackP<plan.fKaonRejPMax ){
+      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<plan.fKaonRejNSigma){
+        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
         return kFALSE;
       }
     }
   }
   cutIndex++; //5
 
-  if(fDoProtonRejectionLowP == kTRUE && !fSwitchToKappa){
-    if( fCurrentTrack->P()<fPIDMinPProtonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  if(plan.fChecks & kPlanProtonRejLowP){
+    if( trackP<plan.fProtonRejPMax ){
+      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<plan.fProtonRejNSigma){
+        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
         return kFALSE;
       }
     }
   }
   cutIndex++; //6
 
-  if(fDoPionRejectionLowP == kTRUE && !fSwitchToKappa){
-    if( fCurrentTrack->P()<fPIDMinPPionRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
-        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  if(plan.fChecks & kPlanPionRejLowP){
+    if( trackP<plan.fPionRejPMax ){
+      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<plan.fPionRejNSigma){
+        if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
         return kFALSE;
       }
     }
@@ -2076,60 +2035,61 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   //  if((fCurrentTrack->GetStatus() & AliESDtrack::kTOFpid ) && !(fCurrentTrack->GetStatus() & AliESDtrack::kTOFmismatch)){
   // check for TOF signal: AliVTrack::kTOFout means that a tof signal is matched, AliVTrack::kTIME means that the track length (and then the expected times) was extrapolated properly
-  if((fCurrentTrack->GetStatus() & AliVTrack::kTOFout ) && (fCurrentTrack->GetStatus() & AliVTrack::kTIME)){
+  ULong_t status = fCurrentTrack->GetStatus();
+  if((status & AliVTrack::kTOFout ) && (status & AliVTrack::kTIME)){
     if(fHistoTOFbefore){
-      Double_t t0 = fPIDResponse->GetTOFResponse().GetStartTime(fCurrentTrack->P());
+      Double_t t0 = fPIDResponse->GetTOFResponse().GetStartTime(trackP);
       Double_t  times[AliPID::kSPECIESC];
       fCurrentTrack->GetIntegratedTimes(times,AliPID::kSPECIESC);
       Double_t TOFsignal = fCurrentTrack->GetTOFsignal();
       Double_t dT = TOFsignal - t0 - times[0];
-      fHistoTOFbefore->Fill(fCurrentTrack->P(),dT);
+      fHistoTOFbefore->Fill(trackP,dT);
     }
-    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
-    if(fUseTOFpid){
-        if(!fUseTOFpidMomRange || (fUseTOFpidMomRange && fCurrentTrack->Pt() > fTofPIDMinMom && fCurrentTrack->Pt() < fTofPIDMaxMom)){
-            if(fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
-               fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
-                if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-                return kFALSE;
-            }
+    Bool_t applyTOF = (plan.fChecks & kPlanTOF) &&
+                      (!(plan.fChecks & kPlanTOFMomRange) || (trackPt > plan.fTOFPtMin && trackPt < plan.fTOFPtMax));
+    if(fHistoTOFSigbefore || fHistoTOFSigafter || applyTOF){
+      Double_t electronNSigmaTOF = fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron);
+      if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(trackP,electronNSigmaTOF);
+      if(applyTOF){
+        if(electronNSigmaTOF>plan.fTOFAbove || electronNSigmaTOF<plan.fTOFBelow ){
+          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
+          return kFALSE;
         }
+      }
+      if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(trackP,electronNSigmaTOF);
     }
-    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
   }
   cutIndex++; //8
 
-  if((fCurrentTrack->GetStatus() & AliESDtrack::kITSpid)){
-    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
-    if(fUseITSpid){
-      if(fCurrentTrack->Pt()<=fMaxPtPIDITS){
-        if(fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
-          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  if((status & AliESDtrack::kITSpid)){
+    Bool_t applyITS = (plan.fChecks & kPlanITS) && trackPt<=plan.fITSPtMax;
+    if(fHistoITSSigbefore || fHistoITSSigafter || applyITS){
+      Double_t electronNSigmaITS = fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron);
+      if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(trackP,electronNSigmaITS);
+      if(applyITS){
+        if(electronNSigmaITS>plan.fITSAbove || electronNSigmaITS<plan.fITSBelow ){
+          if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
           return kFALSE;
         }
       }
+      if(fHistoITSSigafter)fHistoITSSigafter->Fill(trackP,electronNSigmaITS);
     }
-    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
   }
 
   cutIndex++; //9
 
   // Apply TRD PID
-  if(fDoTRDPID){
-    if(!fPIDResponse->IdentifiedAsElectronTRD(fCurrentTrack,fPIDTRDEfficiency)){
-      if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
+  if(plan.fChecks & kPlanTRD){
+    if(!fPIDResponse->IdentifiedAsElectronTRD(fCurrentTrack,plan.fTRDEfficiency)){
+      if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
       return kFALSE;
     }
   }
   cutIndex++; //10
 
-  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
-  if(fDoElecDeDxPostCalibration){
-    if(fHistoTPCdEdxSigafter)fHistoTPCdEdxSigafter->Fill(fCurrentTrack->P(),electronNSigmaTPCCor);
-  }else{
-    if(fHistoTPCdEdxSigafter)fHistoTPCdEdxSigafter->Fill(fCurrentTrack->P(),electronNSigmaTPC);
-  }
-  if(fHistoTPCdEdxafter)fHistoTPCdEdxafter->Fill(fCurrentTrack->P(),fCurrentTrack->GetTPCsignal());
+  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,trackPt);
+  if(fHistoTPCdEdxSigafter)fHistoTPCdEdxSigafter->Fill(trackP,electronNSigma);
+  if(fHistoTPCdEdxafter)fHistoTPCdEdxafter->Fill(trackP,fCurrentTrack->GetTPCsignal());
 
   return kTRUE;
 }
@@ -2149,28 +2109,40 @@ Bool_t AliConversionPhotonCuts::KappaCuts(AliConversionPhotonBase * photon,AliVE
 Bool_t AliConversionPhotonCuts::AsymmetryCut(AliConversionPhotonBase * photon,AliVEvent *event) {
   // Cut on Energy Asymmetry
 
+  const SelectionPlan& plan = GetSelectionPlan();
+  Double_t photonP = photon->GetPhotonP();
+
+  // the asymmetry limits only depend on the photon momentum
+  Double_t asymMax = plan.fAsymMax;
+  Double_t asymMin = plan.fAsymMin;
+  if(plan.fChecks & kPlanAsymmetryPDep){
+    asymMax = fFAsymmetryCut->Eval(photonP);
+    asymMin = 1.-asymMax;
+  }
+
   for(Int_t ii=0;ii<2;ii++){
 
     AliVTrack *track=GetTrack(event,photon->GetTrackLabel(ii));
+    Double_t trackP = track->P();
 
-    if(fDoPhotonPDependentAsymCut){
+    if(plan.fChecks & kPlanAsymmetryPDep){
       Double_t trackNegAsy=0;
-      if (photon->GetPhotonP()!=0.){
-          trackNegAsy= track->P()/photon->GetPhotonP();
+      if (photonP!=0.){
+          trackNegAsy= trackP/photonP;
       }
 
-      if( trackNegAsy > fFAsymmetryCut->Eval(photon->GetPhotonP()) || trackNegAsy < 1.-fFAsymmetryCut->Eval(photon->GetPhotonP()) ){
+      if( trackNegAsy > asymMax || trackNegAsy < asymMin ){
         return kFALSE;
       }
 
     } else {
-      if( track->P() > fMinPPhotonAsymmetryCut ){
+      if( trackP > plan.fAsymMinP ){
         Double_t trackNegAsy=0;
-        if (photon->GetPhotonP()!=0.){
-          trackNegAsy= track->P()/photon->GetPhotonP();
+        if (photonP!=0.){
+          trackNegAsy= trackP/photonP;
         }
 
-        if( trackNegAsy<fMinPhotonAsymmetry ||trackNegAsy>(1.- fMinPhotonAsymmetry)){
+        if( trackNegAsy<asymMin ||trackNegAsy>asymMax){
           return kFALSE;
         }
       }
@@ -2381,13 +2353,124 @@ Bool_t AliConversionPhotonCuts::InitializeCutsFromCutString(const TString analys
   }
 
   PrintCutsWithValues();
+  CompileSelectionPlan();
 
   return kTRUE;
 }
+
+///________________________________________________________________________
+void AliConversionPhotonCuts::CompileSelectionPlan(){
+  // Turn the cut values set from the cut string into the flat selection plan
+  // evaluated in PhotonCuts, AcceptanceCuts, ArmenterosQtCut, AsymmetryCut,
+  // PsiPairCut, CosinePAngleCut and dEdxCuts
+
+  SelectionPlan &plan = fSelectionPlan;
+  plan.fChecks = 0;
+
+  if(fDoQtGammaSelection == 1 || fDoQtGammaSelection == 2) plan.fChecks |= kPlanQt;
+  if(fDoQtGammaSelection == 2) plan.fChecks |= kPlanQtPtDep;
+  if(fDo2DQt) plan.fChecks |= kPlanQt2D;
+  plan.fQtMax               = fQtMax;
+  plan.fQtPtMax             = fQtPtMax;
+  plan.fMaxPhotonAsymmetry  = fMaxPhotonAsymmetry;
+  plan.fChi2Max             = fChi2CutConversion;
+
+  plan.fPsiPairMode         = (fDo2DPsiPairChi2 == 1 || fDo2DPsiPairChi2 == 2) ? fDo2DPsiPairChi2 : 0;
+  if(fIncludeRejectedPsiPair) plan.fChecks |= kPlanPsiPairInclRejected;
+  plan.fPsiPairMax          = fPsiPairCut;
+  plan.fPsiPairChi2Slope    = -fPsiPairCut/fChi2CutConversion;
+  plan.fPsiPairChi2Exp      = fChi2CutConversionExpFunc;
+  plan.fCosPAngleMin        = fCosPAngleCut;
+  plan.fDCARMax             = fDCARPrimVtxCut;
+  plan.fDCAZMax             = fDCAZPrimVtxCut;
+
+  if(fDoPhotonAsymmetryCut == kTRUE) plan.fChecks |= kPlanAsymmetry;
+  if(fDoPhotonPDependentAsymCut && fFAsymmetryCut) plan.fChecks |= kPlanAsymmetryPDep;
+  plan.fAsymMinP            = fMinPPhotonAsymmetryCut;
+  plan.fAsymMin             = fMinPhotonAsymmetry;
+  plan.fAsymMax             = 1.- fMinPhotonAsymmetry;
+
+  // acceptance
+  plan.fMaxR                = fMaxR;
+  plan.fMinR                = fMinR;
+  plan.fExcludeMinR         = fExcludeMinR;
+  plan.fExcludeMaxR         = fExcludeMaxR;
+  plan.fLineSlope           = fLineCutZRSlope;
+  plan.fLineZ               = fLineCutZValue;
+  if(fUseEtaMinCut) plan.fChecks |= kPlanLineCutMin;
+  plan.fLineSlopeMin        = fLineCutZRSlopeMin;
+  plan.fLineZMin            = fLineCutZValueMin;
+  plan.fMaxZ                = fMaxZ;
+  plan.fEtaMax              = fEtaCut;
+  if(fEtaCutMin>-0.1) plan.fChecks |= kPlanEtaMin;
+  plan.fEtaMin              = fEtaCutMin;
+  plan.fShrinkTPCAcceptance = fDoShrinkTPCAcceptance;
+  plan.fEtaForPhiMin        = fEtaForPhiCutMin;
+  plan.fEtaForPhiMax        = fEtaForPhiCutMax;
+  plan.fPhiMin              = fMinPhiCut;
+  plan.fPhiMax              = fMaxPhiCut;
+  GetPhiRegions();
+  if(fDoShrinkTPCAcceptance == 3){
+    plan.fPhiRegionAMin = fBadRegionAMin;  plan.fPhiRegionAMax = fBadRegionAMax;
+    plan.fPhiRegionCMin = fBadRegionCMin;  plan.fPhiRegionCMax = fBadRegionCMax;
+  } else {
+    plan.fPhiRegionAMin = fGoodRegionAMin; plan.fPhiRegionAMax = fGoodRegionAMax;
+    plan.fPhiRegionCMin = fGoodRegionCMin; plan.fPhiRegionCMax = fGoodRegionCMax;
+  }
+
+  // pt cut, as table of the pt cut vs conversion radius if R dependent:
+  // below the first edge no cut is applied, above the last one fPtCut
+  plan.fPtMin = fPtCut;
+  plan.fRDepEdges.clear();
+  plan.fRDepPtMin.clear();
+  if(fDoRDepPtCut && fRArraySize > 0 && fRArray && fRDepPtCutArray){
+    plan.fChecks |= kPlanRDepPt;
+    plan.fRDepEdges.assign(fRArray,fRArray+fRArraySize);
+    plan.fRDepPtMin.push_back(0.);
+    for(Int_t ii=0;ii<fRArraySize-1;ii++) plan.fRDepPtMin.push_back(fRDepPtCutArray[ii]);
+    plan.fRDepPtMin.push_back(fPtCut);
+  }
+
+  // PID
+  if(fDodEdxSigmaCut == kTRUE && !fSwitchToKappa) plan.fChecks |= kPlanTPCdEdx;
+  if(fDoElecDeDxPostCalibration) plan.fChecks |= kPlandEdxPostCalib;
+  if(fDoKaonRejectionLowP == kTRUE && !fSwitchToKappa) plan.fChecks |= kPlanKaonRejLowP;
+  if(fDoProtonRejectionLowP == kTRUE && !fSwitchToKappa) plan.fChecks |= kPlanProtonRejLowP;
+  if(fDoPionRejectionLowP == kTRUE && !fSwitchToKappa) plan.fChecks |= kPlanPionRejLowP;
+  if(fUseTOFpid) plan.fChecks |= kPlanTOF;
+  if(fUseTOFpidMomRange) plan.fChecks |= kPlanTOFMomRange;
+  if(fUseITSpid) plan.fChecks |= kPlanITS;
+  if(fDoTRDPID) plan.fChecks |= kPlanTRD;
+  plan.fElecLineBelow       = fPIDnSigmaBelowElectronLine;
+  plan.fElecLineAbove       = fPIDnSigmaAboveElectronLine;
+  plan.fPionLinePMin        = fPIDMinPnSigmaAbovePionLine;
+  plan.fPionLinePMax        = fPIDMaxPnSigmaAbovePionLine;
+  plan.fPionLineAbove       = fPIDnSigmaAbovePionLine;
+  plan.fPionLineAboveHighPt = fPIDnSigmaAbovePionLineHighPt;
+  plan.fKaonRejPMax         = fPIDMinPKaonRejectionLowP;
+  plan.fKaonRejNSigma       = fPIDnSigmaAtLowPAroundKaonLine;
+  plan.fProtonRejPMax       = fPIDMinPProtonRejectionLowP;
+  plan.fProtonRejNSigma     = fPIDnSigmaAtLowPAroundProtonLine;
+  plan.fPionRejPMax         = fPIDMinPPionRejectionLowP;
+  plan.fPionRejNSigma       = fPIDnSigmaAtLowPAroundPionLine;
+  plan.fTOFPtMin            = fTofPIDMinMom;
+  plan.fTOFPtMax            = fTofPIDMaxMom;
+  plan.fTOFAbove            = fTofPIDnSigmaAboveElectronLine;
+  plan.fTOFBelow            = fTofPIDnSigmaBelowElectronLine;
+  plan.fITSPtMax            = fMaxPtPIDITS;
+  plan.fITSAbove            = fITSPIDnSigmaAboveElectronLine;
+  plan.fITSBelow            = fITSPIDnSigmaBelowElectronLine;
+  plan.fTRDEfficiency       = fPIDTRDEfficiency;
+
+  fSelectionPlanCompiled = kTRUE;
+}
+
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetCut(cutIds cutID, const Int_t value) {
   ///Set individual cut ID
 
+  InvalidateSelectionPlan();
+
   switch (cutID) {
 
     case kv0FinderType:
@@ -2686,6 +2769,7 @@ void AliConversionPhotonCuts::PrintCutsWithValues() {
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetV0Finder(Int_t v0FinderType){   // Set Cut
+  InvalidateSelectionPlan();
   switch (v0FinderType){
   case 0:  // on fly V0 finder
     cout << "have chosen onfly V0" << endl;
@@ -2722,6 +2806,7 @@ Bool_t AliConversionPhotonCuts::SetV0Finder(Int_t v0FinderType){   // Set Cut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetEtaCut(Int_t etaCut){   // Set Cut
+  InvalidateSelectionPlan();
 
   //Set Standard LineCutZValues
   fLineCutZValueMin = -2;
@@ -2843,6 +2928,7 @@ Bool_t AliConversionPhotonCuts::SetEtaCut(Int_t etaCut){   // Set Cut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetRCut(Int_t RCut){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(RCut){
   case 0:
@@ -3035,6 +3121,7 @@ Bool_t AliConversionPhotonCuts::SetRCut(Int_t RCut){
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetEtaForPhiCut(Int_t etaPhiCut) {
+  InvalidateSelectionPlan();
 
   switch(etaPhiCut) {
   case 0: //no specific eta range selected, full eta range
@@ -3068,6 +3155,7 @@ Bool_t AliConversionPhotonCuts::SetEtaForPhiCut(Int_t etaPhiCut) {
 ///________________________________________________________________________
 // This are exclusion cuts, everything between fMinPhiCut & fMaxPhiCut will be excluded
 Bool_t AliConversionPhotonCuts::SetMinPhiSectorCut(Int_t minPhiCut) {
+  InvalidateSelectionPlan();
 
   switch(minPhiCut) {
   case 0:
@@ -3136,6 +3224,7 @@ Bool_t AliConversionPhotonCuts::SetMinPhiSectorCut(Int_t minPhiCut) {
 ///________________________________________________________________________
 // This are exclusion cuts, everything between fMinPhiCut & fMaxPhiCut will be excluded
 Bool_t AliConversionPhotonCuts::SetMaxPhiSectorCut(Int_t maxPhiCut) {
+  InvalidateSelectionPlan();
 
   switch(maxPhiCut) {
   case 0:
@@ -3205,6 +3294,7 @@ Bool_t AliConversionPhotonCuts::SetMaxPhiSectorCut(Int_t maxPhiCut) {
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetSinglePtCut(Int_t singlePtCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(singlePtCut){
   case 0: // 0.050 GeV + min gamma pT cut of 20 MeV
     fSinglePtCut = 0.050;
@@ -3364,6 +3454,7 @@ Bool_t AliConversionPhotonCuts::SetSinglePtCut(Int_t singlePtCut){   // Set Cut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetTPCClusterCut(Int_t clsTPCCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(clsTPCCut){
   case 0: // 0
     fMinClsTPC= 0.;
@@ -3425,6 +3516,7 @@ Bool_t AliConversionPhotonCuts::SetTPCClusterCut(Int_t clsTPCCut){   // Set Cut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetTPCdEdxCutElectronLine(Int_t ededxSigmaCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(ededxSigmaCut){
   case 0: // -10,10
     fPIDnSigmaBelowElectronLine=-10;
@@ -3508,6 +3600,7 @@ Bool_t AliConversionPhotonCuts::SetTPCdEdxCutElectronLine(Int_t ededxSigmaCut){
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetTPCdEdxCutPionLine(Int_t pidedxSigmaCut){   // Set Cut
+  InvalidateSelectionPlan();
 
   switch(pidedxSigmaCut){
   case 0:  // -10
@@ -3567,6 +3660,7 @@ Bool_t AliConversionPhotonCuts::SetTPCdEdxCutPionLine(Int_t pidedxSigmaCut){   /
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetMinMomPiondEdxCut(Int_t piMomdedxSigmaCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(piMomdedxSigmaCut){
   case 0:  // 0.5 GeV
     fPIDMinPnSigmaAbovePionLine=0.5;
@@ -3604,6 +3698,7 @@ Bool_t AliConversionPhotonCuts::SetMinMomPiondEdxCut(Int_t piMomdedxSigmaCut){
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetMaxMomPiondEdxCut(Int_t piMaxMomdedxSigmaCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(piMaxMomdedxSigmaCut){
   case 0:  // 100. GeV
     fPIDMaxPnSigmaAbovePionLine=100.;
@@ -3638,6 +3733,7 @@ Bool_t AliConversionPhotonCuts::SetMaxMomPiondEdxCut(Int_t piMaxMomdedxSigmaCut)
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetLowPRejectionCuts(Int_t LowPRejectionSigmaCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(LowPRejectionSigmaCut){
   case 0:  //
     fPIDnSigmaAtLowPAroundKaonLine=0;
@@ -3729,6 +3825,7 @@ Bool_t AliConversionPhotonCuts::SetLowPRejectionCuts(Int_t LowPRejectionSigmaCut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetKappaTPCCut(Int_t kappaCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(kappaCut){
   case 0: // completely open
     fKappaMaxCut=200;
@@ -3773,6 +3870,7 @@ Bool_t AliConversionPhotonCuts::SetKappaTPCCut(Int_t kappaCut){   // Set Cut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetTOFElectronPIDCut(Int_t TOFelectronPID){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(TOFelectronPID){
   case 0: // no cut
@@ -3859,6 +3957,7 @@ Bool_t AliConversionPhotonCuts::SetTOFElectronPIDCut(Int_t TOFelectronPID){
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetITSElectronPIDCut(Int_t ITSelectronPID){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(ITSelectronPID){
   case 0: // no cut
@@ -3930,6 +4029,7 @@ Bool_t AliConversionPhotonCuts::SetITSElectronPIDCut(Int_t ITSelectronPID){
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetTRDElectronPIDCut(Int_t TRDelectronPID){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(TRDelectronPID){
   case 0: // no cut
@@ -3947,6 +4047,7 @@ Bool_t AliConversionPhotonCuts::SetTRDElectronPIDCut(Int_t TRDelectronPID){
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetQtMaxCut(Int_t QtMaxCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(QtMaxCut){
   case 0: //
     fQtMax=1.;
@@ -4070,6 +4171,7 @@ Bool_t AliConversionPhotonCuts::SetQtMaxCut(Int_t QtMaxCut){   // Set Cut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetChi2GammaCut(Int_t chi2GammaCut){   // Set Cut
+  InvalidateSelectionPlan();
 
   switch(chi2GammaCut){
   case 0: // 100
@@ -4166,6 +4268,7 @@ Bool_t AliConversionPhotonCuts::SetChi2GammaCut(Int_t chi2GammaCut){   // Set Cu
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetPsiPairCut(Int_t psiCut) {
+  InvalidateSelectionPlan();
   switch(psiCut) {
   case 0:
     fPsiPairCut = 10000; //
@@ -4254,6 +4357,7 @@ Bool_t AliConversionPhotonCuts::SetPsiPairCut(Int_t psiCut) {
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetPhotonAsymmetryCut(Int_t doPhotonAsymmetryCut){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(doPhotonAsymmetryCut){
   case 0:
@@ -4338,6 +4442,7 @@ Bool_t AliConversionPhotonCuts::SetPhotonAsymmetryCut(Int_t doPhotonAsymmetryCut
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetCosPAngleCut(Int_t cosCut) {
+  InvalidateSelectionPlan();
 
   switch(cosCut){
   case 0:
@@ -4398,6 +4503,7 @@ Bool_t AliConversionPhotonCuts::SetCosPAngleCut(Int_t cosCut) {
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetSharedElectronCut(Int_t sharedElec) {
+  InvalidateSelectionPlan();
 
     switch(sharedElec){
     case 0:
@@ -4474,6 +4580,7 @@ Bool_t AliConversionPhotonCuts::SetSharedElectronCut(Int_t sharedElec) {
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetToCloseV0sCut(Int_t toClose) {
+  InvalidateSelectionPlan();
 
   switch(toClose){
   case 0:
@@ -4520,6 +4627,7 @@ Bool_t AliConversionPhotonCuts::SetToCloseV0sCut(Int_t toClose) {
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetTRDElectronCut(Int_t TRDElectronCut){   // Set Cut
+  InvalidateSelectionPlan();
   switch(TRDElectronCut){
   case 0:
     fDoTRDPID=kFALSE;
@@ -4546,6 +4654,7 @@ Bool_t AliConversionPhotonCuts::SetTRDElectronCut(Int_t TRDElectronCut){   // Se
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetDCAZPhotonPrimVtxCut(Int_t DCAZPhotonPrimVtx){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(DCAZPhotonPrimVtx){
   case 0:  //
@@ -4587,6 +4696,7 @@ Bool_t AliConversionPhotonCuts::SetDCAZPhotonPrimVtxCut(Int_t DCAZPhotonPrimVtx)
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetDCARPhotonPrimVtxCut(Int_t DCARPhotonPrimVtx){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(DCARPhotonPrimVtx){
   case 0:  //
@@ -4628,6 +4738,7 @@ Bool_t AliConversionPhotonCuts::SetDCARPhotonPrimVtxCut(Int_t DCARPhotonPrimVtx)
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::SetInPlaneOutOfPlane(Int_t inOutPlane){
+  InvalidateSelectionPlan();
   // Set Cut
   switch(inOutPlane){
   case 0:  //
@@ -4687,7 +4798,7 @@ Int_t AliConversionPhotonCuts::GetFirstTPCRow(Double_t radius){
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::CosinePAngleCut(const AliConversionPhotonBase * photon, AliVEvent * event) const {
   ///Check if passes cosine of pointing angle cut
-  if(GetCosineOfPointingAngle(photon, event) < fCosPAngleCut){
+  if(GetCosineOfPointingAngle(photon, event) < GetSelectionPlan().fCosPAngleMin){
     return kFALSE;
   }
   return kTRUE;
@@ -4729,45 +4840,27 @@ Double_t AliConversionPhotonCuts::GetCosineOfPointingAngle( const AliConversionP
 
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::PsiPairCut(const AliConversionPhotonBase * photon) const {
-  if (fDo2DPsiPairChi2==1){
-    if(fIncludeRejectedPsiPair){
-      if (TMath::Abs(photon->GetPsiPair()) < -fPsiPairCut/fChi2CutConversion*photon->GetChi2perNDF() + fPsiPairCut || (photon->GetPsiPair()) == 4){
-        return kTRUE;
-      } else {
-        return kFALSE;
-      }
-
-    } else {
-      if (TMath::Abs(photon->GetPsiPair()) < -fPsiPairCut/fChi2CutConversion*photon->GetChi2perNDF() + fPsiPairCut ){
-        return kTRUE;
-      } else {
-        return kFALSE;
-      }
-    }
-  } else if (fDo2DPsiPairChi2==2){
-    if(fIncludeRejectedPsiPair){
-      if (TMath::Abs(photon->GetPsiPair()) < fPsiPairCut*TMath::Exp(fChi2CutConversionExpFunc*photon->GetChi2perNDF()) || (photon->GetPsiPair()) == 4){
-        return kTRUE;
-      } else {
-        return kFALSE;
-      }
-
+  const SelectionPlan& plan = GetSelectionPlan();
+  Float_t psiPair = photon->GetPsiPair();
+  Bool_t inclRejected = plan.fChecks & kPlanPsiPairInclRejected;
+
+  if (plan.fPsiPairMode==1 || plan.fPsiPairMode==2){
+    Double_t psiPairMax = (plan.fPsiPairMode==1) ? plan.fPsiPairChi2Slope*photon->GetChi2perNDF() + plan.fPsiPairMax
+                                                 : plan.fPsiPairMax*TMath::Exp(plan.fPsiPairChi2Exp*photon->GetChi2perNDF());
+    if (TMath::Abs(psiPair) < psiPairMax || (inclRejected && psiPair == 4)){
+      return kTRUE;
     } else {
-      if (TMath::Abs(photon->GetPsiPair()) < fPsiPairCut*TMath::Exp(fChi2CutConversionExpFunc*photon->GetChi2perNDF()) ){
-        return kTRUE;
-      } else {
-        return kFALSE;
-      }
+      return kFALSE;
     }
   } else {
-    if(fIncludeRejectedPsiPair){
-      if(TMath::Abs(photon->GetPsiPair()) > fPsiPairCut || (photon->GetPsiPair()) != 4){
+    if(inclRejected){
+      if(TMath::Abs(psiPair) > plan.fPsiPairMax || psiPair != 4){
         return kFALSE;
       } else {
         return kTRUE;
       }
     } else {
-      if(TMath::Abs(photon->GetPsiPair()) > fPsiPairCut){
+      if(TMath::Abs(psiPair) > plan.fPsiPairMax){
         return kFALSE;
       } else {
         return kTRUE;
@@ -18,6 +18,7 @@
 #include "AliAnalysisManager.h"
 #include "AliDalitzAODESDMC.h"
 #include "AliDalitzEventMC.h"
+#include <vector>
 
 
 class AliESDEvent;
@@ -126,7 +127,101 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     // todo: use unordered_map when found out how to make it work with ROOT5
     typedef std::map<AliAODConversionPhoton*, Bool_t> TMapPhotonBool;
 
+    /// checks enabled in the selection plan
+    enum selectionPlanChecks {
+      kPlanQt                 = BIT(0),   ///< Armenteros qt cut
+      kPlanQtPtDep            = BIT(1),   ///< qt maximum proportional to pt
+      kPlanQt2D               = BIT(2),   ///< elliptic cut in the Armenteros plane
+      kPlanAsymmetry          = BIT(3),   ///< energy asymmetry cut of the legs
+      kPlanAsymmetryPDep      = BIT(4),   ///< p dependent energy asymmetry cut
+      kPlanPsiPairInclRejected= BIT(5),   ///< keep V0s with psi pair = 4
+      kPlanEtaMin             = BIT(6),   ///< minimum |eta| cut
+      kPlanLineCutMin         = BIT(7),   ///< second line cut in the (z,R) plane
+      kPlanRDepPt             = BIT(8),   ///< conversion radius dependent pt cut
+      kPlanTPCdEdx            = BIT(9),   ///< TPC electron and pion lines
+      kPlandEdxPostCalib      = BIT(10),  ///< use post calibrated TPC electron nsigma
+      kPlanKaonRejLowP        = BIT(11),  ///< kaon rejection at low p
+      kPlanProtonRejLowP      = BIT(12),  ///< proton rejection at low p
+      kPlanPionRejLowP        = BIT(13),  ///< pion rejection at low p
+      kPlanTOF                = BIT(14),  ///< TOF electron nsigma cut
+      kPlanTOFMomRange        = BIT(15),  ///< TOF cut only in a momentum range
+      kPlanITS                = BIT(16),  ///< ITS electron nsigma cut
+      kPlanTRD                = BIT(17)   ///< TRD electron PID
+    };
+
+    /// Flat selection plan compiled from the cut values (see CompileSelectionPlan).
+    /// It is evaluated by the per-candidate selection methods, instead of
+    /// re-deriving the cut configuration from the cut flags at each call.
+    struct SelectionPlan {
+      UInt_t                fChecks;                  ///< enabled checks, see selectionPlanChecks
+      Int_t                 fShrinkTPCAcceptance;     ///< mode of the TPC acceptance restriction
+      Int_t                 fPsiPairMode;             ///< 0: flat, 1: linear in chi2, 2: exponential in chi2
+      Double_t              fQtMax;                   ///< maximum qt
+      Double_t              fQtPtMax;                 ///< maximum qt/pt
+      Double_t              fMaxPhotonAsymmetry;      ///< alpha axis of the elliptic qt cut
+      Double_t              fChi2Max;                 ///< maximum chi2/ndf
+      Double_t              fPsiPairMax;              ///< maximum psi pair (at chi2=0)
+      Double_t              fPsiPairChi2Slope;        ///< slope of the linear psi pair vs chi2 cut
+      Double_t              fPsiPairChi2Exp;          ///< exponent of the exponential psi pair vs chi2 cut
+      Double_t              fCosPAngleMin;            ///< minimum cosine of pointing angle
+      Double_t              fDCARMax;                 ///< maximum DCA R to the primary vertex
+      Double_t              fDCAZMax;                 ///< maximum DCA z to the primary vertex
+      Double_t              fAsymMinP;                ///< minimum leg momentum for the asymmetry cut
+      Double_t              fAsymMin;                 ///< minimum leg momentum fraction
+      Double_t              fAsymMax;                 ///< maximum leg momentum fraction
+      Double_t              fMaxR;                    ///< maximum conversion radius
+      Double_t              fMinR;                    ///< minimum conversion radius
+      Double_t              fExcludeMinR;             ///< lower edge of the excluded radius window
+      Double_t              fExcludeMaxR;             ///< upper edge of the excluded radius window
+      Double_t              fLineSlope;               ///< slope of the line cut
+      Double_t              fLineZ;                   ///< offset of the line cut
+      Double_t              fLineSlopeMin;            ///< slope of the second line cut
+      Double_t              fLineZMin;                ///< offset of the second line cut
+      Double_t              fMaxZ;                    ///< maximum |z| of the conversion point
+      Double_t              fEtaMax;                  ///< maximum |eta|
+      Double_t              fEtaMin;                  ///< minimum |eta|
+      Double_t              fEtaForPhiMin;            ///< eta range of the phi restriction
+      Double_t              fEtaForPhiMax;            ///< eta range of the phi restriction
+      Double_t              fPhiMin;                  ///< phi range of the phi restriction
+      Double_t              fPhiMax;                  ///< phi range of the phi restriction
+      Double_t              fPhiRegionAMin;           ///< accepted phi region on A side (modes 2 and 3)
+      Double_t              fPhiRegionAMax;           ///< accepted phi region on A side (modes 2 and 3)
+      Double_t              fPhiRegionCMin;           ///< accepted phi region on C side (modes 2 and 3)
+      Double_t              fPhiRegionCMax;           ///< accepted phi region on C side (modes 2 and 3)
+      Double_t              fPtMin;                   ///< minimum photon pt
+      std::vector<Double_t> fRDepEdges;               ///< radius bin edges of the R dependent pt cut
+      std::vector<Double_t> fRDepPtMin;               ///< pt cut per radius bin, index = number of edges below R
+      Double_t              fElecLineBelow;           ///< TPC electron line
+      Double_t              fElecLineAbove;           ///< TPC electron line
+      Double_t              fPionLinePMin;            ///< momentum range of the pion line
+      Double_t              fPionLinePMax;            ///< momentum range of the pion line
+      Double_t              fPionLineAbove;           ///< TPC pion line
+      Double_t              fPionLineAboveHighPt;     ///< TPC pion line above fPionLinePMax
+      Double_t              fKaonRejPMax;             ///< kaon rejection momentum limit
+      Double_t              fKaonRejNSigma;           ///< kaon rejection band
+      Double_t              fProtonRejPMax;           ///< proton rejection momentum limit
+      Double_t              fProtonRejNSigma;         ///< proton rejection band
+      Double_t              fPionRejPMax;             ///< pion rejection momentum limit
+      Double_t              fPionRejNSigma;           ///< pion rejection band
+      Double_t              fTOFPtMin;                ///< pt range of the TOF cut
+      Double_t              fTOFPtMax;                ///< pt range of the TOF cut
+      Double_t              fTOFAbove;                ///< TOF electron line
+      Double_t              fTOFBelow;                ///< TOF electron line
+      Double_t              fITSPtMax;                ///< maximum pt of the ITS cut
+      Double_t              fITSAbove;                ///< ITS electron line
+      Double_t              fITSBelow;                ///< ITS electron line
+      Double_t              fTRDEfficiency;           ///< TRD electron efficiency
+    };
+
     Bool_t SetCutIds(TString cutString);
+    void CompileSelectionPlan();
+    // the plan is compiled on first use after the cuts have been changed
+    const SelectionPlan& GetSelectionPlan() const {
+      if(!fSelectionPlanCompiled) const_cast<AliConversionPhotonCuts*>(this)->CompileSelectionPlan();
+      return fSelectionPlan;
+    }
+    // every setter of a quantity read by the plan must call this
+    void InvalidateSelectionPlan() {fSelectionPlanCompiled=kFALSE;}
     Int_t fCuts[kNCuts];
     Bool_t SetCut(cutIds cutID, Int_t cut);
     Bool_t UpdateCutString();
@@ -261,9 +356,9 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t UseToCloseV0sCut(){return fDoToCloseV0sCut;}
     Double_t GetEtaCut(){return fEtaCut;}
     Double_t GetSingleElectronPtCut(){return fSinglePtCut;}
-    void SetDodEdxSigmaCut(Bool_t k=kTRUE)  {fDodEdxSigmaCut=k;}
-    void SetSwitchToKappaInsteadOfNSigdEdxTPC(Bool_t k=kTRUE) {fSwitchToKappa=k;}
-    void SetDoElecDeDxPostCalibration(Bool_t k=kTRUE)  {fDoElecDeDxPostCalibration=k;}
+    void SetDodEdxSigmaCut(Bool_t k=kTRUE)  {fDodEdxSigmaCut=k; InvalidateSelectionPlan();}
+    void SetSwitchToKappaInsteadOfNSigdEdxTPC(Bool_t k=kTRUE) {fSwitchToKappa=k; InvalidateSelectionPlan();}
+    void SetDoElecDeDxPostCalibration(Bool_t k=kTRUE)  {fDoElecDeDxPostCalibration=k; InvalidateSelectionPlan();}
     Bool_t GetMaterialBudgetWeightsInitialized() {return fMaterialBudgetWeightsInitialized;}
     Bool_t InitializeMaterialBudgetWeights(Int_t flag, TString filename);
     Float_t GetMaterialBudgetCorrectingWeightForTrueGamma(AliAODConversionPhoton* gamma, Double_t magField);
@@ -276,8 +371,8 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t LoadElecDeDxPostCalibration(Int_t runNumber);
     Double_t GetCorrectedElectronTPCResponse(Short_t charge,Double_t nsig,Double_t P,Double_t Eta,Double_t TPCCl, Double_t R);
     void ForceTPCRecalibrationAsFunctionOfConvR(){fIsRecalibDepTPCCl = kFALSE;}
-    void SetPtCutArraySize(Int_t ptCutArraySize){fPtCutArraySize = ptCutArraySize;return;};
-    void SetRArraySize(Int_t rArraySize){fRArraySize = rArraySize;return;};
+    void SetPtCutArraySize(Int_t ptCutArraySize){fPtCutArraySize = ptCutArraySize; InvalidateSelectionPlan(); return;};
+    void SetRArraySize(Int_t rArraySize){fRArraySize = rArraySize; InvalidateSelectionPlan(); return;};
 
   protected:
     TList*            fHistograms;                          ///< List of QA histograms
@@ -453,6 +548,8 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Double_t          fBadRegionAMax;                       ///<
     Double_t          fExcludeMinR;                         ///< r cut exclude region
     Double_t          fExcludeMaxR;                         ///< r cut exclude region
+    SelectionPlan     fSelectionPlan;                       //!<! selection plan compiled from the cuts above
+    Bool_t            fSelectionPlanCompiled;               //!<! whether fSelectionPlan is up to date
 
   private:
     /*helper class for on-the-fly removal of elements from a std::map like container while iterating over it */
@@ -469,7 +566,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     void RemovePhotonWithHigherChi2(TItRemove &theI1, TItRemove &theI2) const;
 
     /// \cond CLASSIMP
-    ClassDef(AliConversionPhotonCuts,40)
+    ClassDef(AliConversionPhotonCuts,41)
     /// \endcond
 };
 
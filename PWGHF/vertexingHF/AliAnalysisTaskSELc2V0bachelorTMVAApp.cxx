@@ -77,6 +77,7 @@
 #include <TMVA/MethodCuts.h>
 
 #include "IClassifierReader.h"
+#include "AliHFFlatBDTReader.h"
 
 using std::cout;
 using std::endl;
@@ -248,7 +249,8 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::AliAnalysisTaskSELc2V0bachelorTMVAApp():
   fMultiplicityCutMin(0.),
   fMultiplicityCutMax(99999.),
   fUseXmlFileFromCVMFS(kFALSE),
-  fXmlFileFromCVMFS("")
+  fXmlFileFromCVMFS(""),
+  fUseFlatBDTReader(kFALSE)
 {
   /// Default ctor
   //
@@ -417,7 +419,8 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::AliAnalysisTaskSELc2V0bachelorTMVAApp(con
   fMultiplicityCutMin(0.),
   fMultiplicityCutMax(99999.),
   fUseXmlFileFromCVMFS(kFALSE),
-  fXmlFileFromCVMFS("")
+  fXmlFileFromCVMFS(""),
+  fUseFlatBDTReader(kFALSE)
 {
   //
   /// Constructor. Initialization of Inputs and Outputs
@@ -506,7 +509,8 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::~AliAnalysisTaskSELc2V0bachelorTMVAApp()
   }
   
   if (fBDTReader) {
-    //delete fBDTReader;
+    // the generated readers belong to the library loaded with dlopen
+    if (fUseFlatBDTReader) delete fBDTReader;
     fBDTReader = 0;
   }
 
@@ -1109,7 +1113,13 @@ void AliAnalysisTaskSELc2V0bachelorTMVAApp::UserCreateOutputObjects() {
       if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) fReader->AddSpectator(variable.Data(), &fVarsTMVASpectators[i]);
     }
     delete tokensSpectators;
-    if (fUseWeightsLibrary) {
+    if (fUseWeightsLibrary && fUseFlatBDTReader) {
+      TString weightsFile = fXmlWeightsFile;
+      if (fUseXmlFileFromCVMFS) weightsFile = AliDataFile::GetFileName(fXmlFileFromCVMFS.Data());
+      fBDTReader = new AliHFFlatBDTReader(weightsFile.Data(), inputNamesVec);
+      if (!fBDTReader->IsStatusClean()) AliFatal(Form("Cannot read the BDT from %s", weightsFile.Data()));
+    }
+    else if (fUseWeightsLibrary) {
       void* lib = dlopen(fTMVAlibName.Data(), RTLD_NOW);
       void* p = dlsym(lib, Form("%s", fTMVAlibPtBin.Data()));
       IClassifierReader* (*maker1)(std::vector<std::string>&) = (IClassifierReader* (*)(std::vector<std::string>&)) p;
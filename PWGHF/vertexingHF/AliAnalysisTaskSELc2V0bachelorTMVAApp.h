@@ -188,6 +188,12 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   void SetXmlFileFromCVMFS(TString fileName) {fXmlFileFromCVMFS = fileName;}
   TString GetXmlFileFromCVMFS() const {return fXmlFileFromCVMFS;}
 
+  /// with the weights library option, read the BDT from the xml weights file
+  /// (fXmlWeightsFile, or fXmlFileFromCVMFS) with AliHFFlatBDTReader instead of
+  /// loading the generated class from fTMVAlibName
+  void SetUseFlatBDTReader(Bool_t flag) {fUseFlatBDTReader = flag;}
+  Bool_t GetUseFlatBDTReader() const {return fUseFlatBDTReader;}
+
   void SetUseMultiplicityCorrection(Bool_t flag){fUseMultCorrection=flag;}
 
   void SetReferenceMultiplcity(Double_t rmu){fRefMult=rmu;}
@@ -605,6 +611,7 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   TH2D *fBDTHistoTMVA;                  //!<! BDT histo file for the case in which the xml file is used
   Bool_t fUseXmlFileFromCVMFS;          // Boolean to acces Xml from CVMFS path
   TString fXmlFileFromCVMFS;            // Path in CVMFS directory
+  Bool_t fUseFlatBDTReader;             // read the BDT of fBDTReader from the xml file with AliHFFlatBDTReader
   
   // Multiplicity corrections
   TProfile* GetEstimatorHistogram(const AliVEvent *event);
@@ -624,7 +631,7 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   TH2F* fHistoVzVsNtrCorr;           //!<! hist. Vz vs corrected tracklets
   
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSELc2V0bachelorTMVAApp, 12); /// class for Lc->p K0
+  ClassDef(AliAnalysisTaskSELc2V0bachelorTMVAApp, 13); /// class for Lc->p K0
   /// \endcond    
 };
 
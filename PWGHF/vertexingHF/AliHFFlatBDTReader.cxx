@@ -0,0 +1,265 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////
+//
+// BDT classifier read from a TMVA .weights.xml file into a
+// flattened forest (see header)
+//
+/////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include "AliHFFlatBDTReader.h"
+
+namespace {
+  // value of attribute "name" in an xml tag written on a single line, as in the TMVA weights files
+  Bool_t GetAttribute(const std::string& line, const char* name, std::string& value) {
+    std::string key = std::string(" ") + name + "=\"";
+    size_t start = line.find(key);
+    if (start == std::string::npos) return kFALSE;
+    start += key.size();
+    size_t end = line.find('"', start);
+    if (end == std::string::npos) return kFALSE;
+    value = line.substr(start, end - start);
+    return kTRUE;
+  }
+  // text between the first '>' and the following '<'
+  std::string GetContent(const std::string& line) {
+    size_t start = line.find('>');
+    if (start == std::string::npos) return "";
+    size_t end = line.find('<', start + 1);
+    if (end == std::string::npos) return "";
+    return line.substr(start + 1, end - start - 1);
+  }
+}
+
+//________________________________________________________________________
+AliHFFlatBDTReader::AliHFFlatBDTReader() :
+  IClassifierReader(),
+  fVariables(),
+  fNodes(),
+  fRoots(),
+  fBoostWeights(),
+  fNorm(0.),
+  fBoostType(kAdaBoost),
+  fUseYesNoLeaf(kTRUE)
+{
+  /// Default constructor, the forest is empty until ReadWeightsFile is called
+  fStatusIsClean = false;
+}
+
+//________________________________________________________________________
+AliHFFlatBDTReader::AliHFFlatBDTReader(const char* fileName, const std::vector<std::string>& theInputVars) :
+  IClassifierReader(),
+  fVariables(),
+  fNodes(),
+  fRoots(),
+  fBoostWeights(),
+  fNorm(0.),
+  fBoostType(kAdaBoost),
+  fUseYesNoLeaf(kTRUE)
+{
+  /// Constructor reading the forest and validating the input variables
+  if (!ReadWeightsFile(fileName)) return;
+
+  if (theInputVars.size() != fVariables.size()) {
+    std::cout << "Problem in class \"AliHFFlatBDTReader\": mismatch in number of input values: "
+              << theInputVars.size() << " != " << fVariables.size() << std::endl;
+    fStatusIsClean = false;
+    return;
+  }
+  for (size_t ivar = 0; ivar < theInputVars.size(); ivar++) {
+    if (theInputVars[ivar] != fVariables[ivar]) {
+      std::cout << "Problem in class \"AliHFFlatBDTReader\": mismatch in input variable names" << std::endl
+                << " for variable [" << ivar << "]: " << theInputVars[ivar] << " != " << fVariables[ivar] << std::endl;
+      fStatusIsClean = false;
+    }
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliHFFlatBDTReader::ReadWeightsFile(const char* fileName) {
+  /// Read the variables, the boost options and the trees from a TMVA BDT weights file
+
+  fVariables.clear();
+  fNodes.clear();
+  fRoots.clear();
+  fBoostWeights.clear();
+  fNorm = 0.;
+  fBoostType = kAdaBoost;
+  fUseYesNoLeaf = kTRUE;
+  fStatusIsClean = false;
+
+  std::ifstream in(fileName);
+  if (!in.good()) {
+    std::cout << "Problem in class \"AliHFFlatBDTReader\": cannot open " << fileName << std::endl;
+    return kFALSE;
+  }
+
+  std::vector<Int_t> stack;      // open intermediate nodes
+  std::string line, value;
+  Bool_t inWeights = kFALSE;
+  while (std::getline(in, line)) {
+    size_t first = line.find_first_not_of(" \t");
+    if (first == std::string::npos) continue;
+    const char* tag = line.c_str() + first;
+
+    if (!inWeights) {
+      if (!strncmp(tag, "<Option ", 8) && GetAttribute(line, "name", value)) {
+        if (value == "BoostType") {
+          std::string type = GetContent(line);
+          if (type == "Grad") fBoostType = kGrad;
+          else if (type == "AdaBoost" || type == "Bagging") fBoostType = kAdaBoost;
+          else {
+            std::cout << "Problem in class \"AliHFFlatBDTReader\": boost type " << type << " not supported" << std::endl;
+            return kFALSE;
+          }
+        }
+        else if (value == "UseYesNoLeaf") fUseYesNoLeaf = (GetContent(line) == "True");
+      }
+      else if (!strncmp(tag, "<Variable ", 10) && GetAttribute(line, "Expression", value)) {
+        fVariables.push_back(value);
+      }
+      else if (!strncmp(tag, "<Transformations ", 17) && GetAttribute(line, "NTransformations", value) && atoi(value.c_str()) != 0) {
+        std::cout << "Problem in class \"AliHFFlatBDTReader\": variable transformations are not supported" << std::endl;
+        return kFALSE;
+      }
+      else if (!strncmp(tag, "<Weights", 8)) inWeights = kTRUE;
+      continue;
+    }
+
+    if (!strncmp(tag, "<BinaryTree", 11)) {
+      if (!GetAttribute(line, "boostWeight", value)) return kFALSE;
+      fBoostWeights.push_back(atof(value.c_str()));
+      fNorm += fBoostWeights.back();
+    }
+    else if (!strncmp(tag, "<Node", 5)) {
+      std::string pos, ivar, cut, ctype, ntype, leafValue;
+      if (!GetAttribute(line, "pos", pos) || !GetAttribute(line, "IVar", ivar) || !GetAttribute(line, "Cut", cut) ||
+          !GetAttribute(line, "cType", ctype) || !GetAttribute(line, "nType", ntype)) return kFALSE;
+      Int_t index = fNodes.size();
+      Node node;
+      node.fChild[0] = node.fChild[1] = -1;
+      Int_t nodeType = atoi(ntype.c_str());
+      Bool_t cutType = atoi(ctype.c_str());
+      if (nodeType == 0) {
+        node.fVar = atoi(ivar.c_str());
+        node.fCut = atof(cut.c_str());
+        // store the cut type with the sign of fVar until the children are attached
+        if (!cutType) node.fVar = -node.fVar - 2;
+      }
+      else {
+        node.fVar = -1;
+        if (fBoostType == kGrad) {
+          if (!GetAttribute(line, "res", leafValue)) return kFALSE;
+          node.fCut = atof(leafValue.c_str());
+        }
+        else if (fUseYesNoLeaf) node.fCut = nodeType;
+        else {
+          if (!GetAttribute(line, "purity", leafValue)) return kFALSE;
+          node.fCut = atof(leafValue.c_str());
+        }
+      }
+      fNodes.push_back(node);
+
+      if (pos == "s") fRoots.push_back(index);
+      else {
+        if (stack.empty()) return kFALSE;
+        Node& parent = fNodes[stack.back()];
+        Bool_t parentCutType = (parent.fVar >= 0);
+        // right daughter is taken for x >= cut if the cut selects signal, for x < cut otherwise
+        Bool_t isRight = (pos == "r");
+        parent.fChild[(isRight == parentCutType) ? 1 : 0] = index;
+      }
+      if (line.find("/>") == std::string::npos) stack.push_back(index);
+    }
+    else if (!strncmp(tag, "</Node>", 7)) {
+      if (stack.empty()) return kFALSE;
+      Node& closed = fNodes[stack.back()];
+      if (closed.fVar < -1) closed.fVar = -closed.fVar - 2;
+      stack.pop_back();
+    }
+    else if (!strncmp(tag, "</Weights>", 10)) break;
+  }
+
+  if (fVariables.empty() || fRoots.empty() || fRoots.size() != fBoostWeights.size() || !stack.empty()) {
+    std::cout << "Problem in class \"AliHFFlatBDTReader\": incomplete weights file " << fileName << std::endl;
+    return kFALSE;
+  }
+  for (size_t inode = 0; inode < fNodes.size(); inode++) {
+    if (fNodes[inode].fVar >= 0 && (fNodes[inode].fChild[0] < 0 || fNodes[inode].fChild[1] < 0)) {
+      std::cout << "Problem in class \"AliHFFlatBDTReader\": node without daughters in " << fileName << std::endl;
+      return kFALSE;
+    }
+  }
+  fStatusIsClean = true;
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Double_t AliHFFlatBDTReader::Finalise(Double_t sum) const {
+  /// classifier response from the sum of the tree responses, as in TMVA::MethodBDT
+  if (fBoostType == kGrad) return 2.0/(1.0+std::exp(-2.0*sum))-1.0;
+  return (fNorm > std::numeric_limits<double>::epsilon()) ? sum/fNorm : 0.;
+}
+
+//________________________________________________________________________
+double AliHFFlatBDTReader::GetMvaValue(const std::vector<double>& inputValues) const {
+  /// classifier response of one candidate
+  if (!IsStatusClean()) {
+    std::cout << "Problem in class \"AliHFFlatBDTReader\": cannot return classifier response"
+              << " because status is dirty" << std::endl;
+    return 0;
+  }
+  const Node* nodes = &fNodes[0];
+  const double* x = &inputValues[0];
+  Double_t sum = 0.;
+  for (size_t itree = 0; itree < fRoots.size(); itree++) {
+    const Node* current = nodes + fRoots[itree];
+    while (current->fVar >= 0) current = nodes + current->fChild[x[current->fVar] >= current->fCut];
+    sum += (fBoostType == kGrad) ? current->fCut : fBoostWeights[itree]*current->fCut;
+  }
+  return Finalise(sum);
+}
+
+//________________________________________________________________________
+void AliHFFlatBDTReader::GetMvaValues(const double* inputValues, Int_t nCandidates, Int_t stride, double* responses) const {
+  /// classifier responses of nCandidates candidates. The loop over the candidates
+  /// is the inner one, so that each tree is walked by all candidates while it is in cache
+  if (!IsStatusClean()) {
+    std::cout << "Problem in class \"AliHFFlatBDTReader\": cannot return classifier response"
+              << " because status is dirty" << std::endl;
+    for (Int_t icand = 0; icand < nCandidates; icand++) responses[icand] = 0;
+    return;
+  }
+  const Node* nodes = &fNodes[0];
+  for (Int_t icand = 0; icand < nCandidates; icand++) responses[icand] = 0.;
+  for (size_t itree = 0; itree < fRoots.size(); itree++) {
+    const Node* root = nodes + fRoots[itree];
+    const Double_t weight = (fBoostType == kGrad) ? 1. : fBoostWeights[itree];
+    for (Int_t icand = 0; icand < nCandidates; icand++) {
+      const double* x = inputValues + (size_t)icand*stride;
+      const Node* current = root;
+      while (current->fVar >= 0) current = nodes + current->fChild[x[current->fVar] >= current->fCut];
+      responses[icand] += weight*current->fCut;
+    }
+  }
+  for (Int_t icand = 0; icand < nCandidates; icand++) responses[icand] = Finalise(responses[icand]);
+}
@@ -0,0 +1,72 @@
+#ifndef ALIHFFLATBDTREADER_H
+#define ALIHFFLATBDTREADER_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//***********************************************************
+/// \class AliHFFlatBDTReader
+/// \brief BDT classifier read from a TMVA .weights.xml file
+///
+/// Generic replacement of the ReadBDT_* classes generated with
+/// MethodBase::MakeClass (see PWGHF/vertexingHF/TMVA). The forest is
+/// read once from the weights file into a single array of nodes, each
+/// tree stored in pre-order, instead of one heap allocated BDTNode per
+/// node. Besides the IClassifierReader interface, a batch evaluation
+/// scores many candidates in one pass over the forest.
+//***********************************************************
+
+#include <string>
+#include <vector>
+#include <Rtypes.h>
+#include "IClassifierReader.h"
+
+class AliHFFlatBDTReader : public IClassifierReader
+{
+ public:
+
+  AliHFFlatBDTReader();
+  /// read the forest from fileName and check the input variables (Expression
+  /// attribute of the weights file) against theInputVars, as the generated readers
+  AliHFFlatBDTReader(const char* fileName, const std::vector<std::string>& theInputVars);
+  virtual ~AliHFFlatBDTReader() {}
+
+  Bool_t ReadWeightsFile(const char* fileName);
+
+  virtual double GetMvaValue(const std::vector<double>& inputValues) const;
+  /// responses of nCandidates candidates, the input variables of candidate i
+  /// being inputValues[i*stride ... i*stride+GetNvar()-1]
+  void GetMvaValues(const double* inputValues, Int_t nCandidates, Int_t stride, double* responses) const;
+
+  UInt_t GetNvar() const {return fVariables.size();}
+  UInt_t GetNTrees() const {return fBoostWeights.size();}
+  const std::string& GetVariable(UInt_t ivar) const {return fVariables[ivar];}
+
+  /// node of the flattened forest. Intermediate nodes go to fChild[1] if
+  /// x[fVar] >= fCut, to fChild[0] otherwise (the cut type of TMVA is folded
+  /// in the order of the children). Leaves have fVar = -1 and hold their
+  /// response in fCut
+  struct Node {
+    Double_t fCut;
+    Int_t    fVar;
+    Int_t    fChild[2];
+  };
+
+ private:
+
+  enum EBoostType {kAdaBoost, kGrad};
+
+  AliHFFlatBDTReader(const AliHFFlatBDTReader&);
+  AliHFFlatBDTReader& operator=(const AliHFFlatBDTReader&);
+
+  Double_t Finalise(Double_t sum) const;
+
+  std::vector<std::string> fVariables;    /// input variables of the training
+  std::vector<Node>        fNodes;        /// nodes of all trees
+  std::vector<Int_t>       fRoots;        /// index of the root node of each tree
+  std::vector<Double_t>    fBoostWeights; /// boost weight of each tree
+  Double_t                 fNorm;         /// sum of the boost weights
+  Int_t                    fBoostType;    /// how the tree responses are combined
+  Bool_t                   fUseYesNoLeaf; /// leaf response is the node type (+-1) instead of the purity
+};
+
+#endif
@@ -60,7 +60,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fNParticlesStep(0.005),
+    fNParticlesMax(10),
+    fVerifyNParticles(false),
+    fNParticlesDiff(0),
+    fNParticlesNPoints(0),
+    fNParticlesOffset(0),
+    fNParticlesTable(0)
 {
   // 
   // Constructor 
@@ -98,7 +105,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fNParticlesStep(0.005),
+    fNParticlesMax(10),
+    fVerifyNParticles(false),
+    fNParticlesDiff(0),
+    fNParticlesNPoints(0),
+    fNParticlesOffset(0),
+    fNParticlesTable(0)
 {
   // 
   // Constructor 
@@ -134,6 +148,13 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
   fLowCuts->SetXTitle("#eta");
   fLowCuts->SetDirectory(0);
 
+  fNParticlesDiff = new TH1D("nParticlesDiff", 
+			     "Tabulated minus exact number of particles",
+			     200, -0.01, 0.01);
+  fNParticlesDiff->SetFillColor(kGreen+1);
+  fNParticlesDiff->SetXTitle("N_{table}-N_{exact}");
+  fNParticlesDiff->SetDirectory(0);
+
 }
 
 //____________________________________________________________________
@@ -167,7 +188,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fNParticlesStep(o.fNParticlesStep),
+  fNParticlesMax(o.fNParticlesMax),
+  fVerifyNParticles(o.fVerifyNParticles),
+  fNParticlesDiff(o.fNParticlesDiff),
+  fNParticlesNPoints(o.fNParticlesNPoints),
+  fNParticlesOffset(o.fNParticlesOffset),
+  fNParticlesTable(o.fNParticlesTable)
 {
   // 
   // Copy constructor 
@@ -232,6 +260,13 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fNParticlesStep     = o.fNParticlesStep;
+  fNParticlesMax      = o.fNParticlesMax;
+  fVerifyNParticles   = o.fVerifyNParticles;
+  fNParticlesDiff     = o.fNParticlesDiff;
+  fNParticlesNPoints  = o.fNParticlesNPoints;
+  fNParticlesOffset   = o.fNParticlesOffset;
+  fNParticlesTable    = o.fNParticlesTable;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -251,6 +286,7 @@ AliFMDDensityCalculator::SetupForData(const TAxis& axis)
   //   etaAxis   Eta axis
   DGUARD(fDebug, 1, "Initialize FMD density calculator");
   CacheMaxWeights(axis);
+  CacheNParticles();
  
   fCache.Init(axis);
 
@@ -292,6 +328,15 @@ AliFMDDensityCalculator::GetRingHistos(UShort_t d, Char_t r) const
 }
 
 namespace {
+  Int_t RingIndex(UShort_t d, Char_t r)
+  {
+    switch (d) { 
+    case 1: return 0;
+    case 2: return (r == 'I' || r == 'i') ? 1 : 2;
+    case 3: return (r == 'I' || r == 'i') ? 3 : 4;
+    }
+    return -1;
+  }
   Double_t Rng2Cut(UShort_t d, Char_t r, Int_t xbin, TH2* h) 
   {
     Double_t ret = 1024;
@@ -835,6 +880,104 @@ AliFMDDensityCalculator::GetMaxWeight(UShort_t d, Char_t r, Float_t eta) const
   return GetMaxWeight(d, r, iEta);
 }
 
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheNParticles()
+{
+  // 
+  // Tabulate the weighted mean number of particles as a function of
+  // the signal for each ring and eta bin of the energy loss fits, so
+  // that NParticles does not have to evaluate the sum of
+  // Landau-Gauss functions for each strip.
+  // 
+  DGUARD(fDebug, 2, "Cache number of particles in FMD density calculator");
+  fNParticlesNPoints = 0;
+  fNParticlesOffset.Set(0);
+  fNParticlesTable.Set(0);
+  if (fNParticlesStep <= 0 || fNParticlesMax < 4 * fNParticlesStep) return;
+
+  AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  const AliFMDCorrELossFit*     cor = fcm.GetELossFit();
+  Int_t nEta = cor->GetEtaAxis().GetNbins();
+  Int_t nX   = Int_t(fNParticlesMax / fNParticlesStep + .5) + 1;
+
+  // Find the bins with a usable fit, and the table offset of each
+  fNParticlesOffset.Set(5 * (nEta + 1));
+  fNParticlesOffset.Reset(-1);
+  Int_t nUsed = 0;
+  for (UShort_t d=1; d<=3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q=0; q<nr; q++) { 
+      Char_t r = (q == 0 ? 'I' : 'O');
+      for (Int_t e = 1; e <= nEta; e++) { 
+	if (!cor->FindFit(d, r, e, -1))   continue;
+	if (GetMaxWeight(d, r, e-1) < 1) continue;
+	fNParticlesOffset[RingIndex(d,r) * (nEta + 1) + e] = nUsed * nX;
+	nUsed++;
+      }
+    }
+  }
+
+  // Evaluate the response on the grid 
+  fNParticlesTable.Set(nUsed * nX);
+  for (UShort_t d=1; d<=3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q=0; q<nr; q++) { 
+      Char_t r = (q == 0 ? 'I' : 'O');
+      for (Int_t e = 1; e <= nEta; e++) { 
+	Int_t off = fNParticlesOffset[RingIndex(d,r) * (nEta + 1) + e];
+	if (off < 0) continue;
+	AliFMDCorrELossFit::ELossFit* fit = cor->FindFit(d, r, e, -1);
+	UShort_t n = TMath::Min(fMaxParticles, 
+				UShort_t(GetMaxWeight(d, r, e-1)));
+	for (Int_t i = 0; i < nX; i++) 
+	  fNParticlesTable[off + i] = fit->EvaluateWeighted(i*fNParticlesStep,
+							    n);
+      }
+    }
+  }
+  fNParticlesNPoints = nX;
+  AliInfo(Form("Tabulated number of particles for %d eta bins, "
+	       "%d points from 0 to %f", nUsed, nX, (nX-1)*fNParticlesStep));
+}
+
+//_____________________________________________________________________
+Double_t
+AliFMDDensityCalculator::InterpolateNParticles(Float_t  mult, 
+					       UShort_t d, 
+					       Char_t   r, 
+					       Int_t    etaBin) const
+{
+  // 
+  // Interpolate the tabulated number of particles.  A cubic
+  // (4-point Lagrange) interpolation is used. 
+  // 
+  // Parameters:
+  //    mult    Signal 
+  //    d       Detector 
+  //    r       Ring 
+  //    etaBin  Eta bin of the energy loss fits (1 based) 
+  // 
+  // Return:
+  //    Number of particles, or negative if not tabulated 
+  //
+  if (fNParticlesNPoints <= 0) return -1;
+  Int_t nEta1 = fNParticlesOffset.fN / 5;
+  if (etaBin < 1 || etaBin >= nEta1) return -1;
+  Int_t off = fNParticlesOffset.fArray[RingIndex(d,r) * nEta1 + etaBin];
+  if (off < 0) return -1;
+
+  Double_t u = mult / fNParticlesStep;
+  Int_t    i = Int_t(u);
+  if (i < 1 || i + 2 >= fNParticlesNPoints) return -1;
+  Double_t t = u - i;
+  const Float_t* y = fNParticlesTable.fArray + off + i - 1;
+  return (- t     * (t-1) * (t-2) * y[0] / 6
+	  + (t+1) * (t-1) * (t-2) * y[1] / 2
+	  - (t+1) * t     * (t-2) * y[2] / 2
+	  + (t+1) * t     * (t-1) * y[3] / 6);
+}
+
 //_____________________________________________________________________
 Float_t 
 AliFMDDensityCalculator::NParticles(Float_t  mult, 
@@ -864,21 +1007,28 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
-  AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
-  if (!fit) { 
-    AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
-		    d, r, eta, fMinQuality));
-    return 0;
-  }
+  Int_t    etaBin = fcm.GetELossFit()->FindEtaBin(eta);
+  Double_t ret    = InterpolateNParticles(mult, d, r, etaBin);
+  if (ret < 0 || fVerifyNParticles) {
+    AliFMDCorrELossFit::ELossFit* fit = 
+      fcm.GetELossFit()->FindFit(d,r,etaBin, -1);
+    if (!fit) { 
+      AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
+		      d, r, eta, fMinQuality));
+      return 0;
+    }
   
-  Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
-  if (m < 1) { 
-    AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
-    return 0;
-  }
+    Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
+    if (m < 1) { 
+      AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
+      return 0;
+    }
   
-  UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
-  Double_t ret = fit->EvaluateWeighted(mult, n);
+    UShort_t n     = TMath::Min(fMaxParticles, UShort_t(m));
+    Double_t exact = fit->EvaluateWeighted(mult, n);
+    if (ret < 0) ret = exact;
+    else if (fNParticlesDiff) fNParticlesDiff->Fill(ret - exact);
+  }
   
   if (fDebug > 10) {
     AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
@@ -1105,6 +1255,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(fAccO);
   d->Add(fMaxWeights);
   d->Add(fLowCuts);
+  if (fVerifyNParticles) d->Add(fNParticlesDiff);
 
   TParameter<int>* nFiles = new TParameter<int>("nFiles", 1);
   nFiles->SetMergeMode('+');
@@ -1120,6 +1271,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("nParticlesStep", fNParticlesStep));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1201,6 +1353,9 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFV("Step(N table)",          fNParticlesStep);
+  PFV("Max(N table)",           fNParticlesMax);
+  PFB("Verify N table",         fVerifyNParticles);
   PFV("Lower cut", "");
   fCuts.Print();
 
@@ -16,6 +16,7 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayF.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -211,6 +212,27 @@ public:
    * @param cut Cut value 
    */
   void SetHitThreshold(Double_t cut=0.9) { fHitThreshold = cut; }
+  /** 
+   * Set the grid of the tabulated response used by NParticles.  The
+   * weighted mean number of particles is tabulated for each ring and
+   * @f$\eta@f$ bin of the energy loss fits, for signals from 0 to
+   * @a max in steps of @a step, and interpolated.  Signals outside
+   * the grid are evaluated exactly.
+   * 
+   * @param step Step of the grid (if 0 or less, always evaluate exactly)
+   * @param max  Largest tabulated signal 
+   */
+  void SetNParticlesTable(Double_t step=0.005, Double_t max=10) { 
+    fNParticlesStep = step; 
+    fNParticlesMax  = max;
+  }
+  /** 
+   * Whether to compare the tabulated response to the exact
+   * evaluation for each strip.  The differences are histogrammed.
+   * 
+   * @param verify If true, verify the tabulated response 
+   */
+  void SetVerifyNParticles(Bool_t verify=true) { fVerifyNParticles = verify; }
   /** 
    * Get the multiplicity cut.  If the user has set fMultCut (via
    * SetMultCut) then that value is used.  If not, then the lower
@@ -319,6 +341,24 @@ protected:
    * @return max weight or <= 0 in case of problems 
    */
   Int_t GetMaxWeight(UShort_t d, Char_t r, Float_t eta) const;
+  /** 
+   * Tabulate the weighted mean number of particles as a function of
+   * the signal, for each ring and @f$\eta@f$ bin of the energy loss
+   * fits.  Must be called after CacheMaxWeights.
+   */
+  void CacheNParticles();
+  /** 
+   * Interpolate the tabulated number of particles 
+   * 
+   * @param mult    Signal
+   * @param d       Detector
+   * @param r       Ring
+   * @param etaBin  Eta bin of the energy loss fits (1 based)
+   * 
+   * @return Number of particles, or negative if not tabulated 
+   */
+  Double_t InterpolateNParticles(Float_t mult, UShort_t d, Char_t r,
+				 Int_t etaBin) const;
 
   /** 
    * Get the number of particles corresponding to the signal mult
@@ -504,8 +544,15 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Double_t fNParticlesStep;   // Step of the tabulated response 
+  Double_t fNParticlesMax;    // Largest tabulated signal 
+  Bool_t   fVerifyNParticles; // Compare tabulated and exact response
+  TH1D*    fNParticlesDiff;   // Tabulated minus exact response 
+  Int_t    fNParticlesNPoints; //! Number of points per table
+  TArrayI  fNParticlesOffset; //! Table offset per ring and eta bin 
+  TArrayF  fNParticlesTable;  //! Tabulated response 
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
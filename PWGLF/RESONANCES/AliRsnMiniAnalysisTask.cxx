@@ -13,12 +13,17 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 
 #include <Riostream.h>
+#include <vector>
+#include <algorithm>
+#include <thread>
 
 #include <TObjString.h>
 #include <TH1.h>
 #include <TList.h>
 #include <TTree.h>
 #include <TStopwatch.h>
+#include <THnBase.h>
+#include <TROOT.h>
 #include "TRandom.h"
 
 #include "AliLog.h"
@@ -46,6 +51,7 @@
 #include "AliRsnMiniPair.h"
 #include "AliRsnMiniEvent.h"
 #include "AliRsnMiniParticle.h"
+#include "AliRsnMiniAxis.h"
 
 #include "AliRsnMiniAnalysisTask.h"
 #include "AliRsnMiniResonanceFinder.h"
@@ -100,6 +106,8 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fMiniEvent(0x0),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
+   fMixInMemory(kFALSE),
+   fNThreads(1),
    fCheckDecay(kTRUE),
    fMaxNDaughters(-1),
    fCheckP(kFALSE),
@@ -172,6 +180,8 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fMiniEvent(0x0),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
+   fMixInMemory(kFALSE),
+   fNThreads(1),
    fCheckDecay(kTRUE),
    fMaxNDaughters(-1),
    fCheckP(kFALSE),
@@ -243,6 +253,8 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fMiniEvent(0x0),
    fBigOutput(copy.fBigOutput),
    fMixPrintRefresh(copy.fMixPrintRefresh),
+   fMixInMemory(copy.fMixInMemory),
+   fNThreads(copy.fNThreads),
    fCheckDecay(copy.fCheckDecay),
    fMaxNDaughters(copy.fMaxNDaughters),
    fCheckP(copy.fCheckP),
@@ -315,6 +327,8 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fESDtrackCuts = copy.fESDtrackCuts;
    fBigOutput = copy.fBigOutput;
    fMixPrintRefresh = copy.fMixPrintRefresh;
+   fMixInMemory = copy.fMixInMemory;
+   fNThreads = copy.fNThreads;
    fCheckDecay = copy.fCheckDecay;
    fMaxNDaughters = copy.fMaxNDaughters;
    fCheckP = copy.fCheckP;
@@ -587,10 +601,26 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
 
+   // with several threads, all pairs are filled after the reading of the buffer,
+   // which requires the decoded mini-events to be kept in memory
+   Bool_t parallel = (fNThreads > 1);
+   Bool_t inMemory = (parallel || (fNMix > 0 && fMixInMemory));
+
+   // event variables used for the mixing, collected while reading the buffer
+   // and, if requested, the decoded mini-events themselves
+   std::vector<Float_t> evVz, evMult, evAngle;
+   std::vector<AliRsnMiniEvent*> evStore;
+   if (fNMix > 0) {
+      evVz.resize(nEvents);
+      evMult.resize(nEvents);
+      evAngle.resize(nEvents);
+   }
+   if (inMemory) evStore.resize(nEvents, 0x0);
+
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
       if (nEvents>1e5) printNum=nEvents/100;
@@ -610,11 +640,19 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
       }
+      if (fNMix > 0) {
+         evVz[ievt]    = fMiniEvent->Vz();
+         evMult[ievt]  = fMiniEvent->Mult();
+         evAngle[ievt] = fMiniEvent->Angle();
+      }
+      if (inMemory) evStore[ievt] = new AliRsnMiniEvent(*fMiniEvent);
       // fill
       for (idef = 0; idef < nDefs; idef++) {
          def = (AliRsnMiniOutput *)fHistograms[idef];
          if (!def) continue;
          compType = def->GetComputation();
+         // pairs are filled later by the worker threads
+         if (parallel && compType != AliRsnMiniOutput::kEventOnly) continue;
          // execute computation in the appropriate way
          switch (compType) {
             case AliRsnMiniOutput::kEventOnly:
@@ -649,88 +687,67 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    }
 
    // if no mixing is required, stop here and post the output
-   if (fNMix < 1) {
+   if (fNMix < 1 && !parallel) {
       AliDebugClass(2, "Stopping here, since no mixing is required");
       PostData(1, fOutput);
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
-
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
-   // search for good matchings
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
-         // check that the found good events has not enough matches already
-         if (nmatched[imix] >= fNMix) continue;
-         // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
-         nmatched[ievt]++;
-         nmatched[imix]++;
-         if (nmatched[ievt] >= fNMix) break;
-      }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
+   // search for good matchings, without reading back the buffer
+   std::vector< std::vector<Int_t> > matched(nEvents);
+   if (fNMix > 0) {
+      FindMixingPartners(evVz, evMult, evAngle, matched, printNum);
+      AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
+      timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
    }
 
-   AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
-   timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
-
-   // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      ifill = 0;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
-         fEvBuffer->GetEntry(imix);
-         for (idef = 0; idef < nDefs; idef++) {
-            def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
-            if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
-            if (!def->IsSymmetric()) {
-               AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
+   if (parallel) {
+      // same-event pairs, rotated backgrounds and mixing, distributed over the threads
+      FillPairsParallel(evStore, matched);
+   } else {
+      // perform mixing
+      AliRsnMiniEvent *evMix = 0x0;
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         if (printNum&&(ievt%printNum==0)) {
+            AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
+            timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
+         }
+         if (matched[ievt].empty()) continue;
+         ifill = 0;
+         AliRsnMiniEvent *evMain = 0x0;
+         if (inMemory) {
+            evMain = evStore[ievt];
+         } else {
+            fEvBuffer->GetEntry(ievt);
+            evMain = new AliRsnMiniEvent(*fMiniEvent);
+         }
+         for (UInt_t im = 0; im < matched[ievt].size(); im++) {
+            imix = matched[ievt][im];
+            if (inMemory) {
+               evMix = evStore[imix];
+            } else {
+               fEvBuffer->GetEntry(imix);
+               evMix = fMiniEvent;
+            }
+            for (idef = 0; idef < nDefs; idef++) {
+               def = (AliRsnMiniOutput *)fHistograms[idef];
+               if (!def) continue;
+               if (!def->IsTrackPairMix()) continue;
+               ifill += def->FillPair(evMain, evMix, &fValues, kTRUE);
+               if (!def->IsSymmetric()) {
+                  AliDebugClass(2, "Reflecting non symmetric pair");
+                  ifill += def->FillPair(evMix, evMain, &fValues, kFALSE);
+               }
             }
          }
+         if (!inMemory) delete evMain;
       }
-      delete list;
    }
 
-   delete [] smatched;
+   for (ievt = 0; ievt < (Int_t)evStore.size(); ievt++) delete evStore[ievt];
 
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
@@ -740,6 +757,150 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    if (fRsnTreeInFile) PostData(2, fEvBuffer);
 }
 
+//__________________________________________________________________________________________________
+/// Fill all pair-based outputs using several threads.
+/// The events are distributed over the threads (thread i takes the events i, i+n, i+2n, ...),
+/// and each thread fills its own clones of the output histograms, which are added to the
+/// original ones in the thread order at the end, so that the result does not depend on the
+/// scheduling. Each thread computes the values in its own copy of the value list. Outputs with
+/// pair cuts, which are not thread safe, or with a PhiV axis, which draws the pair ordering from
+/// gRandom, are filled on the original histograms by the main thread once the workers are done.
+/// The leading particle of each event, otherwise searched at its first use, is found beforehand.
+///
+/// \param events Decoded mini-events
+/// \param matched List of the mixing partners of each event
+///
+void AliRsnMiniAnalysisTask::FillPairsParallel(const std::vector<AliRsnMiniEvent*> &events, const std::vector< std::vector<Int_t> > &matched)
+{
+   Int_t nEvents = (Int_t)events.size();
+   Int_t nThreads = TMath::Min(fNThreads, nEvents);
+   if (nThreads < 1) return;
+
+   // split the pair-based outputs in the ones which can be cloned and the others,
+   // and find which momenta (MC or not) the first leading particle value uses
+   TObjArray sharedDefs, serialDefs;
+   Int_t idef, iaxis, nDefs = fHistograms.GetEntries();
+   Int_t leadingMC = -1;
+   for (idef = 0; idef < nDefs; idef++) {
+      AliRsnMiniOutput *def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      Bool_t useRandom = kFALSE;
+      AliRsnMiniAxis *axis = 0x0;
+      for (iaxis = 0; (axis = def->GetAxis(iaxis)); iaxis++) {
+         AliRsnMiniValue *val = (AliRsnMiniValue *)fValues[axis->GetValueID()];
+         if (!val) continue;
+         switch (val->GetType()) {
+            case AliRsnMiniValue::kLeadingPt:
+            case AliRsnMiniValue::kAngleLeading:
+               if (leadingMC < 0) leadingMC = val->GetUseMCInfo();
+               break;
+            case AliRsnMiniValue::kPhiV:
+               useRandom = kTRUE;
+               break;
+            default:
+               break;
+         }
+      }
+      if (!def->GetOutput()) continue;
+      switch (def->GetComputation()) {
+         case AliRsnMiniOutput::kTruePair:
+         case AliRsnMiniOutput::kTrackPair:
+         case AliRsnMiniOutput::kTrackPairMix:
+         case AliRsnMiniOutput::kTrackPairRotated1:
+         case AliRsnMiniOutput::kTrackPairRotated2:
+            if (def->GetPairCuts() || useRandom) serialDefs.Add(def); else sharedDefs.Add(def);
+            break;
+         default:
+            break;
+      }
+   }
+   if (leadingMC >= 0) {
+      for (Int_t ievt = 0; ievt < nEvents; ievt++) events[ievt]->LeadingParticle(leadingMC);
+   }
+   AliInfo(Form("[%s] Filling pairs with %d threads (%d outputs on the main thread)", GetName(), nThreads, serialDefs.GetEntries()));
+
+   // one copy of the outputs and of their histograms per thread
+   Bool_t addDir = TH1::AddDirectoryStatus();
+   TH1::AddDirectory(kFALSE);
+   std::vector<TObjArray*>    workerDefs(nThreads);
+   std::vector<TList*>        workerLists(nThreads);
+   std::vector<TClonesArray*> workerValues(nThreads);
+   Int_t iw, nShared = sharedDefs.GetEntries();
+   for (iw = 0; iw < nThreads; iw++) {
+      workerValues[iw] = new TClonesArray(fValues);
+      workerDefs[iw] = new TObjArray(nShared);
+      workerDefs[iw]->SetOwner();
+      workerLists[iw] = new TList;
+      workerLists[iw]->SetOwner();
+      for (idef = 0; idef < nShared; idef++) {
+         AliRsnMiniOutput *def = (AliRsnMiniOutput *)sharedDefs[idef];
+         TObject *obj = def->GetOutput()->Clone();
+         if (obj->InheritsFrom(THnBase::Class())) ((THnBase *)obj)->Reset(); else ((TH1 *)obj)->Reset();
+         workerLists[iw]->Add(obj);
+         AliRsnMiniOutput *copy = new AliRsnMiniOutput(*def);
+         copy->SetOutput(workerLists[iw], idef);
+         workerDefs[iw]->Add(copy);
+      }
+   }
+   TH1::AddDirectory(addDir);
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+   ROOT::EnableThreadSafety();
+#endif
+   std::vector<std::thread> workers;
+   for (iw = 0; iw < nThreads; iw++) {
+      workers.push_back(std::thread(&AliRsnMiniAnalysisTask::FillPairsRange, this, iw, nThreads,
+                                    std::cref(events), std::cref(matched), workerDefs[iw], workerValues[iw]));
+   }
+   for (iw = 0; iw < nThreads; iw++) workers[iw].join();
+   if (serialDefs.GetEntries() > 0) FillPairsRange(0, 1, events, matched, &serialDefs, &fValues);
+
+   // merge in thread order
+   for (iw = 0; iw < nThreads; iw++) {
+      for (idef = 0; idef < nShared; idef++) {
+         TObject *obj = ((AliRsnMiniOutput *)sharedDefs[idef])->GetOutput();
+         TObject *part = workerLists[iw]->At(idef);
+         if (obj->InheritsFrom(THnBase::Class())) ((THnBase *)obj)->Add((THnBase *)part); else ((TH1 *)obj)->Add((TH1 *)part);
+      }
+      delete workerDefs[iw];
+      delete workerLists[iw];
+      delete workerValues[iw];
+   }
+}
+
+//__________________________________________________________________________________________________
+/// Fill the pair-based outputs in the list for the events first, first+step, ...
+/// Same-event pairs (true, track, rotated) are built within each event, mixed pairs
+/// with each of its partners, as in the serial filling.
+///
+/// \param first First event
+/// \param step Step between two events
+/// \param events Decoded mini-events
+/// \param matched List of the mixing partners of each event
+/// \param defs Outputs to be filled
+/// \param values List of values to be computed, not shared with other threads
+///
+void AliRsnMiniAnalysisTask::FillPairsRange(Int_t first, Int_t step, const std::vector<AliRsnMiniEvent*> &events,
+                                            const std::vector< std::vector<Int_t> > &matched, TObjArray *defs, TClonesArray *values)
+{
+   Int_t ievt, idef, nEvents = (Int_t)events.size(), nDefs = defs->GetEntriesFast();
+   for (ievt = first; ievt < nEvents; ievt += step) {
+      AliRsnMiniEvent *evMain = events[ievt];
+      for (idef = 0; idef < nDefs; idef++) {
+         AliRsnMiniOutput *def = (AliRsnMiniOutput *)defs->At(idef);
+         if (!def->IsTrackPairMix()) {
+            def->FillPair(evMain, evMain, values);
+            continue;
+         }
+         for (UInt_t im = 0; im < matched[ievt].size(); im++) {
+            AliRsnMiniEvent *evMix = events[matched[ievt][im]];
+            def->FillPair(evMain, evMix, values, kTRUE);
+            if (!def->IsSymmetric()) def->FillPair(evMix, evMain, values, kFALSE);
+         }
+      }
+   }
+}
+
 //__________________________________________________________________________________________________
 /// Terminate function. 
 /// Called only once at the end.
@@ -1678,33 +1839,32 @@ void AliRsnMiniAnalysisTask::SetDselection(UShort_t originDselection)
 Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2)
 {
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+/// Same as above, on the event variables used for the mixing.
+///
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
-      if (dv > fMaxDiffVz) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
-         return kFALSE;
-      }
-      if (dm > fMaxDiffMult ) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Mult = %f", event1->ID(), event2->ID(), dm));
-         return kFALSE;
-      }
-      if (da > fMaxDiffAngle) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Angle = %f", event1->ID(), event2->ID(), da));
-         return kFALSE;
-      }
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
+      if (dv > fMaxDiffVz) return kFALSE;
+      if (dm > fMaxDiffMult ) return kFALSE;
+      if (da > fMaxDiffAngle) return kFALSE;
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1712,6 +1872,89 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+/// Search of the mixing partners of each event.
+/// The events are indexed once on their mixing variables, so that the candidates
+/// of each event are only the ones in the same (vz, mult, angle) bin for the binned
+/// mixing, or in the vz window for the continuous one, instead of all buffered events.
+/// The candidates are then tried in the same order as a scan of the buffer starting
+/// after the main event, so that the result is identical to the exhaustive search:
+/// each pair is used once, and each event gets at most fNMix partners.
+///
+/// \param vz, mult, angle Mixing variables of all buffered events
+/// \param matched Output: list of the partners to be mixed with each event
+/// \param printNum How often the progress is printed
+///
+void AliRsnMiniAnalysisTask::FindMixingPartners(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult,
+                                                const std::vector<Float_t> &angle, std::vector< std::vector<Int_t> > &matched,
+                                                Int_t printNum)
+{
+   Int_t ievt, imix, ic, nEvents = (Int_t)vz.size();
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector<Int_t> candidates;
+
+   // index of the events, sorted on vz (continuous) or on the mixing bin (binned),
+   // and position of each event in the index
+   std::vector<Int_t> order(nEvents), position(nEvents);
+   std::vector<Int_t> bin;
+   for (ievt = 0; ievt < nEvents; ievt++) order[ievt] = ievt;
+   if (fContinuousMix) {
+      std::stable_sort(order.begin(), order.end(), [&vz](Int_t a, Int_t b) {return vz[a] < vz[b];});
+   } else {
+      bin.resize(3 * nEvents);
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         bin[3 * ievt]     = (Int_t)(vz[ievt]    / fMaxDiffVz);
+         bin[3 * ievt + 1] = (Int_t)(mult[ievt]  / fMaxDiffMult);
+         bin[3 * ievt + 2] = (Int_t)(angle[ievt] / fMaxDiffAngle);
+      }
+      std::stable_sort(order.begin(), order.end(), [&bin](Int_t a, Int_t b) {
+         return std::lexicographical_compare(&bin[3 * a], &bin[3 * a + 3], &bin[3 * b], &bin[3 * b + 3]);
+      });
+   }
+   for (ievt = 0; ievt < nEvents; ievt++) position[order[ievt]] = ievt;
+
+   for (ievt = 0; ievt < nEvents; ievt++) {
+      if (printNum&&(ievt%printNum==0)) AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
+      if (nmatched[ievt] >= fNMix) continue;
+      // range of the index which can contain matching events
+      Int_t first = position[ievt], last = position[ievt] + 1;
+      if (fContinuousMix) {
+         Float_t vzMain = vz[ievt];
+         Double_t maxDiffVz = fMaxDiffVz;
+         first = std::partition_point(order.begin(), order.end(),
+                                      [&](Int_t j) {return TMath::Abs(vzMain - vz[j]) > maxDiffVz && vz[j] < vzMain;}) - order.begin();
+         last  = std::partition_point(order.begin(), order.end(),
+                                      [&](Int_t j) {return !(TMath::Abs(vz[j] - vzMain) > maxDiffVz && vz[j] > vzMain);}) - order.begin();
+      } else {
+         while (first > 0 && std::equal(&bin[3 * order[first - 1]], &bin[3 * order[first - 1] + 3], &bin[3 * ievt])) first--;
+         while (last < nEvents && std::equal(&bin[3 * order[last]], &bin[3 * order[last] + 3], &bin[3 * ievt])) last++;
+      }
+      // candidates, in the order of a scan of the buffer starting after the main event
+      candidates.clear();
+      for (ic = first; ic < last; ic++) {
+         imix = order[ic];
+         if (imix == ievt) continue;
+         if (!EventsMatch(vz[ievt], mult[ievt], angle[ievt], vz[imix], mult[imix], angle[imix])) continue;
+         candidates.push_back(imix < ievt ? imix + nEvents : imix);
+      }
+      std::sort(candidates.begin(), candidates.end());
+      for (ic = 0; ic < (Int_t)candidates.size(); ic++) {
+         imix = candidates[ic];
+         if (imix >= nEvents) imix -= nEvents;
+         // check that the found good event has not enough matches already
+         if (nmatched[imix] >= fNMix) continue;
+         // check that the list of good matches for the mixed event does not already contain the main event
+         if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
+         // add new mixing candidate
+         matched[ievt].push_back(imix);
+         nmatched[ievt]++;
+         nmatched[imix]++;
+         if (nmatched[ievt] >= fNMix) break;
+      }
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
+   }
+}
+
 //---------------------------------------------------------------------
 /// Patch to be used with 2011 Pb-Pb data for flat centrality distribution
 ///
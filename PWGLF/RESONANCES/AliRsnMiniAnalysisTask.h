@@ -15,6 +15,8 @@
 #ifndef ALIRSNMINIANALYSISTASK_H
 #define ALIRSNMINIANALYSISTASK_H
 
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -70,6 +72,8 @@ public:
    void                SetUseTimeRangeCut(Bool_t use = kTRUE)   {fUseTimeRangeCut    = use;}
    void                SetEventCuts(AliRsnCutSet *cuts)   {fEventCuts    = cuts;}
    void                SetMixPrintRefresh(Int_t n)        {fMixPrintRefresh = n;}
+   void                SetMixInMemory(Bool_t yn = kTRUE)  {fMixInMemory = yn;}
+   void                SetNThreads(Int_t n)               {fNThreads = n;}
    void                SetCheckDecay(Bool_t checkDecay = kTRUE) {fCheckDecay = checkDecay;}
    void                SetMaxNDaughters(Short_t n)        {fMaxNDaughters = n;}
    void                SetCheckMomentumConservation(Bool_t checkP) {fCheckP = checkP;}
@@ -120,6 +124,12 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   void     FindMixingPartners(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle,
+                               std::vector< std::vector<Int_t> > &matched, Int_t printNum);
+   void     FillPairsParallel(const std::vector<AliRsnMiniEvent*> &events, const std::vector< std::vector<Int_t> > &matched);
+   void     FillPairsRange(Int_t first, Int_t step, const std::vector<AliRsnMiniEvent*> &events,
+                           const std::vector< std::vector<Int_t> > &matched, TObjArray *defs, TClonesArray *values);
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list, const char *subdetector, const char *expectedstep) const;
 
    Bool_t               fUseMC;           ///<  use or not MC info
@@ -164,6 +174,8 @@ private:
    AliRsnMiniEvent     *fMiniEvent;       ///< mini-event cursor
    Bool_t               fBigOutput;       ///< flag if open file for output list
    Int_t                fMixPrintRefresh; ///< how often info in mixing part is printed
+   Bool_t               fMixInMemory;     ///< keep the decoded mini-events in memory during the mixing, instead of reading them back from the buffer
+   Int_t                fNThreads;        ///< number of threads used to fill the pairs in FinishTaskOutput (implies fMixInMemory)
    Bool_t               fCheckDecay;      ///< check if the mother decayed via the requested channel
    Short_t              fMaxNDaughters;   ///< maximum number of allowed mother's daughter
    Bool_t               fCheckP;          ///< flag to set in order to check the momentum conservation for mothers
@@ -183,7 +195,7 @@ private:
    TObjArray            fResonanceFinders;  ///< list of AliRsnMiniResonanceFinder objects
 
 /// \cond CLASSIMP
-   ClassDef(AliRsnMiniAnalysisTask, 22);     
+   ClassDef(AliRsnMiniAnalysisTask, 24);     
 /// \endcond
 };
 
@@ -205,13 +205,13 @@ AliRsnMiniOutput::AliRsnMiniOutput(const AliRsnMiniOutput &copy) :
    fList(copy.fList),
    fSel1(0),
    fSel2(0),
-   fMaxNSisters(-1),
-   fCheckP(kFALSE),
-   fCheckFeedDown(kFALSE),
-   fOriginDselection(kFALSE),
-   fKeepDfromB(kFALSE),
-   fKeepDfromBOnly(kFALSE),
-   fRejectIfNoQuark(kFALSE),
+   fMaxNSisters(copy.fMaxNSisters),
+   fCheckP(copy.fCheckP),
+   fCheckFeedDown(copy.fCheckFeedDown),
+   fOriginDselection(copy.fOriginDselection),
+   fKeepDfromB(copy.fKeepDfromB),
+   fKeepDfromBOnly(copy.fKeepDfromBOnly),
+   fRejectIfNoQuark(copy.fRejectIfNoQuark),
    fCheckHistRange(copy.fCheckHistRange),
    fCheckSameCutID(copy.fCheckSameCutID)
 {
@@ -262,7 +262,7 @@ AliRsnMiniOutput &AliRsnMiniOutput::operator=(const AliRsnMiniOutput &copy)
    fCheckP = copy.fCheckP;
    fCheckFeedDown = copy.fCheckFeedDown;
    fOriginDselection = copy.fOriginDselection;
-   fKeepDfromB = copy.fOriginDselection;
+   fKeepDfromB = copy.fKeepDfromB;
    fKeepDfromBOnly = copy.fKeepDfromBOnly;
    fRejectIfNoQuark = copy.fRejectIfNoQuark;
    fCheckHistRange = copy.fCheckHistRange;
@@ -764,6 +764,17 @@ void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
 	
 	return;
 }
+//________________________________________________________________________________________
+TObject *AliRsnMiniOutput::GetOutput() const
+{
+//
+// Returns the output object filled by this definition, if initialized
+//
+
+   if (!fList) return 0x0;
+   return fList->At(fOutputID);
+}
+
 //________________________________________________________________________________________
 void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList)
 {
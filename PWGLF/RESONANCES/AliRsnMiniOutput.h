@@ -85,6 +85,9 @@ public:
    Bool_t          GetFillHistogramOnlyInRange() { return fCheckHistRange; }
    Short_t         GetMaxNSisters()           {return fMaxNSisters;}
    Bool_t          GetCheckSameCutID()  const {return fCheckSameCutID;}
+   AliRsnCutSet   *GetPairCuts()        const {return fPairCuts;}
+   TObject        *GetOutput()          const;
+   void            SetOutput(TList *list, Int_t id)   {fList = list; fOutputID = id;}
 
    void            SetOutputType(EOutputType type)    {fOutputType = type;}
    void            SetComputation(EComputation src)   {fComputation = src;}
@@ -68,6 +68,7 @@ public:
    EType              GetType()      const  {return fType;}
    const char        *GetTypeName()  const  {return TypeName(fType);}
    Bool_t             IsEventValue() const  {return (fType < kEventCuts);}
+   Bool_t             GetUseMCInfo() const  {return fUseMCInfo;}
 
    Float_t            Eval(AliRsnMiniPair *pair, AliRsnMiniEvent *event = 0x0);
 
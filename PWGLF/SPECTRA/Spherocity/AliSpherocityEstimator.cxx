@@ -6,6 +6,7 @@ default cuts set.
 Written by Vytautas Vislavicius
 */
 #include "AliSpherocityEstimator.h"
+#include "AliEventShapeUtils.h"
 ClassImp(AliSpherocityEstimator)
 AliSpherocityEstimator::AliSpherocityEstimator():
   TNamed(),
@@ -58,9 +59,6 @@ Double_t AliSpherocityEstimator::GetSpherocity(AliVEvent *inevent) {
   if(inevent->GetNumberOfTracks()<fMinMulti) return -2;//if not enough tracks (1st check), return -2
   fTrackMulti=0;
   AliVTrack *track; //Create pointer here, not for each track
-  Double_t sumpt=0;
-  std::vector<Double_t> nx;
-  std::vector<Double_t> ny;
   std::vector<Double_t> px;
   std::vector<Double_t> py;
   for(Int_t itrk=0;itrk<inevent->GetNumberOfTracks();++itrk) {
@@ -77,36 +75,14 @@ Double_t AliSpherocityEstimator::GetSpherocity(AliVEvent *inevent) {
     } else if(!fSphTrackCuts->AcceptTrack((AliESDtrack*)track)) continue;
     Double_t pt = track->Pt();
     if(pt<fMinPt) continue;
-    sumpt+=pt;
     Double_t phi = track->Phi();
-    nx.push_back(TMath::Cos(phi));
-    ny.push_back(TMath::Sin(phi));
-    px.push_back(pt*nx[fTrackMulti]);
-    py.push_back(pt*ny[fTrackMulti]);
+    px.push_back(pt*TMath::Cos(phi));
+    py.push_back(pt*TMath::Sin(phi));
     ++fTrackMulti;
   };
-  if(fTrackMulti<fMinMulti) {
-    px.clear();
-    py.clear();
-    nx.clear();
-    ny.clear();
-    return -2; //if not enought tracks
-  };
-  //Calculating spherocity now
-  Double_t retval=2; //Return value should be the minimal value in range 0..1, so 2 is a good starting point.
-  for(Int_t i=0; i<fTrackMulti; i++) {
-    Double_t num=0;
-    for(Int_t j=0;j<fTrackMulti;j++)
-      num+=TMath::Abs(ny[i]*px[j] -nx[i]*py[j]);
-    Double_t sFull = TMath::Power((num/sumpt),2);
-    if(sFull < retval)
-      retval = sFull;
-  };
-  px.clear();
-  py.clear();
-  nx.clear();
-  ny.clear();
-  if(retval>1) return -3; //If sph>1, something went wrong
-  retval=retval*TMath::Pi()*TMath::Pi()/4; //normalization
+  if(fTrackMulti<fMinMulti) return -2; //if not enought tracks
+  //Calculating spherocity now, minimum over the axes along the tracks in O(N log N)
+  Double_t retval = AliEventShapeUtils::Spherocity(fTrackMulti, &px[0], &py[0]);
+  if(retval>TMath::Pi()*TMath::Pi()/4) return -3; //If sph>1, something went wrong
   return retval;
 };
@@ -17,18 +17,26 @@
 
 #include <TChain.h>
 #include <TFile.h>
+#include <TList.h>
+#include <TParameter.h>
+#include <TTree.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
+#include "AliAnalysisDataContainer.h"
+#include "AliAnalysisDataSlot.h"
 #include "AliAnalysisManager.h"
 #include "AliCDBManager.h"
 #include "AliESDEvent.h"
 #include "AliESDInputHandler.h"
+#include "AliESDHeader.h"
 #include "AliLog.h"
 
 
 ClassImp(AliTender)
 
+const Int_t AliTender::fgkFriendVersion = 2;
+
 //______________________________________________________________________________
 AliTender::AliTender():
            AliAnalysisTaskSE(),
@@ -41,7 +49,19 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fFriendMode(kNoFriend),
+           fFriendFileName(),
+           fFriendFile(NULL),
+           fFriendTree(NULL),
+           fFriendSupplies(NULL),
+           fFriendRun(0),
+           fFriendEventID(0),
+           fFriendNTracks(0),
+           fFriendIndex(),
+           fNFriendMissing(0),
+           fNFriendAmbiguous(0),
+           fNFriendMismatch(0)
 {
 // Dummy constructor
 }
@@ -58,7 +78,19 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fFriendMode(kNoFriend),
+           fFriendFileName(),
+           fFriendFile(NULL),
+           fFriendTree(NULL),
+           fFriendSupplies(NULL),
+           fFriendRun(0),
+           fFriendEventID(0),
+           fFriendNTracks(0),
+           fFriendIndex(),
+           fNFriendMissing(0),
+           fNFriendAmbiguous(0),
+           fNFriendMismatch(0)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -72,6 +104,11 @@ AliTender::~AliTender()
     fSupplies->Delete();
     delete fSupplies;
   }
+  delete fFriendSupplies;
+  if (fFriendFile) {
+    fFriendFile->Close();
+    delete fFriendFile;
+  }
 }
 
 //______________________________________________________________________________
@@ -142,6 +179,100 @@ void AliTender::UserCreateOutputObjects()
      fESDhandler->SetUserCallSelectionMask(kTRUE);
      Info("UserCreateOutputObjects","The TENDER will check the event selection. Make sure you add the tender as FIRST wagon!");
   }   
+  if (fFriendMode != kNoFriend) OpenFriendTree();
+}
+
+//______________________________________________________________________________
+void AliTender::OpenFriendTree()
+{
+// Create the friend tree (kWriteFriend) or open it and index its entries by
+// run and event id (kReadFriend), then connect the branches of the supplies.
+// Event ids found in several entries, as in MC productions without bc, orbit
+// and period, are marked as ambiguous and their events processed by the supplies.
+  TDirectory *owd = gDirectory;
+  Bool_t write = (fFriendMode == kWriteFriend);
+  if (write && IsFriendOutputConnected()) {
+    // file of the output container, handled by the analysis manager
+    if (!OpenFile(2)) AliFatal("Cannot open the file of the friend tree output container");
+  } else {
+    if (!fFriendFileName.Length()) AliFatal("Friend tree file not set.");
+    if (write) AliWarning(Form("Friend tree output not connected, %s is written in the working directory and not kept by grid, train or PROOF jobs", fFriendFileName.Data()));
+    fFriendFile = TFile::Open(fFriendFileName, write ? "RECREATE" : "READ");
+    if (!fFriendFile || fFriendFile->IsZombie()) AliFatal(Form("Cannot open friend tree file %s", fFriendFileName.Data()));
+  }
+  if (write) {
+    fFriendTree = new TTree("TenderFriend", "Outputs of the tender supplies");
+    fFriendTree->GetUserInfo()->Add(new TParameter<Int_t>("version", fgkFriendVersion));
+    fFriendTree->Branch("run", &fFriendRun, "run/I");
+    fFriendTree->Branch("eventID", &fFriendEventID, "eventID/l");
+    fFriendTree->Branch("ntracks", &fFriendNTracks, "ntracks/I");
+  } else {
+    fFriendTree = dynamic_cast<TTree*>(fFriendFile->Get("TenderFriend"));
+    if (!fFriendTree) AliFatal(Form("No tender friend tree in %s", fFriendFileName.Data()));
+    TParameter<Int_t> *version = dynamic_cast<TParameter<Int_t>*>(fFriendTree->GetUserInfo()->FindObject("version"));
+    if (!version || version->GetVal() != fgkFriendVersion)
+      AliFatal(Form("Tender friend tree version %d, expected %d", version ? version->GetVal() : -1, fgkFriendVersion));
+    fFriendTree->SetBranchAddress("run", &fFriendRun);
+    fFriendTree->SetBranchAddress("eventID", &fFriendEventID);
+    fFriendTree->SetBranchAddress("ntracks", &fFriendNTracks);
+    // Only the keys are read to build the index
+    TBranch *brRun = fFriendTree->GetBranch("run");
+    TBranch *brID = fFriendTree->GetBranch("eventID");
+    Long64_t nentries = fFriendTree->GetEntries();
+    Long64_t nambiguous = 0;
+    for (Long64_t ientry=0; ientry<nentries; ientry++) {
+      brRun->GetEntry(ientry);
+      brID->GetEntry(ientry);
+      std::pair<std::map<std::pair<Int_t,ULong64_t>,Long64_t>::iterator,bool> ins =
+         fFriendIndex.insert(std::make_pair(std::make_pair(fFriendRun, fFriendEventID), ientry));
+      if (ins.second) continue;
+      // same key as an earlier entry, the event cannot be identified
+      if (ins.first->second >= 0) nambiguous++;
+      ins.first->second = -1;
+    }
+    Info("OpenFriendTree", "%lld events indexed from %s", nentries, fFriendFileName.Data());
+    if (nambiguous)
+      AliWarning(Form("%lld event ids found in several entries of %s, their events are processed by the supplies", nambiguous, fFriendFileName.Data()));
+  }
+  fFriendSupplies = new TObjArray();
+  TIter next(fSupplies);
+  AliTenderSupply *supply;
+  while ((supply=(AliTenderSupply*)next())) {
+    if (supply->ConnectFriendBranches(fFriendTree, write)) fFriendSupplies->Add(supply);
+    else Info("OpenFriendTree", "Tender supply %s processes all events", supply->GetName());
+  }
+  if (write && !fFriendFile) PostData(2, fFriendTree);
+  if (owd) owd->cd();
+}
+
+//______________________________________________________________________________
+Bool_t AliTender::IsFriendOutputConnected() const
+{
+// The friend tree output slot is connected to a container.
+  return (GetNoutputs() > 2 && GetOutputSlot(2)->GetContainer());
+}
+
+//______________________________________________________________________________
+Bool_t AliTender::LoadFriendEvent()
+{
+// Read the friend tree entry of the current event, kFALSE if not found, if
+// its event id is ambiguous or if the entry has not the tracks of the event.
+  std::map<std::pair<Int_t,ULong64_t>,Long64_t>::const_iterator it =
+     fFriendIndex.find(std::make_pair(fESD->GetRunNumber(), fESD->GetHeader()->GetEventIdAsLong()));
+  if (it == fFriendIndex.end()) {
+    if (!fNFriendMissing++) AliWarning("Events not found in the friend tree are processed by the supplies");
+    return kFALSE;
+  }
+  if (it->second < 0) {
+    fNFriendAmbiguous++;
+    return kFALSE;
+  }
+  if (fFriendTree->GetEntry(it->second) <= 0) return kFALSE;
+  if (fFriendNTracks != fESD->GetNumberOfTracks()) {
+    if (!fNFriendMismatch++) AliWarning("Events with a number of tracks different from the friend tree are processed by the supplies");
+    return kFALSE;
+  }
+  return kTRUE;
 }
 
 //______________________________________________________________________________
@@ -170,9 +301,23 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
+  Bool_t fromFriend = (fFriendMode == kReadFriend) && LoadFriendEvent();
   TIter next(fSupplies);
   AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  while ((supply=(AliTenderSupply*)next())) {
+    if (fromFriend && fFriendSupplies->FindObject(supply)) supply->ApplyFriendEvent();
+    else supply->ProcessEvent();
+  }
+  if (fFriendMode == kWriteFriend) {
+    fFriendRun = fESD->GetRunNumber();
+    fFriendEventID = fESD->GetHeader()->GetEventIdAsLong();
+    fFriendNTracks = fESD->GetNumberOfTracks();
+    next.Reset();
+    while ((supply=(AliTenderSupply*)next())) {
+      if (fFriendSupplies->FindObject(supply)) supply->FillFriendEvent();
+    }
+    fFriendTree->Fill();
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -181,6 +326,40 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::FinishTaskOutput()
+{
+// Write the friend tree, or post it to its output container.
+  if (fFriendMode == kReadFriend && fNFriendMissing)
+    AliWarning(Form("%lld events not found in the friend tree %s", fNFriendMissing, fFriendFileName.Data()));
+  if (fFriendMode == kReadFriend && fNFriendAmbiguous)
+    AliWarning(Form("%lld events with an ambiguous event id in the friend tree %s", fNFriendAmbiguous, fFriendFileName.Data()));
+  if (fFriendMode == kReadFriend && fNFriendMismatch)
+    AliWarning(Form("%lld events with a different number of tracks in the friend tree %s", fNFriendMismatch, fFriendFileName.Data()));
+  if (fFriendMode != kWriteFriend || !fFriendTree) return;
+  if (!fFriendFile) {
+    PostData(2, fFriendTree);
+    return;
+  }
+  TDirectory *owd = gDirectory;
+  fFriendFile->cd();
+  fFriendTree->Write();
+  fFriendFile->Close();
+  delete fFriendFile;
+  fFriendFile = NULL;
+  fFriendTree = NULL;
+  if (owd) owd->cd();
+}
+
+//______________________________________________________________________________
+void AliTender::SetFriendMode(EFriendMode mode, const char *fileName)
+{
+// Set the friend tree mode, in write mode the tree goes to the output slot 2.
+  fFriendMode = mode;
+  fFriendFileName = fileName;
+  if (mode == kWriteFriend && GetNoutputs() < 3) DefineOutput(2, TTree::Class());
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
@@ -13,6 +13,9 @@
 //      during pass1 reconstruction.
 //==============================================================================
 
+#include <map>
+#include <utility>
+
 #ifndef ALIANALYSISTASKSE_H
 #include "AliAnalysisTaskSE.h"
 #endif
@@ -24,6 +27,8 @@ class AliCDBManager;
 class AliESDEvent;
 class AliESDInputHandler;
 class AliTenderSupply;
+class TFile;
+class TTree;
 
 class AliTender : public AliAnalysisTaskSE {
 
@@ -31,6 +36,11 @@ public:
 enum ETenderFlags {
    kCheckEventSelection = BIT(18) // up to 18 used by AliAnalysisTask
 };
+enum EFriendMode {
+   kNoFriend    = 0,  // supplies process all events
+   kWriteFriend = 1,  // supplies process all events, their outputs are written to the friend tree
+   kReadFriend  = 2   // supplies apply their outputs from the friend tree, events not found there are processed
+};
    
 private:
   Int_t                     fRun;            //! Current run
@@ -43,6 +53,24 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  Int_t                     fFriendMode;     // Friend tree mode (EFriendMode)
+  TString                   fFriendFileName; // File of the friend tree
+  TFile                    *fFriendFile;     //! File of the friend tree
+  TTree                    *fFriendTree;     //! Friend tree with the supply outputs
+  TObjArray                *fFriendSupplies; //! Supplies with branches in the friend tree
+  Int_t                     fFriendRun;      //! Run of the friend tree entry
+  ULong64_t                 fFriendEventID;  //! Event id (bc, orbit, period) of the friend tree entry
+  Int_t                     fFriendNTracks;  //! Number of tracks of the friend tree entry
+  std::map<std::pair<Int_t,ULong64_t>,Long64_t> fFriendIndex; //! Friend tree entry of each (run, event id), -1 if not unique
+  Long64_t                  fNFriendMissing; //! Events not found in the friend tree
+  Long64_t                  fNFriendAmbiguous; //! Events with an event id found in several friend tree entries
+  Long64_t                  fNFriendMismatch; //! Events with a number of tracks different from the friend tree entry
+
+  static const Int_t        fgkFriendVersion; // Version of the friend tree layout
+  
+  void                      OpenFriendTree();
+  Bool_t                    IsFriendOutputConnected() const;
+  Bool_t                    LoadFriendEvent();
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
@@ -68,13 +96,29 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Write the quantities modified by the supplies to a friend tree keyed by
+   * run and event id (kWriteFriend), or apply them from it instead of running
+   * the supplies (kReadFriend). Only supplies implementing the friend branches
+   * take part, the others process the events as usual, as do the events whose
+   * event id is not unique in the tree or whose number of tracks differs.
+   * In write mode the tree is published in the output slot 2, to be connected
+   * to a special output container (see AddTaskTender.C) so that grid, LEGO
+   * train and PROOF jobs keep and merge it. If the slot is not connected, the
+   * tree is written to fileName in the working directory (local jobs only).
+   * @param[in] mode     EFriendMode
+   * @param[in] fileName File of the friend tree read, or written without container
+   */
+  void                      SetFriendMode(EFriendMode mode, const char *fileName="TenderFriend.root");
+  Int_t                     GetFriendMode() const {return fFriendMode;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
   virtual void              UserCreateOutputObjects();
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
+  virtual void              FinishTaskOutput();
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
@@ -15,6 +15,7 @@
 #endif
 
 class AliTender;
+class TTree;
 
 class AliTenderSupply : public TNamed {
 
@@ -31,6 +32,14 @@ public:
   // Run control
   virtual void              Init() = 0;
   virtual void              ProcessEvent() = 0;
+  // Friend tree with the supply outputs (see AliTender::SetFriendMode). A supply
+  // writing its outputs creates its branches (write=kTRUE) or connects them
+  // (write=kFALSE) and returns kTRUE, FillFriendEvent() is called after
+  // ProcessEvent() and ApplyFriendEvent() replaces ProcessEvent() when the event
+  // was found in the friend tree.
+  virtual Bool_t            ConnectFriendBranches(TTree * /*tree*/, Bool_t /*write*/) {return kFALSE;}
+  virtual void              FillFriendEvent() {}
+  virtual void              ApplyFriendEvent() {ProcessEvent();}
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
     
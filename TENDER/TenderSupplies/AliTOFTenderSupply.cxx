@@ -28,12 +28,14 @@
 
 #include <TMath.h>
 #include <TRandom.h>
+#include <TTree.h>
 #include <AliLog.h>
 #include <AliESDEvent.h>
 #include <AliESDtrack.h>
 #include <AliESDInputHandler.h>
 #include <AliAnalysisManager.h>
 #include <AliESDpid.h>
+#include <AliTOFHeader.h>
 #include <AliTender.h>
 
 #include <AliTOFcalib.h>
@@ -85,7 +87,9 @@ AliTOFTenderSupply::AliTOFTenderSupply() :
   fRhoTRDout(366.38), // cm
   fStep(0.5),
   fMagField(0.),
-  fCDBkey(0)
+  fCDBkey(0),
+  fFriendTOFsignal(0x0),
+  fFriendTOFHeader(0x0)
 
 
 
@@ -97,6 +101,7 @@ AliTOFTenderSupply::AliTOFTenderSupply() :
   fT0shift[1] = 0;
   fT0shift[2] = 0;
   fT0shift[3] = 0;
+  for (Int_t i=0;i<3;i++) fFriendT0TOF[i]=0;
 }
 
 //_____________________________________________________
@@ -128,7 +133,9 @@ AliTOFTenderSupply::AliTOFTenderSupply(const char *name, const AliTender *tender
   fRhoTRDout(366.38), // cm
   fStep(0.5),
   fMagField(0.),
-  fCDBkey(0)
+  fCDBkey(0),
+  fFriendTOFsignal(0x0),
+  fFriendTOFHeader(0x0)
  
 {
   //
@@ -139,6 +146,7 @@ AliTOFTenderSupply::AliTOFTenderSupply(const char *name, const AliTender *tender
   fT0shift[1] = 0;
   fT0shift[2] = 0;
   fT0shift[3] = 0;
+  for (Int_t i=0;i<3;i++) fFriendT0TOF[i]=0;
 }
 
 //_____________________________________________________
@@ -313,41 +321,60 @@ void AliTOFTenderSupply::ProcessEvent()
 
 
     
-  if (fTender->RunChanged()){ 
+  if (fTender->RunChanged()) InitRun();
 
-    Init();
+  if (fTenderNoAction) return;
 
-    if (fTenderNoAction) return;            
-    Int_t versionNumber = GetOCDBVersion(fTender->GetRun());
-    fTOFCalib->SetRunParamsSpecificVersion(versionNumber);
-    fTOFCalib->Init(fTender->GetRun());
-    
-    if(event->GetT0TOF()){ // read T0 detector correction from OCDB
-	// OCDB instance
-	if (fT0DetectorAdjust) {
-	  AliCDBManager* ocdbMan = AliCDBManager::Instance();
-	  ocdbMan->SetRun(fTender->GetRun());    
-	  AliCDBEntry *entry = ocdbMan->Get("T0/Calib/TimeAdjust/");
-	  if(entry) {
-	    AliT0CalibSeasonTimeShift *clb = (AliT0CalibSeasonTimeShift*) entry->GetObject();
-	    Float_t *t0means= clb->GetT0Means();
-	    //      Float_t *t0sigmas = clb->GetT0Sigmas();
-	    fT0shift[0] = t0means[0] + fT0IntercalibrationShift;
-	    fT0shift[1] = t0means[1] + fT0IntercalibrationShift;
-	    fT0shift[2] = t0means[2] + fT0IntercalibrationShift;
-	    fT0shift[3] = t0means[3] + fT0IntercalibrationShift;
-	  } else {
-	    for (Int_t i=0;i<4;i++) fT0shift[i]=0;
-	    AliWarning("TofTender no T0 entry found T0shift set to 0");
-	  }
-	} else {
-	  for (Int_t i=0;i<4;i++) fT0shift[i]=0;
-	}
-    }
-  }
+  CalibrateEvent(event);
+  RecalculatePID(event);
+}
+
+//_____________________________________________________
+void AliTOFTenderSupply::InitRun()
+{
+  //
+  // Settings, TOF calibration and T0 detector correction of a new run
+  //
+  AliESDEvent *event=fTender->GetEvent();
+
+  Init();
 
   if (fTenderNoAction) return;
+  Int_t versionNumber = GetOCDBVersion(fTender->GetRun());
+  fTOFCalib->SetRunParamsSpecificVersion(versionNumber);
+  fTOFCalib->Init(fTender->GetRun());
+
+  if(event->GetT0TOF()){ // read T0 detector correction from OCDB
+    // OCDB instance
+    if (fT0DetectorAdjust) {
+      AliCDBManager* ocdbMan = AliCDBManager::Instance();
+      ocdbMan->SetRun(fTender->GetRun());
+      AliCDBEntry *entry = ocdbMan->Get("T0/Calib/TimeAdjust/");
+      if(entry) {
+        AliT0CalibSeasonTimeShift *clb = (AliT0CalibSeasonTimeShift*) entry->GetObject();
+        Float_t *t0means= clb->GetT0Means();
+        //      Float_t *t0sigmas = clb->GetT0Sigmas();
+        fT0shift[0] = t0means[0] + fT0IntercalibrationShift;
+        fT0shift[1] = t0means[1] + fT0IntercalibrationShift;
+        fT0shift[2] = t0means[2] + fT0IntercalibrationShift;
+        fT0shift[3] = t0means[3] + fT0IntercalibrationShift;
+      } else {
+        for (Int_t i=0;i<4;i++) fT0shift[i]=0;
+        AliWarning("TofTender no T0 entry found T0shift set to 0");
+      }
+    } else {
+      for (Int_t i=0;i<4;i++) fT0shift[i]=0;
+    }
+  }
+}
 
+//_____________________________________________________
+void AliTOFTenderSupply::CalibrateEvent(AliESDEvent *event)
+{
+  //
+  // Recalibrate the TOF signals, adjust the T0 detector times and
+  // compute the TOF-T0 of the event
+  //
   fTOFCalib->CalibrateESD(event);   //recalculate TOF signal (no harm for MC, see settings inside init)
 
 
@@ -430,7 +457,11 @@ void AliTOFTenderSupply::ProcessEvent()
   //compute timeZero of the event via TOF-TO
   fTOFT0maker->ComputeT0TOF(event);
   fTOFT0maker->WriteInESD(event);
+}
 
+//_____________________________________________________
+void AliTOFTenderSupply::RecalculatePID(AliESDEvent *event)
+{
   //  set preferred startTime: this is now done via AliPIDResponseTask
   fESDpid->SetTOFResponse(event, (AliESDpid::EStartTimeType_t)fTOFPIDParams->GetStartTimeMethod());
 
@@ -450,6 +481,82 @@ void AliTOFTenderSupply::ProcessEvent()
 }
 
 
+//_____________________________________________________
+Bool_t AliTOFTenderSupply::ChangesExpectedTimes() const
+{
+  //
+  // The settings of the run modify the expected times or the TRD dE/dx
+  // of the tracks, which are not in the friend tree
+  //
+  return fCorrectExpTimes || (fLHC10dPatch && !fIsMC) || (fCorrectTRDBug && !fIsMC) || fForceCorrectTRDBug;
+}
+
+//_____________________________________________________
+Bool_t AliTOFTenderSupply::ConnectFriendBranches(TTree *tree, Bool_t write)
+{
+  //
+  // TOF signals, T0 detector times and TOF-T0 in the friend tree
+  //
+  if (!fFriendTOFsignal) fFriendTOFsignal=new std::vector<Double_t>;
+  if (!fFriendTOFHeader) fFriendTOFHeader=new AliTOFHeader();
+  if (write) {
+    tree->Branch("TOFsignal", &fFriendTOFsignal);
+    tree->Branch("T0TOF", fFriendT0TOF, "T0TOF[3]/D");
+    tree->Branch("TOFHeader", &fFriendTOFHeader);
+    return kTRUE;
+  }
+  if (!tree->GetBranch("TOFsignal") || !tree->GetBranch("T0TOF") || !tree->GetBranch("TOFHeader")) return kFALSE;
+  tree->SetBranchAddress("TOFsignal", &fFriendTOFsignal);
+  tree->SetBranchAddress("T0TOF", fFriendT0TOF);
+  tree->SetBranchAddress("TOFHeader", &fFriendTOFHeader);
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliTOFTenderSupply::FillFriendEvent()
+{
+  //
+  // Store the TOF signal of all tracks and the event times
+  //
+  AliESDEvent *event=fTender->GetEvent();
+  fFriendTOFsignal->clear();
+  Int_t ntracks=event->GetNumberOfTracks();
+  for(Int_t itrack = 0; itrack < ntracks; itrack++)
+    fFriendTOFsignal->push_back(event->GetTrack(itrack)->GetTOFsignal());
+  for (Int_t i=0;i<3;i++) fFriendT0TOF[i]=event->GetT0TOF() ? event->GetT0TOF(i) : 0;
+  if (event->GetTOFHeader()) *fFriendTOFHeader=*event->GetTOFHeader();
+  else *fFriendTOFHeader=AliTOFHeader();
+}
+
+//_____________________________________________________
+void AliTOFTenderSupply::ApplyFriendEvent()
+{
+  //
+  // Set the TOF signals and event times of the friend tree, reapply PID
+  // information. Runs where the tender also corrects the expected times
+  // or the TRD dE/dx are recalibrated as usual.
+  //
+  AliESDEvent *event=fTender->GetEvent();
+  if (!event) return;
+
+  if (fTender->RunChanged()) InitRun();
+
+  if (fTenderNoAction) return;
+
+  Int_t ntracks=event->GetNumberOfTracks();
+  if (ChangesExpectedTimes() || ntracks != (Int_t)fFriendTOFsignal->size()) {
+    CalibrateEvent(event);
+  } else {
+    for(Int_t itrack = 0; itrack < ntracks; itrack++)
+      event->GetTrack(itrack)->SetTOFsignal((*fFriendTOFsignal)[itrack]);
+    if (event->GetT0TOF()) {
+      for (Int_t i=0;i<3;i++) event->SetT0TOF(i,fFriendT0TOF[i]);
+    }
+    event->SetTOFHeader(fFriendTOFHeader);
+  }
+  RecalculatePID(event);
+}
+
 //_____________________________________________________
 void AliTOFTenderSupply::RecomputeTExp(AliESDEvent *event) const
 {
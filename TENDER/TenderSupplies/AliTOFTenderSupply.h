@@ -10,6 +10,7 @@
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <AliTenderSupply.h>
 #include <AliLog.h>
 #include <AliESDpid.h>
@@ -19,16 +20,20 @@ class AliTOFcalib;
 class AliTOFT0maker;
 class AliESDEevent;
 class AliESDtrack;
+class AliTOFHeader;
 class AliTOFTenderSupply: public AliTenderSupply {
 
 public:
   AliTOFTenderSupply();
   AliTOFTenderSupply(const char *name, const AliTender *tender=NULL);
 
-  virtual ~AliTOFTenderSupply(){;}
+  virtual ~AliTOFTenderSupply(){delete fFriendTOFsignal; delete fFriendTOFHeader;}
 
   virtual void              Init();
   virtual void              ProcessEvent();
+  virtual Bool_t            ConnectFriendBranches(TTree *tree, Bool_t write);
+  virtual void              FillFriendEvent();
+  virtual void              ApplyFriendEvent();
 
   // TOF tender methods
   void SetIsMC(Bool_t flag=kFALSE){fIsMC=flag;}
@@ -114,6 +119,16 @@ private:
   Double_t fMagField;               // magnetic field value [kGauss]
   ULong64_t fCDBkey;
 
+  // friend tree of the recalibrated TOF signals and event times
+  std::vector<Double_t> *fFriendTOFsignal; //! TOF signal of each track
+  Double_t fFriendT0TOF[3];                 //! T0 detector times (AC, A, C)
+  AliTOFHeader *fFriendTOFHeader;           //! TOF-T0 of the event
+
+  void InitRun();
+  void CalibrateEvent(AliESDEvent *event);
+  void RecalculatePID(AliESDEvent *event);
+  Bool_t ChangesExpectedTimes() const;
+
   AliTOFTenderSupply(const AliTOFTenderSupply&c);
   AliTOFTenderSupply& operator= (const AliTOFTenderSupply&c);
 
@@ -28,6 +28,7 @@
 #include <TString.h>
 #include <TPRegexp.h>
 #include <TGraphErrors.h>
+#include <TTree.h>
 
 #include <AliDCSSensor.h>
 #include <AliGRPObject.h>
@@ -72,7 +73,8 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fFriendTPCsignal(0x0)
 {
   //
   // default ctor
@@ -101,7 +103,8 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fFriendTPCsignal(0x0)
 {
   //
   // named ctor
@@ -159,16 +162,29 @@ void AliTPCTenderSupply::ProcessEvent()
   if (!event) return;
   
   //load gain correction if run has changed
-  if (fTender->RunChanged()){
-    SetBeamType();
-    SetRecoInfo();
-    if ( fBeamType == "PBPB" ) fMultiCorrection=kTRUE;
-
-    if (fDebugLevel>0) AliInfo(Form("Run Changed (%d)",fTender->GetRun()));
-    SetParametrisation();
-    if (fGainCorrection) SetSplines();
-  }
-  
+  if (fTender->RunChanged()) InitRun();
+
+  CorrectSignals(event);
+}
+
+//_____________________________________________________
+void AliTPCTenderSupply::InitRun()
+{
+  //
+  // Run dependent settings, parametrisation and gain correction
+  //
+  SetBeamType();
+  SetRecoInfo();
+  if ( fBeamType == "PBPB" ) fMultiCorrection=kTRUE;
+
+  if (fDebugLevel>0) AliInfo(Form("Run Changed (%d)",fTender->GetRun()));
+  SetParametrisation();
+  if (fGainCorrection) SetSplines();
+}
+
+//_____________________________________________________
+void AliTPCTenderSupply::CorrectSignals(AliESDEvent *event)
+{
   //
   // get gain correction factor
   //
@@ -206,6 +222,62 @@ void AliTPCTenderSupply::ProcessEvent()
   }
 }
 
+//_____________________________________________________
+Bool_t AliTPCTenderSupply::ConnectFriendBranches(TTree *tree, Bool_t write)
+{
+  //
+  // Corrected TPC signals in the friend tree
+  //
+  if (!fFriendTPCsignal) fFriendTPCsignal=new std::vector<Float_t>;
+  if (write) {
+    tree->Branch("TPCsignal", &fFriendTPCsignal);
+    return kTRUE;
+  }
+  if (!tree->GetBranch("TPCsignal")) return kFALSE;
+  tree->SetBranchAddress("TPCsignal", &fFriendTPCsignal);
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliTPCTenderSupply::FillFriendEvent()
+{
+  //
+  // Store the corrected TPC signal of all tracks
+  //
+  AliESDEvent *event=fTender->GetEvent();
+  fFriendTPCsignal->clear();
+  Int_t ntracks=event->GetNumberOfTracks();
+  for(Int_t itrack = 0; itrack < ntracks; itrack++)
+    fFriendTPCsignal->push_back(event->GetTrack(itrack)->GetTPCsignal());
+}
+
+//_____________________________________________________
+void AliTPCTenderSupply::ApplyFriendEvent()
+{
+  //
+  // Set the corrected TPC signals of the friend tree, reapply pid information
+  //
+  AliESDEvent *event=fTender->GetEvent();
+  if (!event) return;
+
+  // the parametrisation is needed for the pid
+  if (fTender->RunChanged()) InitRun();
+
+  Int_t ntracks=event->GetNumberOfTracks();
+  if (ntracks != (Int_t)fFriendTPCsignal->size()) {
+    AliError(Form("Friend tree has %d tracks, event %d: correcting the signals",(Int_t)fFriendTPCsignal->size(),ntracks));
+    CorrectSignals(event);
+    return;
+  }
+
+  for(Int_t itrack = 0; itrack < ntracks; itrack++){
+    AliESDtrack *track=event->GetTrack(itrack);
+    if (!track->GetInnerParam()) continue;
+    track->SetTPCsignal((*fFriendTPCsignal)[itrack],track->GetTPCsignalSigma(), track->GetTPCsignalN());
+    fESDpid->MakeTPCPID(track);
+  }
+}
+
 //_____________________________________________________
 Double_t AliTPCTenderSupply::GetTPCMultiplicityBin()
 {
@@ -10,6 +10,7 @@
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TString.h>
 
 #include <AliTenderSupply.h>
@@ -21,6 +22,7 @@ class AliGRPObject;
 class TGraphErrors;
 class AliAnalysisManager;
 class TF1;
+class AliESDEvent;
 
 class AliTPCTenderSupply: public AliTenderSupply {
   
@@ -28,7 +30,7 @@ public:
   AliTPCTenderSupply();
   AliTPCTenderSupply(const char *name, const AliTender *tender=NULL);
   
-  virtual ~AliTPCTenderSupply(){;}
+  virtual ~AliTPCTenderSupply(){delete fFriendTPCsignal;}
 
   void SetGainCorrection(Bool_t gainCorr) {fGainCorrection=gainCorr;}
   void SetAttachmentCorrection(Bool_t attCorr) {fAttachmentCorrection=attCorr;}
@@ -42,6 +44,9 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+  virtual Bool_t            ConnectFriendBranches(TTree *tree, Bool_t write);
+  virtual void              FillFriendEvent();
+  virtual void              ApplyFriendEvent();
   
 private:
   AliESDpid          *fESDpid;         //! ESD pid object
@@ -69,6 +74,10 @@ private:
   TString fMCperiod;                 //! corresponding MC period to use for the splines
   Int_t   fRecoPass;                 //! reconstruction pass
 
+  std::vector<Float_t> *fFriendTPCsignal; //! corrected TPC signal of each track in the friend tree
+
+  void InitRun();
+  void CorrectSignals(AliESDEvent *event);
   void SetSplines();
   Double_t GetGainCorrection();
 
@@ -21,6 +21,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 
+#include <TTree.h>
 #include <AliESDEvent.h>
 #include <AliESDInputHandler.h>
 #include <AliVertexerTracks.h>
@@ -37,7 +38,8 @@ ClassImp(AliVtxTenderSupply)
 AliVtxTenderSupply::AliVtxTenderSupply() :
   AliTenderSupply(),
   fDiamond(0x0),
-  fRefitAlgo(-1)
+  fRefitAlgo(-1),
+  fFriendVertex(0x0)
 {
   //
   // default ctor
@@ -48,7 +50,8 @@ AliVtxTenderSupply::AliVtxTenderSupply() :
 AliVtxTenderSupply::AliVtxTenderSupply(const char *name, const AliTender *tender) :
   AliTenderSupply(name,tender),
   fDiamond(0x0),
-  fRefitAlgo(-1)
+  fRefitAlgo(-1),
+  fFriendVertex(0x0)
 {
   //
   // named ctor
@@ -72,17 +75,7 @@ void AliVtxTenderSupply::ProcessEvent()
   }
   //
 
-  if (fTender->RunChanged()){
-    fDiamond=0x0;
-    AliCDBEntry *meanVertex=fTender->GetCDBManager()->Get("GRP/Calib/MeanVertex",fTender->GetRun());
-    if (!meanVertex) {
-      AliError("No new MeanVertex entry found");
-      return;
-    } else {
-      fDiamond=(AliESDVertex*)meanVertex->GetObject();
-    }
-    //printf("\nRun %d, sigmaX %f, sigmaY %f\n",fTender->GetRun(),fDiamond->GetXRes(),fDiamond->GetYRes());
-  }
+  if (fTender->RunChanged()) LoadDiamond();
 
   if (!fDiamond) return;
 
@@ -99,3 +92,66 @@ void AliVtxTenderSupply::ProcessEvent()
     delete pvertex;
   }  
 }
+
+//_____________________________________________________
+void AliVtxTenderSupply::LoadDiamond()
+{
+  //
+  // Mean vertex of the run from the OCDB
+  //
+  fDiamond=0x0;
+  AliCDBEntry *meanVertex=fTender->GetCDBManager()->Get("GRP/Calib/MeanVertex",fTender->GetRun());
+  if (!meanVertex) {
+    AliError("No new MeanVertex entry found");
+    return;
+  }
+  fDiamond=(AliESDVertex*)meanVertex->GetObject();
+  //printf("\nRun %d, sigmaX %f, sigmaY %f\n",fTender->GetRun(),fDiamond->GetXRes(),fDiamond->GetYRes());
+}
+
+//_____________________________________________________
+Bool_t AliVtxTenderSupply::ConnectFriendBranches(TTree *tree, Bool_t write)
+{
+  //
+  // Tracks vertex in the friend tree, not for the refit with user supplied algo
+  //
+  if (fRefitAlgo >=0 ) return kFALSE;
+  if (!fFriendVertex) fFriendVertex=new AliESDVertex();
+  if (write) {
+    tree->Branch("PrimaryVertexTracks", &fFriendVertex);
+    return kTRUE;
+  }
+  if (!tree->GetBranch("PrimaryVertexTracks")) return kFALSE;
+  tree->SetBranchAddress("PrimaryVertexTracks", &fFriendVertex);
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliVtxTenderSupply::FillFriendEvent()
+{
+  //
+  // Store the tracks vertex
+  //
+  const AliESDVertex *vertex=fTender->GetEvent()->GetPrimaryVertexTracks();
+  if (vertex) *fFriendVertex=*vertex;
+  else *fFriendVertex=AliESDVertex();
+}
+
+//_____________________________________________________
+void AliVtxTenderSupply::ApplyFriendEvent()
+{
+  //
+  // Set the tracks vertex of the friend tree instead of redoing it
+  //
+  AliESDEvent *event=fTender->GetEvent();
+  if (!event) return;
+
+  if (fTender->RunChanged()) LoadDiamond();
+
+  if (!fDiamond) return;
+
+  if ( (fDiamond->GetXRes())<2){ 
+    event->SetPrimaryVertexTracks(fFriendVertex);
+    event->SetDiamond(fDiamond);
+  }  
+}
@@ -20,10 +20,13 @@ public:
   AliVtxTenderSupply();
   AliVtxTenderSupply(const char *name, const AliTender *tender=NULL);
   
-  virtual ~AliVtxTenderSupply(){;}
+  virtual ~AliVtxTenderSupply(){delete fFriendVertex;}
   
   virtual void              Init(){;}
   virtual void              ProcessEvent();
+  virtual Bool_t            ConnectFriendBranches(TTree *tree, Bool_t write);
+  virtual void              FillFriendEvent();
+  virtual void              ApplyFriendEvent();
   //
   Int_t   GetRefitAlgo()              const {return fRefitAlgo;}
   void    SetRefitAlgo(Int_t alg=-1)        {fRefitAlgo = alg;}
@@ -35,6 +38,9 @@ private:
 
   AliESDVertex *fDiamond;           //!Information about mean vertex  
   Int_t         fRefitAlgo;         //! optional request for vertex refit 
+  AliESDVertex *fFriendVertex;      //! tracks vertex of the friend tree
+
+  void LoadDiamond();
 
   ClassDef(AliVtxTenderSupply, 1);  // Primary vertex tender task
 };